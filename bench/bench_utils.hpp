@@ -0,0 +1,54 @@
+#ifndef _BENCH_UTILS_HPP_
+#define _BENCH_UTILS_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include <unistd.h>
+
+namespace labwork7 {
+
+namespace bench {
+
+/* Path in the temporary directory unique to the bench process */
+inline std::filesystem::path TempPath(const std::string& name) {
+    return std::filesystem::temp_directory_path() / ("unrolled_list_bench_" + name + "_" + std::to_string(::getpid()));
+}
+
+
+template<typename ValueType>
+inline void DoNotOptimize(const ValueType& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+
+template<typename FuncType>
+double MeasureMs(FuncType&& func) {
+    auto start = std::chrono::steady_clock::now();
+    func();
+    auto finish = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(finish - start).count();
+}
+
+
+inline void PrintHeader(std::string_view title) {
+    std::cout << "\n== " << title << " ==\n";
+}
+
+
+inline void PrintRow(std::string_view name, size_t count, double milliseconds) {
+    std::cout << std::left << std::setw(48) << name
+              << std::right << std::setw(12) << count
+              << std::setw(14) << std::fixed << std::setprecision(3) << milliseconds << " ms\n";
+}
+
+} // namespace bench
+
+} // namespace labwork7
+
+#endif // _BENCH_UTILS_HPP_
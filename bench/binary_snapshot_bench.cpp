@@ -0,0 +1,92 @@
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <string>
+
+#include <unistd.h>
+
+#include <unrolled_list.hpp>
+#include <unrolled_list_io.hpp>
+#include <mapped_unrolled_list.hpp>
+
+#include "bench_utils.hpp"
+
+namespace {
+
+constexpr size_t kListSize = 10'000'000;
+
+
+/* What a restart does without snapshots: a push_back per element parsed from a text dump */
+template<typename ListType>
+double RunTextDump(const std::filesystem::path& path) {
+    ListType list;
+    double milliseconds = labwork7::bench::MeasureMs([&] {
+        std::ifstream input(path);
+        uint64_t value;
+        while (input >> value) {
+            list.push_back(value);
+        }
+    });
+
+    labwork7::bench::DoNotOptimize(list.back());
+    return milliseconds;
+}
+
+
+template<typename ListType>
+double RunLoad(const std::filesystem::path& path) {
+    ListType list;
+    double milliseconds = labwork7::bench::MeasureMs([&] {
+        labwork7::load(list, path);
+    });
+
+    labwork7::bench::DoNotOptimize(list.back());
+    return milliseconds;
+}
+
+
+/* Opening the mapping and summing every element, so each page is faulted in once */
+double RunMapped(const std::filesystem::path& path) {
+    uint64_t sum = 0;
+    double milliseconds = labwork7::bench::MeasureMs([&] {
+        mapped_unrolled_list<uint64_t> mapped(path);
+        sum = std::accumulate(mapped.begin(), mapped.end(), uint64_t{0});
+    });
+
+    labwork7::bench::DoNotOptimize(sum);
+    return milliseconds;
+}
+
+} // namespace
+
+
+int main() {
+    using namespace labwork7::bench;
+
+    std::filesystem::path text_path = TempPath("text");
+    std::filesystem::path snapshot_path = TempPath("snapshot");
+
+    {
+        unrolled_list<uint64_t, 64> list;
+        std::ofstream text(text_path);
+        for (uint64_t ind = 0; ind != kListSize; ++ind) {
+            list.push_back(ind * 2654435761u);
+            text << list.back() << '\n';
+        }
+
+        PrintHeader(std::to_string(kListSize) + " uint64_t, save");
+        PrintRow("unrolled_list<uint64_t, 64>::save", kListSize, MeasureMs([&] { labwork7::save(list, snapshot_path); }));
+    }
+
+    PrintHeader(std::to_string(kListSize) + " uint64_t, cold start from a file in the page cache");
+    PrintRow("text dump, push_back per element", kListSize, RunTextDump<unrolled_list<uint64_t, 64>>(text_path));
+    PrintRow("unrolled_list<uint64_t, 64>::load", kListSize, RunLoad<unrolled_list<uint64_t, 64>>(snapshot_path));
+    PrintRow("unrolled_list<uint64_t, 512>::load", kListSize, RunLoad<unrolled_list<uint64_t, 512>>(snapshot_path));
+    PrintRow("mapped_unrolled_list<uint64_t>, open and sum", kListSize, RunMapped(snapshot_path));
+
+    std::filesystem::remove(text_path);
+    std::filesystem::remove(snapshot_path);
+    return 0;
+}
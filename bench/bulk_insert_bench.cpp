@@ -0,0 +1,52 @@
+#include <cstddef>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <unrolled_list.hpp>
+
+#include "bench_utils.hpp"
+
+namespace {
+
+template<size_t kChunckSize>
+void RunForChunckSize(size_t count) {
+    using namespace labwork7::bench;
+
+    std::vector<int> values(count);
+    std::iota(values.begin(), values.end(), 0);
+
+    PrintHeader("ChunckSize " + std::to_string(kChunckSize));
+
+    PrintRow("build from scratch (range constructor)", count, MeasureMs([&] {
+        unrolled_list<int, kChunckSize> list(values.begin(), values.end());
+        DoNotOptimize(list.size());
+    }));
+
+    unrolled_list<int, kChunckSize> list(values.begin(), values.end());
+    PrintRow("insert range in the middle", count, MeasureMs([&] {
+        DoNotOptimize(list.insert(list.nth(count / 2), values.begin(), values.end()));
+    }));
+
+    PrintRow("insert count copies in the middle", count, MeasureMs([&] {
+        DoNotOptimize(list.insert(list.nth(count / 3), count, 42));
+    }));
+
+    PrintRow("emplace one by one in the middle", count / 100, MeasureMs([&] {
+        auto pos_itr = list.nth(count / 4);
+        for (size_t ind = 0; ind < count / 100; ++ind) {
+            pos_itr = ++list.emplace(pos_itr, 7);
+        }
+    }));
+}
+
+} // namespace
+
+
+int main() {
+    RunForChunckSize<16>(1'000'000);
+    RunForChunckSize<64>(1'000'000);
+    RunForChunckSize<256>(1'000'000);
+
+    return 0;
+}
@@ -0,0 +1,77 @@
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <checkpointed_unrolled_list.hpp>
+
+#include "bench_utils.hpp"
+
+namespace {
+
+constexpr size_t kListSize = 4'000'000;
+constexpr size_t kCheckpointCount = 20;
+
+
+/* writes_per_checkpoint sets and inserts at random positions between checkpoints, only the checkpoints are measured */
+template<typename ListType>
+double RunCheckpoints(ListType& list, size_t writes_per_checkpoint, bool is_full_snapshot) {
+    std::filesystem::path path = labwork7::bench::TempPath("checkpoint");
+    std::filesystem::remove(path);
+    int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+    list.checkpoint(fd);
+
+    std::mt19937_64 generator(22);
+    double milliseconds = 0;
+
+    for (size_t checkpoint = 0; checkpoint != kCheckpointCount; ++checkpoint) {
+        for (size_t ind = 0; ind != writes_per_checkpoint; ++ind) {
+            size_t index = generator() % list.size();
+            if (ind % 8 == 0) {
+                list.insert_at(index, ind);
+            } else {
+                list.set(index, ind);
+            }
+        }
+
+        milliseconds += labwork7::bench::MeasureMs([&] {
+            if (is_full_snapshot) {
+                list.save(path);
+            } else {
+                list.checkpoint(fd);
+            }
+        });
+    }
+
+    ::close(fd);
+    std::filesystem::remove(path);
+    return milliseconds;
+}
+
+} // namespace
+
+
+int main() {
+    using namespace labwork7::bench;
+    using list_t = checkpointed_unrolled_list<uint64_t, 64>;
+
+    std::vector<uint64_t> values(kListSize);
+    std::iota(values.begin(), values.end(), 0);
+
+    for (size_t writes_per_checkpoint : {size_t{10}, size_t{100}, size_t{1'000}, size_t{10'000}}) {
+        PrintHeader(std::to_string(kListSize) + " uint64_t, " + std::to_string(writes_per_checkpoint)
+            + " writes between " + std::to_string(kCheckpointCount) + " checkpoints");
+
+        list_t list(values.begin(), values.end());
+        PrintRow("checkpoint, fdatasync included", kCheckpointCount, RunCheckpoints(list, writes_per_checkpoint, false));
+        PrintRow("full save, fsync included", kCheckpointCount, RunCheckpoints(list, writes_per_checkpoint, true));
+    }
+
+    return 0;
+}
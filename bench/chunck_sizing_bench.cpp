@@ -0,0 +1,69 @@
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include <unrolled_list.hpp>
+
+#include "bench_utils.hpp"
+
+namespace {
+
+struct BigValue {
+    long payload[25] = {};
+};
+
+
+long Key(char value) { return value; }
+long Key(int value) { return value; }
+long Key(const BigValue& value) { return value.payload[0]; }
+
+
+template<typename ListType>
+void RunForList(std::string_view name, size_t count) {
+    using namespace labwork7::bench;
+    using value_type = typename ListType::value_type;
+
+    ListType list;
+    for (size_t ind = 0; ind < count; ++ind) {
+        list.push_back(value_type{});
+    }
+
+    size_t chuncks = 0;
+    for (auto chunck : list.chunks()) {
+        DoNotOptimize(chunck.data());
+        ++chuncks;
+    }
+    size_t chunck_bytes = sizeof(*list.begin().segment());
+
+    PrintRow(std::string(name) + ": scan", count, MeasureMs([&] {
+        long sum = 0;
+        for (const auto& value : list) {
+            sum += Key(value);
+        }
+        DoNotOptimize(sum);
+    }));
+    std::cout << std::string(4, ' ') << "chunck " << chunck_bytes << " B, "
+              << static_cast<double>(chuncks * chunck_bytes) / static_cast<double>(count) << " B per element\n";
+}
+
+
+template<typename DataType>
+void RunForType(std::string_view type_name, size_t count) {
+    labwork7::bench::PrintHeader(std::string(type_name) + ", sizeof " + std::to_string(sizeof(DataType)));
+
+    RunForList<unrolled_list<DataType>>("ChunckSize 10", count);
+    RunForList<unrolled_list_for_bytes<DataType, 256>>("256 B chuncks", count);
+    RunForList<unrolled_list_for_bytes<DataType, 4096>>("4 KB chuncks", count);
+}
+
+} // namespace
+
+
+int main() {
+    RunForType<char>("char", 4'000'000);
+    RunForType<int>("int", 4'000'000);
+    RunForType<BigValue>("200 byte struct", 400'000);
+
+    return 0;
+}
@@ -0,0 +1,135 @@
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unrolled_list.hpp>
+#include <concurrent_unrolled_list.hpp>
+
+#include "bench_utils.hpp"
+
+namespace {
+
+constexpr size_t kInitialSize = 50'000;
+constexpr size_t kOperationCount = 100'000;
+
+
+/* What the list replaces: unrolled_list behind a single mutex */
+class LockedUnrolledList {
+  public:
+    void push_back(uint64_t value) {
+        std::lock_guard lock(mutex_m);
+        list_m.push_back(value);
+    };
+
+
+    bool insert(size_t index, uint64_t value) {
+        std::lock_guard lock(mutex_m);
+        if (index > list_m.size()) {
+            return false;
+        }
+        list_m.insert(list_m.nth(index), value);
+        return true;
+    };
+
+
+    bool erase(size_t index) {
+        std::lock_guard lock(mutex_m);
+        if (index >= list_m.size()) {
+            return false;
+        }
+        list_m.erase(list_m.nth(index));
+        return true;
+    };
+
+
+    std::optional<uint64_t> get(size_t index) {
+        std::lock_guard lock(mutex_m);
+        if (index >= list_m.size()) {
+            return std::nullopt;
+        }
+        return *list_m.nth(index);
+    };
+
+
+    size_t size() {
+        std::lock_guard lock(mutex_m);
+        return list_m.size();
+    };
+
+  private:
+    std::mutex mutex_m;
+    unrolled_list<uint64_t, 64> list_m;
+};
+
+
+/* read_percent of the operations are reads, the rest are inserts and erases in equal parts */
+template<typename ListType>
+double RunMixed(size_t thread_count, size_t read_percent) {
+    ListType list;
+    for (size_t ind = 0; ind != kInitialSize; ++ind) {
+        list.push_back(ind);
+    }
+
+    size_t per_thread = kOperationCount / thread_count;
+    uint64_t checksum = 0;
+    std::mutex checksum_mutex;
+
+    double milliseconds = labwork7::bench::MeasureMs([&] {
+        std::vector<std::thread> threads;
+        for (size_t thread = 0; thread != thread_count; ++thread) {
+            threads.emplace_back([&, thread] {
+                std::mt19937_64 generator(thread);
+                uint64_t local_sum = 0;
+
+                for (size_t ind = 0; ind != per_thread; ++ind) {
+                    size_t index = generator() % kInitialSize;
+                    size_t operation = generator() % 100;
+
+                    if (operation < read_percent) {
+                        local_sum += list.get(index).value_or(0);
+                    } else if (operation % 2) {
+                        list.insert(index, ind);
+                    } else {
+                        list.erase(index);
+                    }
+                }
+
+                std::lock_guard lock(checksum_mutex);
+                checksum += local_sum;
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    });
+
+    labwork7::bench::DoNotOptimize(checksum);
+    return milliseconds;
+}
+
+} // namespace
+
+
+int main() {
+    using namespace labwork7::bench;
+
+    for (size_t read_percent : {50, 90}) {
+        for (size_t thread_count : {1, 2, 4, 8}) {
+            PrintHeader(std::to_string(read_percent) + "% reads, " + std::to_string(thread_count) + " threads");
+
+            size_t count = kOperationCount / thread_count * thread_count;
+            PrintRow("unrolled_list behind std::mutex", count, RunMixed<LockedUnrolledList>(thread_count, read_percent));
+            PrintRow("concurrent_unrolled_list<uint64_t, 64>", count,
+                RunMixed<concurrent_unrolled_list<uint64_t, 64>>(thread_count, read_percent));
+            PrintRow("concurrent_unrolled_list<uint64_t, 256>", count,
+                RunMixed<concurrent_unrolled_list<uint64_t, 256>>(thread_count, read_percent));
+        }
+    }
+
+    return 0;
+}
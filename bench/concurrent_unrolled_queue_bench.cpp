@@ -0,0 +1,102 @@
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unrolled_list.hpp>
+#include <concurrent_unrolled_queue.hpp>
+
+#include "bench_utils.hpp"
+
+namespace {
+
+constexpr size_t kElementCount = 4'000'000;
+
+
+/* What the queue replaces: unrolled_list behind a single mutex */
+class LockedUnrolledQueue {
+  public:
+    void push(uint64_t value) {
+        std::lock_guard lock(mutex_m);
+        list_m.push_back(value);
+    };
+
+
+    bool try_pop(uint64_t& value) {
+        std::lock_guard lock(mutex_m);
+        if (list_m.empty()) {
+            return false;
+        }
+        value = list_m.front();
+        list_m.pop_front();
+        return true;
+    };
+
+  private:
+    std::mutex mutex_m;
+    unrolled_list<uint64_t, 64> list_m;
+};
+
+
+template<typename QueueType>
+double RunProducersConsumers(size_t thread_count) {
+    QueueType queue;
+    size_t per_producer = kElementCount / thread_count;
+    std::atomic<size_t> popped = 0;
+    std::atomic<uint64_t> checksum = 0;
+
+    double milliseconds = labwork7::bench::MeasureMs([&] {
+        std::vector<std::thread> threads;
+        for (size_t producer = 0; producer != thread_count; ++producer) {
+            threads.emplace_back([&, producer] {
+                for (size_t ind = 0; ind != per_producer; ++ind) {
+                    queue.push(producer * per_producer + ind);
+                }
+            });
+        }
+        for (size_t consumer = 0; consumer != thread_count; ++consumer) {
+            threads.emplace_back([&] {
+                uint64_t local_sum = 0;
+                uint64_t value = 0;
+                while (popped.load(std::memory_order_relaxed) != per_producer * thread_count) {
+                    if (queue.try_pop(value)) {
+                        local_sum += value;
+                        popped.fetch_add(1, std::memory_order_relaxed);
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+                checksum.fetch_add(local_sum, std::memory_order_relaxed);
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    });
+
+    labwork7::bench::DoNotOptimize(checksum.load());
+    return milliseconds;
+}
+
+} // namespace
+
+
+int main() {
+    using namespace labwork7::bench;
+
+    for (size_t thread_count : {1, 2, 4, 8, 16, 32}) {
+        PrintHeader(std::to_string(thread_count) + " producers, " + std::to_string(thread_count) + " consumers");
+
+        size_t count = kElementCount / thread_count * thread_count;
+        PrintRow("unrolled_list behind std::mutex", count, RunProducersConsumers<LockedUnrolledQueue>(thread_count));
+        PrintRow("concurrent_unrolled_queue<uint64_t, 64>", count,
+            RunProducersConsumers<concurrent_unrolled_queue<uint64_t, 64>>(thread_count));
+        PrintRow("concurrent_unrolled_queue<uint64_t, 512>", count,
+            RunProducersConsumers<concurrent_unrolled_queue<uint64_t, 512>>(thread_count));
+    }
+
+    return 0;
+}
@@ -0,0 +1,135 @@
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+
+#include <unrolled_list.hpp>
+
+#include "bench_utils.hpp"
+
+namespace {
+
+/* Every chunck is one allocation, so splits show up as allocations and merges as deallocations */
+struct ChunckCounters {
+    static inline size_t Allocated = 0;
+    static inline size_t Deallocated = 0;
+
+    static void Reset() noexcept { Allocated = Deallocated = 0; };
+};
+
+
+template<typename T>
+class CountingAllocator {
+  public:
+    using value_type = T;
+    using is_always_equal = std::true_type;
+
+    CountingAllocator() = default;
+
+    template<typename U>
+    CountingAllocator(const CountingAllocator<U>&) noexcept {  };
+
+    T* allocate(size_t count) {
+        ++ChunckCounters::Allocated;
+        return std::allocator<T>{}.allocate(count);
+    };
+
+    void deallocate(T* ptr, size_t count) noexcept {
+        ++ChunckCounters::Deallocated;
+        std::allocator<T>{}.deallocate(ptr, count);
+    };
+
+    template<typename U>
+    bool operator==(const CountingAllocator<U>&) const noexcept { return true; };
+};
+
+
+void PrintCounters(std::string_view name, size_t count, double milliseconds) {
+    using namespace labwork7::bench;
+
+    PrintRow(name, count, milliseconds);
+    std::cout << std::string(4, ' ') << "splits " << ChunckCounters::Allocated
+              << ", merges " << ChunckCounters::Deallocated << '\n';
+}
+
+
+template<typename PolicyType, size_t kChunckSize>
+void RunForPolicy(std::string_view policy_name, size_t count) {
+    using namespace labwork7::bench;
+    using list_t = labwork7::unrolled_list<int, kChunckSize, CountingAllocator<int>, PolicyType>;
+
+    PrintHeader(std::string(policy_name) + ", ChunckSize " + std::to_string(kChunckSize));
+
+    {
+        list_t list(1, count);
+        size_t boundary = kChunckSize * 10;
+        ChunckCounters::Reset();
+
+        double milliseconds = MeasureMs([&] {
+            for (size_t ind = 0; ind < count; ++ind) {
+                auto pos_itr = list.emplace(list.nth(boundary), 7);
+                DoNotOptimize(list.erase(pos_itr));
+            }
+        });
+        PrintCounters("alternating insert/erase at a chunck boundary", count, milliseconds);
+    }
+
+    {
+        list_t list(1, count / 10);
+        std::mt19937 generator(42);
+        ChunckCounters::Reset();
+
+        double milliseconds = MeasureMs([&] {
+            for (size_t ind = 0; ind < count; ++ind) {
+                size_t position = generator() % (list.size() + 1);
+                if (generator() % 2 == 0 || list.empty()) {
+                    DoNotOptimize(list.emplace(list.nth(position), 7));
+                } else {
+                    DoNotOptimize(list.erase(list.nth(position % list.size())));
+                }
+            }
+        });
+        PrintCounters("random insert/erase", count, milliseconds);
+    }
+
+    {
+        list_t list(1, count / 10);
+        ChunckCounters::Reset();
+
+        double milliseconds = MeasureMs([&] {
+            auto pos_itr = list.nth(list.size() / 2);
+            for (size_t ind = 0; ind < count; ++ind) {
+                pos_itr = ++list.emplace(pos_itr, 7);
+            }
+        });
+        PrintCounters("sequential inserts in the middle", count, milliseconds);
+
+        size_t chuncks = 0;
+        for (auto chunck : list.chunks()) {
+            DoNotOptimize(chunck.size());
+            ++chuncks;
+        }
+        std::cout << std::string(4, ' ') << "occupancy "
+                  << static_cast<double>(list.size()) / static_cast<double>(chuncks * kChunckSize) << '\n';
+    }
+}
+
+
+template<size_t kChunckSize>
+void RunForChunckSize(size_t count) {
+    RunForPolicy<labwork7::fill_policy::dense, kChunckSize>("dense", count);
+    RunForPolicy<labwork7::fill_policy::balanced, kChunckSize>("balanced", count);
+    RunForPolicy<labwork7::fill_policy::write_heavy, kChunckSize>("write_heavy", count);
+}
+
+} // namespace
+
+
+int main() {
+    RunForChunckSize<16>(200'000);
+    RunForChunckSize<64>(200'000);
+
+    return 0;
+}
@@ -0,0 +1,95 @@
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include <unrolled_list.hpp>
+#include <indexed_unrolled_list.hpp>
+
+#include "bench_utils.hpp"
+
+namespace {
+
+constexpr size_t kChunckSize = 64;
+constexpr size_t kOperations = 2000;
+
+template<typename ListType>
+void FillList(ListType& list, size_t count) {
+    for (size_t ind = 0; ind < count; ++ind) {
+        list.push_back(static_cast<int>(ind));
+    }
+}
+
+
+std::vector<size_t> RandomPositions(size_t count, size_t bound, unsigned seed) {
+    std::mt19937_64 generator(seed);
+    std::vector<size_t> result(count);
+    for (auto& position : result) {
+        position = generator() % bound;
+    }
+    return result;
+}
+
+
+void RunForSize(size_t list_size) {
+    using namespace labwork7::bench;
+
+    unrolled_list<int, kChunckSize> plain_list;
+    indexed_unrolled_list<int, kChunckSize> indexed_list;
+
+    PrintHeader("list size " + std::to_string(list_size));
+
+    PrintRow("fill: unrolled_list", list_size, MeasureMs([&] { FillList(plain_list, list_size); }));
+    PrintRow("fill: indexed_unrolled_list", list_size, MeasureMs([&] { FillList(indexed_list, list_size); }));
+
+    auto positions = RandomPositions(kOperations, list_size, 42);
+
+    PrintRow("nth: unrolled_list", kOperations, MeasureMs([&] {
+        for (size_t position : positions) {
+            DoNotOptimize(*plain_list.nth(position));
+        }
+    }));
+    PrintRow("nth: indexed_unrolled_list", kOperations, MeasureMs([&] {
+        for (size_t position : positions) {
+            DoNotOptimize(*indexed_list.nth(position));
+        }
+    }));
+
+    PrintRow("insert by index: unrolled_list", kOperations, MeasureMs([&] {
+        for (size_t position : positions) {
+            plain_list.insert(plain_list.nth(position), -1);
+        }
+    }));
+    PrintRow("insert by index: indexed_unrolled_list", kOperations, MeasureMs([&] {
+        for (size_t position : positions) {
+            indexed_list.insert_at(position, -1);
+        }
+    }));
+
+    PrintRow("erase by index: unrolled_list", kOperations, MeasureMs([&] {
+        for (size_t position : positions) {
+            plain_list.erase(plain_list.nth(position));
+        }
+    }));
+    PrintRow("erase by index: indexed_unrolled_list", kOperations, MeasureMs([&] {
+        for (size_t position : positions) {
+            indexed_list.erase_at(position);
+        }
+    }));
+
+    PrintRow("index_of: indexed_unrolled_list", kOperations, MeasureMs([&] {
+        for (size_t position : positions) {
+            DoNotOptimize(indexed_list.index_of(indexed_list.nth(position)));
+        }
+    }));
+}
+
+} // namespace
+
+
+int main() {
+    for (size_t list_size : {100'000ul, 1'000'000ul, 10'000'000ul}) {
+        RunForSize(list_size);
+    }
+
+    return 0;
+}
@@ -0,0 +1,132 @@
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <string>
+
+#include <unistd.h>
+
+#include <unrolled_list.hpp>
+#include <mapped_file_allocator.hpp>
+
+#include "bench_utils.hpp"
+
+/*
+    Scans a list 4 times larger than the memory limit of the cgroup, the file keeps what the page cache cannot.
+    Without a limit the list is 4 times 256 MiB, run it as
+        systemd-run --user --scope -p MemoryMax=256M ./mapped-file-allocator-bench [directory]
+    to see the scans go to the file. The file is created in the directory, the temp directory by default.
+*/
+
+namespace {
+
+constexpr size_t kDefaultLimitBytes = size_t{256} << 20;
+constexpr size_t kLimitFactor = 4;
+constexpr size_t kChunckSize = 512;
+
+using labwork7::chunck_allocator::MappedFileAllocator;
+using labwork7::chunck_allocator::access_pattern;
+
+using mapped_list_t = labwork7::unrolled_list<uint64_t, kChunckSize, MappedFileAllocator<uint64_t>>;
+
+
+std::optional<size_t> ReadLimit(const std::filesystem::path& path) {
+    std::ifstream input(path);
+    std::string value;
+    if (!(input >> value) || value == "max") {
+        return std::nullopt;
+    }
+
+    size_t limit = std::stoull(value);
+    size_t physical_bytes = static_cast<size_t>(::sysconf(_SC_PHYS_PAGES)) * static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    if (limit >= physical_bytes) {
+        return std::nullopt;
+    }
+    return limit;
+}
+
+
+/* memory.max of cgroup v2 or memory.limit_in_bytes of cgroup v1, for the cgroup of the process */
+std::optional<size_t> CgroupMemoryLimit() {
+    std::ifstream cgroups("/proc/self/cgroup");
+    std::string line;
+
+    while (std::getline(cgroups, line)) {
+        size_t first_colon = line.find(':');
+        size_t second_colon = line.find(':', first_colon + 1);
+        if (first_colon == std::string::npos || second_colon == std::string::npos) {
+            continue;
+        }
+
+        std::string controllers = line.substr(first_colon + 1, second_colon - first_colon - 1);
+        std::string relative_path = line.substr(second_colon + 2);
+
+        std::optional<size_t> limit;
+        if (controllers.empty()) {
+            limit = ReadLimit(std::filesystem::path("/sys/fs/cgroup") / relative_path / "memory.max");
+        } else if (controllers.find("memory") != std::string::npos) {
+            limit = ReadLimit(std::filesystem::path("/sys/fs/cgroup/memory") / relative_path / "memory.limit_in_bytes");
+            if (!limit) {
+                limit = ReadLimit("/sys/fs/cgroup/memory/memory.limit_in_bytes");
+            }
+        }
+
+        if (limit) {
+            return limit;
+        }
+    }
+
+    return std::nullopt;
+}
+
+
+double RunScan(const mapped_list_t& list, const MappedFileAllocator<uint64_t>& alloc, access_pattern pattern) {
+    alloc.advise(pattern);
+
+    uint64_t sum = 0;
+    double milliseconds = labwork7::bench::MeasureMs([&] {
+        for (uint64_t value : list) {
+            sum += value;
+        }
+    });
+
+    labwork7::bench::DoNotOptimize(sum);
+    return milliseconds;
+}
+
+} // namespace
+
+
+int main(int argc, char** argv) {
+    using namespace labwork7::bench;
+
+    std::filesystem::path directory = argc > 1 ? std::filesystem::path(argv[1]) : std::filesystem::temp_directory_path();
+    std::optional<size_t> limit = CgroupMemoryLimit();
+    if (!limit) {
+        std::cout << "no cgroup memory limit, the list is sized for " << (kDefaultLimitBytes >> 20) << " MiB\n";
+    }
+
+    size_t list_bytes = kLimitFactor * limit.value_or(kDefaultLimitBytes);
+    size_t list_size = list_bytes / sizeof(uint64_t);
+
+    MappedFileAllocator<uint64_t> alloc(directory);
+    mapped_list_t list(alloc);
+
+    PrintHeader(std::to_string(list_size) + " uint64_t, " + std::to_string(list_bytes >> 20) + " MiB in "
+        + directory.string() + ", limit " + std::to_string(limit.value_or(kDefaultLimitBytes) >> 20) + " MiB");
+
+    PrintRow("build, push_back", list_size, MeasureMs([&] {
+        for (uint64_t value = 0; value != list_size; ++value) {
+            list.push_back(value);
+        }
+    }));
+
+    PrintRow("scan, MADV_SEQUENTIAL", list_size, RunScan(list, alloc, access_pattern::sequential));
+    PrintRow("scan, MADV_NORMAL", list_size, RunScan(list, alloc, access_pattern::normal));
+    PrintRow("scan, MADV_SEQUENTIAL again", list_size, RunScan(list, alloc, access_pattern::sequential));
+
+    std::cout << "file mapped: " << (alloc.mapped_bytes() >> 20) << " MiB\n";
+    return 0;
+}
@@ -0,0 +1,76 @@
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <execution>
+#include <string>
+
+#include <unrolled_list.hpp>
+#include <algorithm.hpp>
+#include <parallel_algorithm.hpp>
+
+#include "bench_utils.hpp"
+
+namespace {
+
+constexpr size_t kListSize = 20'000'000;
+
+template<size_t kChunckSize>
+void RunForChunckSize() {
+    using namespace labwork7::bench;
+
+    unrolled_list<double, kChunckSize> list;
+    for (size_t ind = 0; ind < kListSize; ++ind) {
+        list.push_back(static_cast<double>(ind % 1000));
+    }
+
+    PrintHeader("ChunckSize " + std::to_string(kChunckSize) + ", "
+        + std::to_string(labwork7::details::WorkStealingPool::Default().Concurrency()) + " threads");
+
+    auto heavy = [](double value) { return std::sqrt(value) * std::sin(value); };
+
+    PrintRow("labwork7::for_each", kListSize, MeasureMs([&] {
+        labwork7::for_each(list.begin(), list.end(), [&](double value) { DoNotOptimize(heavy(value)); });
+    }));
+    PrintRow("labwork7::for_each (par)", kListSize, MeasureMs([&] {
+        labwork7::for_each(std::execution::par, list.begin(), list.end(), [&](double value) { DoNotOptimize(heavy(value)); });
+    }));
+
+    PrintRow("labwork7::transform (in place)", kListSize, MeasureMs([&] {
+        labwork7::transform(list.begin(), list.end(), list.begin(), [](double value) { return value + 1.0; });
+    }));
+    PrintRow("labwork7::transform (in place, par)", kListSize, MeasureMs([&] {
+        labwork7::transform(std::execution::par, list.begin(), list.end(), list.begin(), [](double value) { return value + 1.0; });
+    }));
+
+    PrintRow("labwork7::accumulate", kListSize, MeasureMs([&] {
+        DoNotOptimize(labwork7::accumulate(list.cbegin(), list.cend(), 0.0));
+    }));
+    PrintRow("labwork7::reduce (par)", kListSize, MeasureMs([&] {
+        DoNotOptimize(labwork7::reduce(std::execution::par, list.cbegin(), list.cend(), 0.0));
+    }));
+
+    auto is_big = [&](double value) { return heavy(value) > 30.0; };
+    PrintRow("labwork7::count_if (seq)", kListSize, MeasureMs([&] {
+        DoNotOptimize(labwork7::count_if(std::execution::seq, list.cbegin(), list.cend(), is_big));
+    }));
+    PrintRow("labwork7::count_if (par)", kListSize, MeasureMs([&] {
+        DoNotOptimize(labwork7::count_if(std::execution::par, list.cbegin(), list.cend(), is_big));
+    }));
+
+    PrintRow("labwork7::find_if (missing, seq)", kListSize, MeasureMs([&] {
+        DoNotOptimize(labwork7::find_if(std::execution::seq, list.cbegin(), list.cend(), [](double value) { return value < 0; }));
+    }));
+    PrintRow("labwork7::find_if (missing, par)", kListSize, MeasureMs([&] {
+        DoNotOptimize(labwork7::find_if(std::execution::par, list.cbegin(), list.cend(), [](double value) { return value < 0; }));
+    }));
+}
+
+} // namespace
+
+
+int main() {
+    RunForChunckSize<64>();
+    RunForChunckSize<512>();
+
+    return 0;
+}
@@ -0,0 +1,128 @@
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <unrolled_list.hpp>
+#include <persistent_unrolled_list.hpp>
+
+#include "bench_utils.hpp"
+
+namespace {
+
+constexpr size_t kListSize = 200'000;
+constexpr size_t kMutationCount = 200'000;
+
+
+struct Mutation {
+    size_t kind_m;
+    size_t index_m;
+};
+
+
+/* A set, an insert or an erase at a random position, the size stays around kListSize */
+std::vector<Mutation> MakeMutations() {
+    std::mt19937_64 generator(20);
+    std::vector<Mutation> mutations;
+    mutations.reserve(kMutationCount);
+
+    size_t size = kListSize;
+    for (size_t ind = 0; ind != kMutationCount; ++ind) {
+        size_t kind = generator() % 4;
+        mutations.push_back(Mutation{kind, generator() % (kind == 2 ? size + 1 : size)});
+        size += kind == 2;
+        size -= kind == 3;
+    }
+    return mutations;
+}
+
+
+/* Readers keep the latest snapshot, so every older version is freed when the next one is taken */
+template<typename ListType>
+double RunPersistent(const std::vector<Mutation>& mutations, size_t snapshot_period) {
+    ListType list;
+    for (size_t ind = 0; ind != kListSize; ++ind) {
+        list.push_back(ind);
+    }
+    ListType latest = list.snapshot();
+
+    double milliseconds = labwork7::bench::MeasureMs([&] {
+        for (size_t ind = 0; ind != mutations.size(); ++ind) {
+            const Mutation& mutation = mutations[ind];
+            if (mutation.kind_m < 2) {
+                list.set(mutation.index_m, ind);
+            } else if (mutation.kind_m == 2) {
+                list.insert(mutation.index_m, ind);
+            } else {
+                list.erase(mutation.index_m);
+            }
+
+            if (snapshot_period && ind % snapshot_period == 0) {
+                latest = list.snapshot();
+            }
+        }
+    });
+
+    labwork7::bench::DoNotOptimize(latest.size());
+    return milliseconds;
+}
+
+
+/* What the persistent list replaces: a full copy of unrolled_list per snapshot */
+template<typename ListType>
+double RunCopying(const std::vector<Mutation>& mutations, size_t snapshot_period) {
+    ListType list;
+    for (size_t ind = 0; ind != kListSize; ++ind) {
+        list.push_back(ind);
+    }
+    std::optional<ListType> latest(std::in_place, list);
+
+    double milliseconds = labwork7::bench::MeasureMs([&] {
+        for (size_t ind = 0; ind != mutations.size(); ++ind) {
+            const Mutation& mutation = mutations[ind];
+            if (mutation.kind_m < 2) {
+                list[mutation.index_m] = ind;
+            } else if (mutation.kind_m == 2) {
+                list.insert(list.nth(mutation.index_m), ind);
+            } else {
+                list.erase(list.nth(mutation.index_m));
+            }
+
+            if (snapshot_period && ind % snapshot_period == 0) {
+                latest.emplace(list);
+            }
+        }
+    });
+
+    labwork7::bench::DoNotOptimize(latest->size());
+    return milliseconds;
+}
+
+} // namespace
+
+
+int main() {
+    using namespace labwork7::bench;
+
+    std::vector<Mutation> mutations = MakeMutations();
+
+    for (size_t snapshot_period : {size_t{0}, size_t{10'000}, size_t{1'000}, size_t{100}, size_t{10}, size_t{1}}) {
+        std::string period_name = snapshot_period ? "every " + std::to_string(snapshot_period) + " mutations" : "no snapshots";
+        PrintHeader(std::to_string(kListSize) + " uint64_t, set/insert/erase, snapshot " + period_name);
+
+        PrintRow("persistent_unrolled_list<uint64_t, 64>", kMutationCount,
+            RunPersistent<persistent_unrolled_list<uint64_t, 64>>(mutations, snapshot_period));
+        PrintRow("persistent_unrolled_list<uint64_t, 256>", kMutationCount,
+            RunPersistent<persistent_unrolled_list<uint64_t, 256>>(mutations, snapshot_period));
+
+        /* a copy per mutation would take minutes */
+        if (!snapshot_period || snapshot_period >= 1'000) {
+            PrintRow("unrolled_list<uint64_t, 64>, copy per snapshot", kMutationCount,
+                RunCopying<unrolled_list<uint64_t, 64>>(mutations, snapshot_period));
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,75 @@
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
+#include <unrolled_list.hpp>
+
+#include "bench_utils.hpp"
+
+namespace {
+
+/* 64 bytes of payload, trivially copyable, so every shift is a memmove */
+struct TrivialPayload {
+    long values[8] = {};
+};
+
+
+/* The same payload with a user-provided move, so every shift goes element by element */
+struct MovablePayload {
+    MovablePayload() = default;
+    MovablePayload(const MovablePayload&) = default;
+    MovablePayload& operator=(const MovablePayload&) = default;
+
+    MovablePayload(MovablePayload&& other) noexcept {
+        for (size_t ind = 0; ind < 8; ++ind) {
+            values[ind] = other.values[ind];
+        }
+    };
+
+    long values[8] = {};
+};
+
+static_assert(labwork7::is_trivially_relocatable_v<TrivialPayload>);
+static_assert(!labwork7::is_trivially_relocatable_v<MovablePayload>);
+
+
+template<typename PayloadType, size_t kChunckSize>
+void RunForPayload(std::string_view payload_name, size_t count) {
+    using namespace labwork7::bench;
+
+    unrolled_list<PayloadType, kChunckSize> list(PayloadType{}, count);
+    auto pos_itr = list.nth(count / 2);
+
+    PrintRow(std::string(payload_name) + ": insert in the middle", count, MeasureMs([&] {
+        for (size_t ind = 0; ind < count; ++ind) {
+            pos_itr = list.emplace(pos_itr);
+        }
+    }));
+
+    PrintRow(std::string(payload_name) + ": erase in the middle", count, MeasureMs([&] {
+        for (size_t ind = 0; ind < count; ++ind) {
+            pos_itr = list.erase(pos_itr);
+        }
+    }));
+    DoNotOptimize(list.size());
+}
+
+
+template<size_t kChunckSize>
+void RunForChunckSize(size_t count) {
+    labwork7::bench::PrintHeader("ChunckSize " + std::to_string(kChunckSize));
+
+    RunForPayload<TrivialPayload, kChunckSize>("memmove", count);
+    RunForPayload<MovablePayload, kChunckSize>("element-wise", count);
+}
+
+} // namespace
+
+
+int main() {
+    RunForChunckSize<16>(200'000);
+    RunForChunckSize<64>(200'000);
+    RunForChunckSize<256>(200'000);
+
+    return 0;
+}
@@ -0,0 +1,65 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <string>
+
+#include <unrolled_list.hpp>
+#include <algorithm.hpp>
+
+#include "bench_utils.hpp"
+
+namespace {
+
+constexpr size_t kListSize = 10'000'000;
+
+template<size_t kChunckSize>
+void RunForChunckSize() {
+    using namespace labwork7::bench;
+
+    unrolled_list<int32_t, kChunckSize> list;
+    for (size_t ind = 0; ind < kListSize; ++ind) {
+        list.push_back(static_cast<int32_t>(ind % 1000));
+    }
+
+    PrintHeader("ChunckSize " + std::to_string(kChunckSize));
+
+    PrintRow("std::accumulate", kListSize, MeasureMs([&] {
+        DoNotOptimize(std::accumulate(list.cbegin(), list.cend(), int64_t{0}));
+    }));
+    PrintRow("labwork7::accumulate", kListSize, MeasureMs([&] {
+        DoNotOptimize(labwork7::accumulate(list.cbegin(), list.cend(), int64_t{0}));
+    }));
+
+    PrintRow("std::count", kListSize, MeasureMs([&] {
+        DoNotOptimize(std::count(list.cbegin(), list.cend(), 7));
+    }));
+    PrintRow("labwork7::count", kListSize, MeasureMs([&] {
+        DoNotOptimize(labwork7::count(list.cbegin(), list.cend(), 7));
+    }));
+
+    PrintRow("std::find (missing value)", kListSize, MeasureMs([&] {
+        DoNotOptimize(std::find(list.cbegin(), list.cend(), -1));
+    }));
+    PrintRow("labwork7::find (missing value)", kListSize, MeasureMs([&] {
+        DoNotOptimize(labwork7::find(list.cbegin(), list.cend(), -1));
+    }));
+
+    PrintRow("labwork7::transform (in place)", kListSize, MeasureMs([&] {
+        labwork7::transform(list.begin(), list.end(), list.begin(), [](int32_t value) { return value + 1; });
+    }));
+    PrintRow("labwork7::fill", kListSize, MeasureMs([&] {
+        labwork7::fill(list.begin(), list.end(), 3);
+    }));
+}
+
+} // namespace
+
+
+int main() {
+    RunForChunckSize<16>();
+    RunForChunckSize<64>();
+    RunForChunckSize<256>();
+
+    return 0;
+}
@@ -0,0 +1,122 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <string>
+
+#include <unrolled_list.hpp>
+#include <algorithm.hpp>
+
+#include "bench_utils.hpp"
+
+namespace {
+
+constexpr size_t kListSize = 10'000'000;
+
+using labwork7::details::simd::isa_level;
+
+
+const char* IsaName(isa_level level) {
+    switch (level) {
+        case isa_level::kAvx2: return "avx2";
+        case isa_level::kSse2: return "sse2";
+        default: return "scalar";
+    }
+}
+
+
+template<typename ListType, typename KernelFuncType>
+auto OverChuncks(const ListType& list, KernelFuncType&& kernel_func) {
+    decltype(kernel_func(nullptr, nullptr)) result{};
+    for (auto chunck : list.chunks()) {
+        result += kernel_func(chunck.data(), chunck.data() + chunck.size());
+    }
+    return result;
+}
+
+
+template<typename DataType, size_t kChunckSize>
+void RunForChunckSize() {
+    using namespace labwork7::bench;
+    namespace simd = labwork7::details::simd;
+
+    unrolled_list<DataType, kChunckSize> list;
+    for (size_t ind = 0; ind < kListSize; ++ind) {
+        list.push_back(static_cast<DataType>(ind % 1000));
+    }
+    const auto& const_list = list;
+
+    PrintHeader(std::string(sizeof(DataType) == 4 ? "32-bit " : "64-bit ")
+        + (std::is_integral_v<DataType> ? "integer" : "floating") + ", ChunckSize " + std::to_string(kChunckSize));
+
+    for (isa_level level : {isa_level::kScalar, simd::DetectIsaLevel()}) {
+        auto kernels = simd::MakeKernels<DataType>(level);
+        std::string suffix = std::string(" [") + IsaName(level) + "]";
+
+        PrintRow("count kernel per chunck" + suffix, kListSize, MeasureMs([&] {
+            DoNotOptimize(OverChuncks(const_list, [&](const DataType* first, const DataType* last) {
+                return kernels.count(first, last, DataType{7});
+            }));
+        }));
+        PrintRow("find kernel per chunck (missing)" + suffix, kListSize, MeasureMs([&] {
+            DoNotOptimize(OverChuncks(const_list, [&](const DataType* first, const DataType* last) {
+                return static_cast<size_t>(kernels.find(first, last, DataType{-1}) - first);
+            }));
+        }));
+
+        if constexpr (std::is_integral_v<DataType>) {
+            PrintRow("sum kernel per chunck" + suffix, kListSize, MeasureMs([&] {
+                DoNotOptimize(OverChuncks(const_list, [&](const DataType* first, const DataType* last) {
+                    return kernels.sum_wide(first, last);
+                }));
+            }));
+            PrintRow("min_element kernel per chunck" + suffix, kListSize, MeasureMs([&] {
+                DoNotOptimize(OverChuncks(const_list, [&](const DataType* first, const DataType* last) {
+                    return *kernels.min_element(first, last);
+                }));
+            }));
+        }
+    }
+
+    PrintRow("std::count over iterators", kListSize, MeasureMs([&] {
+        DoNotOptimize(std::count(list.cbegin(), list.cend(), DataType{7}));
+    }));
+    PrintRow("labwork7::count", kListSize, MeasureMs([&] {
+        DoNotOptimize(labwork7::count(list.cbegin(), list.cend(), DataType{7}));
+    }));
+    PrintRow("std::find over iterators (missing)", kListSize, MeasureMs([&] {
+        DoNotOptimize(std::find(list.cbegin(), list.cend(), DataType{-1}));
+    }));
+    PrintRow("labwork7::find (missing)", kListSize, MeasureMs([&] {
+        DoNotOptimize(labwork7::find(list.cbegin(), list.cend(), DataType{-1}));
+    }));
+
+    if constexpr (std::is_integral_v<DataType>) {
+        PrintRow("std::accumulate over iterators", kListSize, MeasureMs([&] {
+            DoNotOptimize(std::accumulate(list.cbegin(), list.cend(), int64_t{0}));
+        }));
+        PrintRow("labwork7::accumulate", kListSize, MeasureMs([&] {
+            DoNotOptimize(labwork7::accumulate(list.cbegin(), list.cend(), int64_t{0}));
+        }));
+        PrintRow("std::min_element over iterators", kListSize, MeasureMs([&] {
+            DoNotOptimize(*std::min_element(list.cbegin(), list.cend()));
+        }));
+        PrintRow("labwork7::min_element", kListSize, MeasureMs([&] {
+            DoNotOptimize(*labwork7::min_element(list.cbegin(), list.cend()));
+        }));
+    }
+}
+
+} // namespace
+
+
+int main() {
+    RunForChunckSize<int32_t, 16>();
+    RunForChunckSize<int32_t, 64>();
+    RunForChunckSize<int32_t, 256>();
+    RunForChunckSize<int64_t, 64>();
+    RunForChunckSize<float, 64>();
+    RunForChunckSize<double, 256>();
+
+    return 0;
+}
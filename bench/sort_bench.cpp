@@ -0,0 +1,106 @@
+#include <algorithm>
+#include <cstddef>
+#include <execution>
+#include <iterator>
+#include <list>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <unrolled_list.hpp>
+#include <parallel_algorithm.hpp>
+
+#include "bench_utils.hpp"
+
+namespace {
+
+constexpr size_t kListSize = 2'000'000;
+
+
+template<typename ValueType>
+std::vector<ValueType> MakeValues(size_t count) {
+    std::mt19937_64 generator(16);
+    std::vector<ValueType> values;
+    values.reserve(count);
+
+    for (size_t ind = 0; ind != count; ++ind) {
+        if constexpr (std::is_same_v<ValueType, std::string>) {
+            values.push_back("key_" + std::to_string(generator() % 1'000'000) + "_which_does_not_fit_into_sso");
+        } else {
+            values.push_back(static_cast<ValueType>(generator() % 1'000'000));
+        }
+    }
+    return values;
+}
+
+
+template<typename ValueType, size_t kChunckSize>
+void RunForType(const std::string& type_name, size_t count) {
+    using namespace labwork7::bench;
+
+    std::vector<ValueType> values = MakeValues<ValueType>(count);
+
+    PrintHeader(type_name + ", ChunckSize " + std::to_string(kChunckSize));
+
+    {
+        std::list<ValueType> list(values.begin(), values.end());
+        PrintRow("std::list::sort", count, MeasureMs([&] { list.sort(); }));
+    }
+
+    {
+        unrolled_list<ValueType, kChunckSize> list(values.begin(), values.end());
+        PrintRow("copy to std::vector, std::sort, copy back", count, MeasureMs([&] {
+            std::vector<ValueType> buffer(std::make_move_iterator(list.begin()), std::make_move_iterator(list.end()));
+            std::sort(buffer.begin(), buffer.end());
+            list.clear();
+            list.insert(list.end(), std::make_move_iterator(buffer.begin()), std::make_move_iterator(buffer.end()));
+        }));
+        DoNotOptimize(list.front());
+    }
+
+    {
+        unrolled_list<ValueType, kChunckSize> list(values.begin(), values.end());
+        PrintRow("unrolled_list::sort", count, MeasureMs([&] { list.sort(); }));
+        DoNotOptimize(list.front());
+    }
+
+    {
+        unrolled_list<ValueType, kChunckSize> list(values.begin(), values.end());
+        PrintRow("unrolled_list::stable_sort", count, MeasureMs([&] { list.stable_sort(); }));
+        DoNotOptimize(list.front());
+    }
+
+    {
+        unrolled_list<ValueType, kChunckSize> list(values.begin(), values.end());
+        PrintRow("labwork7::sort (par)", count, MeasureMs([&] { labwork7::sort(std::execution::par, list); }));
+        DoNotOptimize(list.front());
+    }
+
+    {
+        std::vector<ValueType> left_values(values.begin(), values.begin() + count / 2);
+        std::vector<ValueType> right_values(values.begin() + count / 2, values.end());
+        std::sort(left_values.begin(), left_values.end());
+        std::sort(right_values.begin(), right_values.end());
+
+        std::list<ValueType> std_left(left_values.begin(), left_values.end());
+        std::list<ValueType> std_right(right_values.begin(), right_values.end());
+        PrintRow("std::list::merge", count, MeasureMs([&] { std_left.merge(std_right); }));
+
+        unrolled_list<ValueType, kChunckSize> left(left_values.begin(), left_values.end());
+        unrolled_list<ValueType, kChunckSize> right(right_values.begin(), right_values.end());
+        PrintRow("unrolled_list::merge", count, MeasureMs([&] { left.merge(right); }));
+        DoNotOptimize(left.front());
+    }
+}
+
+} // namespace
+
+
+int main() {
+    RunForType<int, 64>("int", kListSize);
+    RunForType<int, 512>("int", kListSize);
+    RunForType<std::string, 32>("std::string", kListSize / 4);
+
+    return 0;
+}
@@ -0,0 +1,150 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <mutex>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unrolled_list.hpp>
+#include <spsc_unrolled_channel.hpp>
+
+#include "bench_utils.hpp"
+
+namespace {
+
+constexpr size_t kElementCount = 2'000'000;
+constexpr size_t kBatchSize = 1024;
+
+
+/* What the channel replaces: unrolled_list behind a single mutex */
+class LockedUnrolledQueue {
+  public:
+    bool try_push(uint64_t value) {
+        std::lock_guard lock(mutex_m);
+        list_m.push_back(value);
+        return true;
+    };
+
+
+    bool try_pop(uint64_t& value) {
+        std::lock_guard lock(mutex_m);
+        if (list_m.empty()) {
+            return false;
+        }
+        value = list_m.front();
+        list_m.pop_front();
+        return true;
+    };
+
+
+    void flush() {  };
+
+  private:
+    std::mutex mutex_m;
+    unrolled_list<uint64_t, 256> list_m;
+};
+
+
+template<typename ChannelType>
+double RunOneByOne(ChannelType& channel) {
+    uint64_t checksum = 0;
+
+    double milliseconds = labwork7::bench::MeasureMs([&] {
+        std::thread producer([&] {
+            for (uint64_t ind = 0; ind != kElementCount;) {
+                if (channel.try_push(ind)) {
+                    ++ind;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+            channel.flush();
+        });
+
+        uint64_t value = 0;
+        for (size_t popped = 0; popped != kElementCount;) {
+            if (channel.try_pop(value)) {
+                checksum += value;
+                ++popped;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+        producer.join();
+    });
+
+    labwork7::bench::DoNotOptimize(checksum);
+    return milliseconds;
+}
+
+
+template<typename ChannelType>
+double RunBatches(ChannelType& channel) {
+    uint64_t checksum = 0;
+
+    double milliseconds = labwork7::bench::MeasureMs([&] {
+        std::thread producer([&] {
+            std::vector<uint64_t> batch(kBatchSize);
+            for (uint64_t ind = 0; ind != kElementCount;) {
+                size_t count = std::min(kBatchSize, kElementCount - ind);
+                std::iota(batch.begin(), batch.begin() + count, ind);
+                size_t pushed = channel.push_batch(batch.begin(), batch.begin() + count) - batch.begin();
+                if (pushed == 0) {
+                    std::this_thread::yield();
+                }
+                ind += pushed;
+            }
+            channel.flush();
+        });
+
+        std::vector<uint64_t> batch(kBatchSize);
+        for (size_t popped = 0; popped != kElementCount;) {
+            size_t count = channel.pop_batch(batch.begin(), std::min(kBatchSize, kElementCount - popped));
+            if (count == 0) {
+                std::this_thread::yield();
+            }
+            checksum += std::accumulate(batch.begin(), batch.begin() + count, uint64_t{0});
+            popped += count;
+        }
+        producer.join();
+    });
+
+    labwork7::bench::DoNotOptimize(checksum);
+    return milliseconds;
+}
+
+} // namespace
+
+
+int main() {
+    using namespace labwork7::bench;
+
+    PrintHeader("one producer, one consumer, element by element");
+    {
+        LockedUnrolledQueue queue;
+        PrintRow("unrolled_list behind std::mutex", kElementCount, RunOneByOne(queue));
+    }
+    {
+        spsc_unrolled_channel<uint64_t, 256> channel;
+        PrintRow("spsc_unrolled_channel<uint64_t, 256>", kElementCount, RunOneByOne(channel));
+    }
+    {
+        spsc_unrolled_channel<uint64_t, 256> channel(64);
+        PrintRow("spsc_unrolled_channel<uint64_t, 256>, 64 chuncks", kElementCount, RunOneByOne(channel));
+    }
+
+    PrintHeader("one producer, one consumer, batches of " + std::to_string(kBatchSize));
+    {
+        spsc_unrolled_channel<uint64_t, 256> channel;
+        PrintRow("spsc_unrolled_channel<uint64_t, 256>", kElementCount, RunBatches(channel));
+    }
+    {
+        spsc_unrolled_channel<uint64_t, 1024> channel(64);
+        PrintRow("spsc_unrolled_channel<uint64_t, 1024>, 64 chuncks", kElementCount, RunBatches(channel));
+    }
+
+    return 0;
+}
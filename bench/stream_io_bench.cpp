@@ -0,0 +1,133 @@
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <unrolled_list.hpp>
+#include <unrolled_list_io.hpp>
+
+#include "bench_utils.hpp"
+
+namespace {
+
+constexpr size_t kListSize = 10'000'000;
+constexpr size_t kBufferBytes = size_t{1} << 20;
+
+
+/* What an ingest does without append_from_fd: read() into a buffer, then a push_back per element */
+template<typename ListType>
+double RunBufferedPushBack(const std::filesystem::path& path) {
+    ListType list;
+    double milliseconds = labwork7::bench::MeasureMs([&] {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        std::vector<uint64_t> buffer(kBufferBytes / sizeof(uint64_t));
+
+        ssize_t read_bytes;
+        while ((read_bytes = ::read(fd, buffer.data(), kBufferBytes)) > 0) {
+            for (size_t ind = 0; ind != static_cast<size_t>(read_bytes) / sizeof(uint64_t); ++ind) {
+                list.push_back(buffer[ind]);
+            }
+        }
+        ::close(fd);
+    });
+
+    labwork7::bench::DoNotOptimize(list.back());
+    return milliseconds;
+}
+
+
+template<typename ListType>
+double RunAppendFromFd(const std::filesystem::path& path) {
+    ListType list;
+    double milliseconds = labwork7::bench::MeasureMs([&] {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        labwork7::append_from_fd(list, fd);
+        ::close(fd);
+    });
+
+    labwork7::bench::DoNotOptimize(list.back());
+    return milliseconds;
+}
+
+
+template<typename ListType>
+double RunAppendFromIstream(const std::filesystem::path& path) {
+    ListType list;
+    double milliseconds = labwork7::bench::MeasureMs([&] {
+        std::ifstream input(path, std::ios::binary);
+        labwork7::append_from(list, input, labwork7::stream_format::binary);
+    });
+
+    labwork7::bench::DoNotOptimize(list.back());
+    return milliseconds;
+}
+
+
+/* What a dump does without write_to: elements copied into a buffer, a write() per buffer */
+template<typename ListType>
+double RunBufferedWrite(const ListType& list, const std::filesystem::path& path) {
+    return labwork7::bench::MeasureMs([&] {
+        int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        std::vector<uint64_t> buffer;
+        buffer.reserve(kBufferBytes / sizeof(uint64_t));
+
+        for (uint64_t value : list) {
+            buffer.push_back(value);
+            if (buffer.size() == buffer.capacity()) {
+                labwork7::bench::DoNotOptimize(::write(fd, buffer.data(), buffer.size() * sizeof(uint64_t)));
+                buffer.clear();
+            }
+        }
+        labwork7::bench::DoNotOptimize(::write(fd, buffer.data(), buffer.size() * sizeof(uint64_t)));
+        ::close(fd);
+    });
+}
+
+
+template<typename ListType>
+double RunWriteTo(const ListType& list, const std::filesystem::path& path) {
+    return labwork7::bench::MeasureMs([&] {
+        int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        labwork7::write_to(list, fd);
+        ::close(fd);
+    });
+}
+
+
+template<size_t kChunckSize>
+void RunForChunckSize() {
+    using namespace labwork7::bench;
+    using list_t = unrolled_list<uint64_t, kChunckSize>;
+
+    std::filesystem::path path = TempPath("stream_io");
+    list_t list;
+    for (uint64_t value = 0; value != kListSize; ++value) {
+        list.push_back(value);
+    }
+
+    PrintHeader(std::to_string(kListSize) + " uint64_t, ChunckSize " + std::to_string(kChunckSize));
+    PrintRow("write: buffer + write()", kListSize, RunBufferedWrite(list, path));
+    PrintRow("write: write_to, writev", kListSize, RunWriteTo(list, path));
+    /* the first touch of the heap pages is left out of the rows */
+    RunAppendFromFd<list_t>(path);
+
+    PrintRow("read: read() + push_back", kListSize, RunBufferedPushBack<list_t>(path));
+    PrintRow("read: append_from_fd, readv", kListSize, RunAppendFromFd<list_t>(path));
+    PrintRow("read: append_from ifstream, binary", kListSize, RunAppendFromIstream<list_t>(path));
+
+    std::filesystem::remove(path);
+}
+
+} // namespace
+
+
+int main() {
+    RunForChunckSize<64>();
+    RunForChunckSize<512>();
+    return 0;
+}
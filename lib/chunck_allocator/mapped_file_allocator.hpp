@@ -0,0 +1,297 @@
+#ifndef _MAPPED_FILE_ALLOCATOR_HPP_
+#define _MAPPED_FILE_ALLOCATOR_HPP_
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace labwork7 {
+
+namespace chunck_allocator {
+
+enum class access_pattern {
+    normal,
+    sequential,
+    random,
+};
+
+
+namespace details {
+
+/*
+    Memory carved out of a file, the page cache backs it and writes the cold pages back to the file.
+
+    One range of reserve_bytes address space is reserved up front and the file is mapped into it
+    with MAP_SHARED | MAP_FIXED piece by piece as ftruncate grows it, so the addresses never move.
+    Blocks are bumped off the end of the file, freed blocks are kept in free lists by their size and alignment.
+*/
+class MappedFileArena {
+  public:
+    static constexpr size_t kMinGrowthBytes = size_t{64} << 20;
+    static constexpr size_t kBlockAlignment = 64;
+    static constexpr size_t kFreeListCount = 16;
+
+    struct FreeList {
+        size_t block_bytes_m = 0;
+        size_t alignment_m = 0;
+        void* head_ptr_m = nullptr;
+    };
+
+  public:
+    MappedFileArena(const std::filesystem::path& directory, size_t reserve_bytes) : reserve_bytes_m(reserve_bytes) {
+        std::string file_template = (directory / "unrolled_list_arena_XXXXXX").string();
+        fd_m = ::mkstemp(file_template.data());
+        if (fd_m == -1) {
+            throw std::system_error{errno, std::generic_category(), "MappedFileArena: cannot create a file in " + directory.string()};
+        }
+        /* the file lives only as long as the mapping */
+        ::unlink(file_template.c_str());
+
+        void* reserved = ::mmap(nullptr, reserve_bytes_m, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (reserved == MAP_FAILED) {
+            int error = errno;
+            ::close(fd_m);
+            throw std::system_error{error, std::generic_category(), "MappedFileArena: cannot reserve address space"};
+        }
+        base_ptr_m = static_cast<std::byte*>(reserved);
+    };
+
+    MappedFileArena(const MappedFileArena&) = delete;
+    MappedFileArena& operator=(const MappedFileArena&) = delete;
+
+    ~MappedFileArena() noexcept {
+        ::munmap(base_ptr_m, reserve_bytes_m);
+        ::close(fd_m);
+    };
+
+  public:
+    void* Allocate(size_t bytes, size_t alignment) {
+        size_t block_bytes = BlockBytes(bytes);
+        alignment = std::max(alignment, kBlockAlignment);
+        std::lock_guard lock(mutex_m);
+
+        FreeList* free_list = FindFreeList(block_bytes, alignment);
+        if (free_list && free_list->head_ptr_m) {
+            void* block = free_list->head_ptr_m;
+            free_list->head_ptr_m = *static_cast<void**>(block);
+            return block;
+        }
+
+        size_t offset = (used_bytes_m + alignment - 1) / alignment * alignment;
+        if (offset > reserve_bytes_m || block_bytes > reserve_bytes_m - offset) {
+            throw std::bad_alloc{};
+        }
+        if (offset + block_bytes > mapped_bytes_m) {
+            Grow(offset + block_bytes);
+        }
+
+        used_bytes_m = offset + block_bytes;
+        return base_ptr_m + offset;
+    };
+
+    /* Blocks of a size and alignment beyond kFreeListCount different ones are not reused */
+    void Deallocate(void* block, size_t bytes, size_t alignment) noexcept {
+        size_t block_bytes = BlockBytes(bytes);
+        alignment = std::max(alignment, kBlockAlignment);
+        std::lock_guard lock(mutex_m);
+
+        FreeList* free_list = FindFreeList(block_bytes, alignment);
+        if (!free_list) {
+            free_list = std::find_if(std::begin(free_lists_m), std::end(free_lists_m),
+                [](const FreeList& value) { return !value.block_bytes_m; });
+            if (free_list == std::end(free_lists_m)) {
+                return;
+            }
+            free_list->block_bytes_m = block_bytes;
+            free_list->alignment_m = alignment;
+        }
+
+        *static_cast<void**>(block) = free_list->head_ptr_m;
+        free_list->head_ptr_m = block;
+    };
+
+    /* Applies to the mapped part and to everything mapped later */
+    void Advise(access_pattern pattern) noexcept {
+        std::lock_guard lock(mutex_m);
+        pattern_m = pattern;
+        if (mapped_bytes_m) {
+            ::madvise(base_ptr_m, mapped_bytes_m, Advice(pattern));
+        }
+    };
+
+    bool Owns(const void* ptr) const noexcept {
+        const std::byte* byte_ptr = static_cast<const std::byte*>(ptr);
+        return byte_ptr >= base_ptr_m && byte_ptr < base_ptr_m + reserve_bytes_m;
+    };
+
+    size_t MappedBytes() const noexcept {
+        std::lock_guard lock(mutex_m);
+        return mapped_bytes_m;
+    };
+
+  private:
+    static size_t BlockBytes(size_t bytes) noexcept {
+        return std::max((bytes + kBlockAlignment - 1) / kBlockAlignment * kBlockAlignment, kBlockAlignment);
+    };
+
+    FreeList* FindFreeList(size_t block_bytes, size_t alignment) noexcept {
+        for (FreeList& free_list : free_lists_m) {
+            if (free_list.block_bytes_m == block_bytes && free_list.alignment_m == alignment) {
+                return &free_list;
+            }
+        }
+        return nullptr;
+    };
+
+    static int Advice(access_pattern pattern) noexcept {
+        switch (pattern) {
+          case access_pattern::sequential:
+            return MADV_SEQUENTIAL;
+          case access_pattern::random:
+            return MADV_RANDOM;
+          default:
+            return MADV_NORMAL;
+        }
+    };
+
+    /* Doubles the file, at least up to needed_bytes */
+    void Grow(size_t needed_bytes) {
+        size_t page_bytes = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        size_t new_bytes = std::max({needed_bytes, 2 * mapped_bytes_m, kMinGrowthBytes});
+        new_bytes = std::min((new_bytes + page_bytes - 1) / page_bytes * page_bytes, reserve_bytes_m);
+
+        if (::ftruncate(fd_m, static_cast<off_t>(new_bytes)) == -1) {
+            throw std::bad_alloc{};
+        }
+
+        void* mapped = ::mmap(base_ptr_m + mapped_bytes_m, new_bytes - mapped_bytes_m, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_FIXED, fd_m, static_cast<off_t>(mapped_bytes_m));
+        if (mapped == MAP_FAILED) {
+            [[maybe_unused]] int result = ::ftruncate(fd_m, static_cast<off_t>(mapped_bytes_m));
+            throw std::bad_alloc{};
+        }
+
+        ::madvise(mapped, new_bytes - mapped_bytes_m, Advice(pattern_m));
+        mapped_bytes_m = new_bytes;
+    };
+
+  private:
+    int fd_m = -1;
+    std::byte* base_ptr_m = nullptr;
+    size_t reserve_bytes_m = 0;
+    size_t mapped_bytes_m = 0;
+    size_t used_bytes_m = 0;
+    access_pattern pattern_m = access_pattern::sequential;
+
+    /* freed blocks of every size and alignment, linked through their first bytes */
+    FreeList free_lists_m[kFreeListCount];
+    mutable std::mutex mutex_m;
+};
+
+} // namespace details
+
+
+/*
+    Allocator which takes the memory from a growing file mapped with MAP_SHARED, so a container larger
+    than the memory of the machine is kept in the page cache and swapped to the file by the kernel.
+    Meant for UnrolledListNodeChunck nodes: every node is one block, freed nodes are reused.
+
+    Copies and rebinds share the file, it is removed with the last of them.
+    A default constructed allocator has no file and only constructs and destroys objects,
+    as unrolled_list does with the element allocator.
+*/
+template<typename DataType>
+class MappedFileAllocator {
+  public:
+    using value_type = DataType;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+
+    static constexpr size_t kDefaultReserveBytes = size_t{1} << 40;
+
+    template<typename AnotherDataType>
+    struct rebind {
+        using other = MappedFileAllocator<AnotherDataType>;
+    };
+
+  public:
+    MappedFileAllocator() noexcept = default;
+
+    explicit MappedFileAllocator(const std::filesystem::path& directory, size_t reserve_bytes = kDefaultReserveBytes)
+        : arena_m(std::make_shared<details::MappedFileArena>(directory, reserve_bytes)) {  };
+
+    template<typename AnotherDataType>
+    MappedFileAllocator(const MappedFileAllocator<AnotherDataType>& value) noexcept : arena_m(value.arena_m) {  };
+
+  public:
+    DataType* allocate(size_type count) {
+        if (!arena_m) {
+            throw std::logic_error{"MappedFileAllocator: allocator has no file, construct it with a directory"};
+        }
+        if (count > std::numeric_limits<size_type>::max() / sizeof(DataType)) {
+            throw std::bad_array_new_length{};
+        }
+        return static_cast<DataType*>(arena_m->Allocate(count * sizeof(DataType), alignof(DataType)));
+    };
+
+    void deallocate(DataType* ptr, size_type count) noexcept {
+        if (!arena_m) {
+            return;
+        }
+        arena_m->Deallocate(ptr, count * sizeof(DataType), alignof(DataType));
+    };
+
+  public:
+    /* madvise hint for the whole file, sequential by default */
+    void advise(access_pattern pattern) const noexcept {
+        if (arena_m) {
+            arena_m->Advise(pattern);
+        }
+    };
+
+    bool owns(const void* ptr) const noexcept {
+        return arena_m && arena_m->Owns(ptr);
+    };
+
+    size_type mapped_bytes() const noexcept {
+        return arena_m ? arena_m->MappedBytes() : 0;
+    };
+
+  public:
+    template<typename AnotherDataType>
+    bool operator==(const MappedFileAllocator<AnotherDataType>& value) const noexcept {
+        return arena_m == value.arena_m;
+    };
+
+  private:
+    template<typename AnotherDataType>
+    friend class MappedFileAllocator;
+
+    std::shared_ptr<details::MappedFileArena> arena_m;
+};
+
+} // namespace chunck_allocator
+
+} // namespace labwork7
+
+#endif // _MAPPED_FILE_ALLOCATOR_HPP_
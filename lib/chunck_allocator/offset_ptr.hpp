@@ -0,0 +1,156 @@
+#ifndef _OFFSET_PTR_HPP_
+#define _OFFSET_PTR_HPP_
+
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+namespace labwork7 {
+
+namespace chunck_allocator {
+
+/*
+    Pointer which keeps the distance from itself to the pointee instead of an address,
+    so a structure of offset_ptr stays valid in memory mapped at different addresses by different processes.
+
+    Copies recompute the distance from their own place. The distance 0 stands for nullptr,
+    so an offset_ptr cannot point to itself.
+*/
+template<typename DataType>
+class offset_ptr {
+  public:
+    using element_type = DataType;
+    using value_type = std::remove_cv_t<DataType>;
+    using pointer = DataType*;
+    using reference = std::add_lvalue_reference_t<DataType>;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::random_access_iterator_tag;
+    using iterator_concept = std::random_access_iterator_tag;
+
+    template<typename AnotherDataType>
+    using rebind = offset_ptr<AnotherDataType>;
+
+  public:
+    offset_ptr() noexcept = default;
+    offset_ptr(std::nullptr_t) noexcept {  };
+    offset_ptr(DataType* ptr) noexcept { Set(ptr); };
+
+    offset_ptr(const offset_ptr& value) noexcept { Set(value.get()); };
+
+    template<typename AnotherDataType>
+      requires std::convertible_to<AnotherDataType*, DataType*>
+    offset_ptr(const offset_ptr<AnotherDataType>& value) noexcept { Set(value.get()); };
+
+    /* static_cast from offset_ptr<void> and down the class hierarchy, as with raw pointers */
+    template<typename AnotherDataType>
+      requires (!std::convertible_to<AnotherDataType*, DataType*>)
+        && requires (AnotherDataType* ptr) { static_cast<DataType*>(ptr); }
+    explicit offset_ptr(const offset_ptr<AnotherDataType>& value) noexcept { Set(static_cast<DataType*>(value.get())); };
+
+    offset_ptr& operator=(const offset_ptr& value) noexcept {
+        Set(value.get());
+        return *this;
+    };
+
+    offset_ptr& operator=(DataType* ptr) noexcept {
+        Set(ptr);
+        return *this;
+    };
+
+    offset_ptr& operator=(std::nullptr_t) noexcept {
+        offset_m = 0;
+        return *this;
+    };
+
+  public:
+    DataType* get() const noexcept {
+        if (!offset_m) {
+            return nullptr;
+        }
+        return reinterpret_cast<DataType*>(reinterpret_cast<uintptr_t>(this) + offset_m);
+    };
+
+    explicit operator bool() const noexcept { return offset_m; };
+
+    reference operator*() const noexcept requires (!std::is_void_v<DataType>) { return *get(); };
+    DataType* operator->() const noexcept { return get(); };
+
+    reference operator[](difference_type index) const noexcept requires (!std::is_void_v<DataType>) {
+        return get()[index];
+    };
+
+    template<typename ElementType = DataType>
+      requires (!std::is_void_v<ElementType>)
+    static offset_ptr pointer_to(ElementType& value) noexcept {
+        return offset_ptr{std::addressof(value)};
+    };
+
+  public:
+    offset_ptr& operator+=(difference_type count) noexcept requires (!std::is_void_v<DataType>) {
+        Set(get() + count);
+        return *this;
+    };
+
+    offset_ptr& operator-=(difference_type count) noexcept requires (!std::is_void_v<DataType>) {
+        Set(get() - count);
+        return *this;
+    };
+
+    offset_ptr& operator++() noexcept requires (!std::is_void_v<DataType>) { return *this += 1; };
+    offset_ptr& operator--() noexcept requires (!std::is_void_v<DataType>) { return *this -= 1; };
+
+    offset_ptr operator++(int) noexcept requires (!std::is_void_v<DataType>) {
+        offset_ptr result = *this;
+        ++(*this);
+        return result;
+    };
+
+    offset_ptr operator--(int) noexcept requires (!std::is_void_v<DataType>) {
+        offset_ptr result = *this;
+        --(*this);
+        return result;
+    };
+
+    friend offset_ptr operator+(offset_ptr value, difference_type count) noexcept requires (!std::is_void_v<DataType>) {
+        return value += count;
+    };
+
+    friend offset_ptr operator+(difference_type count, offset_ptr value) noexcept requires (!std::is_void_v<DataType>) {
+        return value += count;
+    };
+
+    friend offset_ptr operator-(offset_ptr value, difference_type count) noexcept requires (!std::is_void_v<DataType>) {
+        return value -= count;
+    };
+
+    friend difference_type operator-(const offset_ptr& lhs, const offset_ptr& rhs) noexcept
+      requires (!std::is_void_v<DataType>) {
+        return lhs.get() - rhs.get();
+    };
+
+  public:
+    friend bool operator==(const offset_ptr& lhs, const offset_ptr& rhs) noexcept { return lhs.get() == rhs.get(); };
+    friend bool operator==(const offset_ptr& lhs, std::nullptr_t) noexcept { return !lhs.offset_m; };
+
+    friend std::strong_ordering operator<=>(const offset_ptr& lhs, const offset_ptr& rhs) noexcept {
+        return std::compare_three_way{}(lhs.get(), rhs.get());
+    };
+
+  private:
+    void Set(DataType* ptr) noexcept {
+        offset_m = ptr ? reinterpret_cast<uintptr_t>(ptr) - reinterpret_cast<uintptr_t>(this) : 0;
+    };
+
+  private:
+    uintptr_t offset_m = 0;
+};
+
+} // namespace chunck_allocator
+
+} // namespace labwork7
+
+#endif // _OFFSET_PTR_HPP_
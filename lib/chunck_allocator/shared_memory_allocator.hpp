@@ -0,0 +1,341 @@
+#ifndef _SHARED_MEMORY_ALLOCATOR_HPP_
+#define _SHARED_MEMORY_ALLOCATOR_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "offset_ptr.hpp"
+
+namespace labwork7 {
+
+namespace chunck_allocator {
+
+namespace details {
+
+/*
+    Start of a shared memory segment, everything in the segment is addressed by its offset from here.
+    Blocks are bumped off the end of the used part, freed blocks are kept in free lists by their size,
+    linked through the offsets in their first bytes. The lock is a spinlock which yields after a few attempts,
+    lock-free atomics work across processes.
+*/
+struct SharedSegmentHeader {
+    static constexpr char kMagic[8] = {'U', 'L', 'S', 'H', 'M', '\0', '\0', '\0'};
+    static constexpr size_t kBlockAlignment = 64;
+    static constexpr size_t kFreeListCount = 16;
+
+    struct FreeList {
+        uint64_t block_bytes_m = 0;
+        uint64_t head_offset_m = 0;
+    };
+
+    char magic_m[8];
+    uint64_t segment_bytes_m = 0;
+    uint64_t used_bytes_m = 0;
+    uint64_t root_offset_m = 0;
+    uint64_t root_bytes_m = 0;
+    std::atomic<uint32_t> lock_m = 0;
+    FreeList free_lists_m[kFreeListCount];
+
+    static_assert(std::atomic<uint32_t>::is_always_lock_free, "the segment lock has to be lock-free to be shared");
+
+
+    explicit SharedSegmentHeader(size_t segment_bytes) noexcept
+        : segment_bytes_m(segment_bytes),
+          used_bytes_m((sizeof(SharedSegmentHeader) + kBlockAlignment - 1) / kBlockAlignment * kBlockAlignment) {
+        std::memcpy(magic_m, kMagic, sizeof(kMagic));
+    };
+
+    std::byte* Base() noexcept { return reinterpret_cast<std::byte*>(this); };
+
+    void Lock() noexcept {
+        for (size_t attempt = 0;; ++attempt) {
+            if (!lock_m.load(std::memory_order_relaxed) && !lock_m.exchange(1, std::memory_order_acquire)) {
+                return;
+            }
+            if (attempt > 64) {
+                std::this_thread::yield();
+            }
+        }
+    };
+
+    void Unlock() noexcept { lock_m.store(0, std::memory_order_release); };
+
+    void* Allocate(size_t bytes, size_t alignment) {
+        size_t block_bytes = BlockBytes(bytes);
+        alignment = std::max(alignment, kBlockAlignment);
+        Lock();
+
+        FreeList* free_list = FindFreeList(block_bytes);
+        if (free_list && free_list->head_offset_m && alignment == kBlockAlignment) {
+            std::byte* block = Base() + free_list->head_offset_m;
+            std::memcpy(&free_list->head_offset_m, block, sizeof(uint64_t));
+            Unlock();
+            return block;
+        }
+
+        size_t offset = (used_bytes_m + alignment - 1) / alignment * alignment;
+        if (offset > segment_bytes_m || block_bytes > segment_bytes_m - offset) {
+            Unlock();
+            throw std::bad_alloc{};
+        }
+
+        used_bytes_m = offset + block_bytes;
+        Unlock();
+        return Base() + offset;
+    };
+
+    /* Blocks of a size beyond kFreeListCount different sizes are not reused */
+    void Deallocate(void* block, size_t bytes, size_t alignment) noexcept {
+        size_t block_bytes = BlockBytes(bytes);
+        if (std::max(alignment, kBlockAlignment) != kBlockAlignment) {
+            return;
+        }
+        Lock();
+
+        FreeList* free_list = FindFreeList(block_bytes);
+        if (!free_list) {
+            free_list = std::find_if(std::begin(free_lists_m), std::end(free_lists_m),
+                [](const FreeList& value) { return !value.block_bytes_m; });
+            if (free_list == std::end(free_lists_m)) {
+                Unlock();
+                return;
+            }
+            free_list->block_bytes_m = block_bytes;
+        }
+
+        std::memcpy(block, &free_list->head_offset_m, sizeof(uint64_t));
+        free_list->head_offset_m = static_cast<std::byte*>(block) - Base();
+        Unlock();
+    };
+
+  private:
+    static size_t BlockBytes(size_t bytes) noexcept {
+        return std::max((bytes + kBlockAlignment - 1) / kBlockAlignment * kBlockAlignment, kBlockAlignment);
+    };
+
+    FreeList* FindFreeList(size_t block_bytes) noexcept {
+        for (FreeList& free_list : free_lists_m) {
+            if (free_list.block_bytes_m == block_bytes) {
+                return &free_list;
+            }
+        }
+        return nullptr;
+    };
+};
+
+} // namespace details
+
+
+/*
+    Allocator of a shared memory segment, its pointer is offset_ptr.
+    A container which lives in the segment together with its allocator can be used by every process
+    which maps the segment, whatever the address of the mapping is.
+
+    A default constructed allocator has no segment and only constructs and destroys objects,
+    as unrolled_list does with the element allocator.
+*/
+template<typename DataType>
+class SharedMemoryAllocator {
+  public:
+    using value_type = DataType;
+    using pointer = offset_ptr<DataType>;
+    using const_pointer = offset_ptr<const DataType>;
+    using void_pointer = offset_ptr<void>;
+    using const_void_pointer = offset_ptr<const void>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+
+    template<typename AnotherDataType>
+    struct rebind {
+        using other = SharedMemoryAllocator<AnotherDataType>;
+    };
+
+  public:
+    SharedMemoryAllocator() noexcept = default;
+
+    explicit SharedMemoryAllocator(details::SharedSegmentHeader* header) noexcept : header_m(header) {  };
+
+    template<typename AnotherDataType>
+    SharedMemoryAllocator(const SharedMemoryAllocator<AnotherDataType>& value) noexcept : header_m(value.header_m) {  };
+
+  public:
+    pointer allocate(size_type count) {
+        if (!header_m) {
+            throw std::logic_error{"SharedMemoryAllocator: allocator has no segment, take it from SharedMemorySegment"};
+        }
+        if (count > std::numeric_limits<size_type>::max() / sizeof(DataType)) {
+            throw std::bad_array_new_length{};
+        }
+        return pointer{static_cast<DataType*>(header_m->Allocate(count * sizeof(DataType), alignof(DataType)))};
+    };
+
+    void deallocate(pointer ptr, size_type count) noexcept {
+        if (!header_m) {
+            return;
+        }
+        header_m->Deallocate(ptr.get(), count * sizeof(DataType), alignof(DataType));
+    };
+
+  public:
+    template<typename AnotherDataType>
+    bool operator==(const SharedMemoryAllocator<AnotherDataType>& value) const noexcept {
+        return header_m == value.header_m;
+    };
+
+  private:
+    template<typename AnotherDataType>
+    friend class SharedMemoryAllocator;
+
+    offset_ptr<details::SharedSegmentHeader> header_m;
+};
+
+
+/*
+    POSIX shared memory object of a fixed size mapped into the process.
+    The creator constructs the root object, e.g. an unrolled_list with get_allocator(), the other processes find it.
+    The processes agree on their own when the root is written, the segment only guards its allocations.
+*/
+class SharedMemorySegment {
+  public:
+    /* Creates the object, fails if it exists */
+    SharedMemorySegment(const std::string& name, size_t segment_bytes) : name_m(name) {
+        fd_m = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+        if (fd_m == -1) {
+            throw std::system_error{errno, std::generic_category(), "SharedMemorySegment: cannot create " + name};
+        }
+        if (::ftruncate(fd_m, static_cast<off_t>(segment_bytes)) == -1) {
+            int error = errno;
+            ::close(fd_m);
+            ::shm_unlink(name.c_str());
+            throw std::system_error{error, std::generic_category(), "SharedMemorySegment: cannot resize " + name};
+        }
+
+        try {
+            Map(segment_bytes);
+        } catch(...) {
+            ::shm_unlink(name.c_str());
+            throw;
+        }
+        new (header_m) details::SharedSegmentHeader(segment_bytes);
+    };
+
+    /* Opens the object created by another SharedMemorySegment */
+    explicit SharedMemorySegment(const std::string& name) : name_m(name) {
+        fd_m = ::shm_open(name.c_str(), O_RDWR, 0600);
+        if (fd_m == -1) {
+            throw std::system_error{errno, std::generic_category(), "SharedMemorySegment: cannot open " + name};
+        }
+
+        struct stat file_stat;
+        if (::fstat(fd_m, &file_stat) == -1) {
+            int error = errno;
+            ::close(fd_m);
+            throw std::system_error{error, std::generic_category(), "SharedMemorySegment: cannot stat " + name};
+        }
+
+        Map(static_cast<size_t>(file_stat.st_size));
+        if (segment_bytes_m < sizeof(details::SharedSegmentHeader)
+            || std::memcmp(header_m->magic_m, details::SharedSegmentHeader::kMagic, sizeof(header_m->magic_m)) != 0) {
+            Unmap();
+            throw std::runtime_error{"SharedMemorySegment: " + name + " is not a segment"};
+        }
+    };
+
+    SharedMemorySegment(const SharedMemorySegment&) = delete;
+    SharedMemorySegment& operator=(const SharedMemorySegment&) = delete;
+
+    ~SharedMemorySegment() noexcept {
+        Unmap();
+    };
+
+  public:
+    template<typename DataType = std::byte>
+    SharedMemoryAllocator<DataType> get_allocator() const noexcept {
+        return SharedMemoryAllocator<DataType>{header_m};
+    };
+
+    /* Constructs the root object in the segment, the previous root is forgotten, not destroyed */
+    template<typename RootType, typename... ArgsTs>
+    RootType& construct(ArgsTs&&... args) {
+        void* block = header_m->Allocate(sizeof(RootType), alignof(RootType));
+        RootType* root = new (block) RootType(std::forward<ArgsTs>(args)...);
+
+        header_m->root_bytes_m = sizeof(RootType);
+        std::atomic_ref<uint64_t>(header_m->root_offset_m).store(
+            reinterpret_cast<std::byte*>(root) - header_m->Base(), std::memory_order_release);
+        return *root;
+    };
+
+    /* The root object or nullptr, if it is not constructed yet */
+    template<typename RootType>
+    RootType* find() const {
+        uint64_t root_offset = std::atomic_ref<uint64_t>(header_m->root_offset_m).load(std::memory_order_acquire);
+        if (!root_offset) {
+            return nullptr;
+        }
+        if (header_m->root_bytes_m != sizeof(RootType)) {
+            throw std::runtime_error{"SharedMemorySegment: the root of " + name_m + " is of another type"};
+        }
+        return std::launder(reinterpret_cast<RootType*>(header_m->Base() + root_offset));
+    };
+
+    void* data() const noexcept { return header_m; };
+    size_t size() const noexcept { return segment_bytes_m; };
+
+    /* Removes the name, the memory lives until the last process unmaps it */
+    static void remove(const std::string& name) noexcept {
+        ::shm_unlink(name.c_str());
+    };
+
+  private:
+    void Map(size_t segment_bytes) {
+        void* mapped = ::mmap(nullptr, segment_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd_m, 0);
+        if (mapped == MAP_FAILED) {
+            int error = errno;
+            ::close(fd_m);
+            throw std::system_error{error, std::generic_category(), "SharedMemorySegment: cannot map " + name_m};
+        }
+
+        header_m = static_cast<details::SharedSegmentHeader*>(mapped);
+        segment_bytes_m = segment_bytes;
+    };
+
+    void Unmap() noexcept {
+        ::munmap(header_m, segment_bytes_m);
+        ::close(fd_m);
+    };
+
+  private:
+    std::string name_m;
+    int fd_m = -1;
+    details::SharedSegmentHeader* header_m = nullptr;
+    size_t segment_bytes_m = 0;
+};
+
+} // namespace chunck_allocator
+
+} // namespace labwork7
+
+#endif // _SHARED_MEMORY_ALLOCATOR_HPP_
@@ -0,0 +1,241 @@
+#ifndef _UNROLLED_LIST_ALGORITHM_HPP_
+#define _UNROLLED_LIST_ALGORITHM_HPP_
+
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <utility>
+
+#include "segmented_iterator.hpp"
+#include "details/simd_kernels.hpp"
+
+namespace labwork7 {
+
+/*
+    Chunck-aware versions of the standard algorithms.
+    They are found by ADL for unrolled_list iterators and run a contiguous loop per chunck
+    instead of going through details::Iterator::operator++ for every element.
+    find and count over int32_t, int64_t, float and double run the vectorized kernels
+    from details/simd_kernels.hpp on every chunck, accumulate and min/max_element do so over int32_t
+    and int64_t only. Floating point ranges take the scalar loop for them, see details/simd_kernels.hpp.
+*/
+
+namespace details {
+
+template<typename ItrType, typename ValueType>
+concept simd_searchable = simd::kernel_type<std::iter_value_t<ItrType>>
+    && std::same_as<ValueType, std::iter_value_t<ItrType>>;
+
+template<typename ItrType>
+concept simd_ordered = simd::kernel_type<std::iter_value_t<ItrType>> && std::integral<std::iter_value_t<ItrType>>;
+
+} // namespace details
+
+
+template<segmented_iterator ItrType, typename FuncType>
+FuncType for_each(ItrType first, ItrType last, FuncType func) {
+    details::SegmentedWalk(first, last, [&](auto local_first, auto local_last) {
+        for (; local_first != local_last; ++local_first) {
+            func(*local_first);
+        }
+        return local_last;
+    });
+    return func;
+}
+
+
+template<segmented_iterator ItrType, typename ValueType>
+ItrType find(ItrType first, ItrType last, const ValueType& value) {
+    if constexpr (details::simd_searchable<ItrType, ValueType>) {
+        const auto& kernels = details::simd::Kernels<ValueType>();
+
+        return details::SegmentedWalk(first, last, [&](auto local_first, auto local_last) {
+            return local_first + (kernels.find(local_first, local_last, value) - local_first);
+        });
+    }
+
+    return details::SegmentedWalk(first, last, [&](auto local_first, auto local_last) {
+        return std::find(local_first, local_last, value);
+    });
+}
+
+
+template<segmented_iterator ItrType, typename ValueType>
+std::iter_difference_t<ItrType> count(ItrType first, ItrType last, const ValueType& value) {
+    std::iter_difference_t<ItrType> result = 0;
+
+    if constexpr (details::simd_searchable<ItrType, ValueType>) {
+        const auto& kernels = details::simd::Kernels<ValueType>();
+
+        details::SegmentedWalk(first, last, [&](auto local_first, auto local_last) {
+            result += kernels.count(local_first, local_last, value);
+            return local_last;
+        });
+        return result;
+    }
+
+    details::SegmentedWalk(first, last, [&](auto local_first, auto local_last) {
+        result += std::count(local_first, local_last, value);
+        return local_last;
+    });
+    return result;
+}
+
+
+template<segmented_iterator ItrType, typename ValueType, typename BinaryOperationType>
+ValueType accumulate(ItrType first, ItrType last, ValueType init, BinaryOperationType operation) {
+    details::SegmentedWalk(first, last, [&](auto local_first, auto local_last) {
+        init = std::accumulate(local_first, local_last, std::move(init), operation);
+        return local_last;
+    });
+    return init;
+}
+
+
+template<segmented_iterator ItrType, typename ValueType>
+ValueType accumulate(ItrType first, ItrType last, ValueType init) {
+    using element_t = std::iter_value_t<ItrType>;
+
+    if constexpr (details::simd_ordered<ItrType>
+      && (std::same_as<ValueType, element_t> || std::same_as<ValueType, int64_t>)) {
+        const auto& kernels = details::simd::Kernels<element_t>();
+
+        details::SegmentedWalk(first, last, [&](auto local_first, auto local_last) {
+            if constexpr (std::same_as<ValueType, element_t>) {
+                init += kernels.sum(local_first, local_last);
+            } else {
+                init += kernels.sum_wide(local_first, local_last);
+            }
+            return local_last;
+        });
+        return init;
+    }
+
+    return labwork7::accumulate(first, last, std::move(init), std::plus<>{});
+}
+
+
+template<segmented_iterator ItrType, typename CompareType>
+ItrType min_element(ItrType first, ItrType last, CompareType comp) {
+    return details::SegmentedSelect(first, last,
+        [&](auto local_first, auto local_last) { return std::min_element(local_first, local_last, comp); },
+        [&](const auto& candidate, const auto& best) { return comp(candidate, best); });
+}
+
+
+template<segmented_iterator ItrType>
+ItrType min_element(ItrType first, ItrType last) {
+    if constexpr (details::simd_ordered<ItrType>) {
+        const auto& kernels = details::simd::Kernels<std::iter_value_t<ItrType>>();
+
+        return details::SegmentedSelect(first, last,
+            [&](auto local_first, auto local_last) {
+                return local_first + (kernels.min_element(local_first, local_last) - local_first);
+            },
+            [](const auto& candidate, const auto& best) { return candidate < best; });
+    }
+
+    return labwork7::min_element(first, last, std::less<>{});
+}
+
+
+template<segmented_iterator ItrType, typename CompareType>
+ItrType max_element(ItrType first, ItrType last, CompareType comp) {
+    return details::SegmentedSelect(first, last,
+        [&](auto local_first, auto local_last) { return std::max_element(local_first, local_last, comp); },
+        [&](const auto& candidate, const auto& best) { return comp(best, candidate); });
+}
+
+
+template<segmented_iterator ItrType>
+ItrType max_element(ItrType first, ItrType last) {
+    if constexpr (details::simd_ordered<ItrType>) {
+        const auto& kernels = details::simd::Kernels<std::iter_value_t<ItrType>>();
+
+        return details::SegmentedSelect(first, last,
+            [&](auto local_first, auto local_last) {
+                return local_first + (kernels.max_element(local_first, local_last) - local_first);
+            },
+            [](const auto& candidate, const auto& best) { return best < candidate; });
+    }
+
+    return labwork7::max_element(first, last, std::less<>{});
+}
+
+
+template<segmented_iterator ItrType, typename OutItrType>
+OutItrType copy(ItrType first, ItrType last, OutItrType out) {
+    details::SegmentedWalk(first, last, [&](auto local_first, auto local_last) {
+        out = details::SegmentedWrite(local_first, local_last, out, [](auto in_first, auto in_last, auto out_local) {
+            return std::copy(in_first, in_last, out_local);
+        });
+        return local_last;
+    });
+    return out;
+}
+
+
+template<segmented_iterator ItrType, typename ValueType>
+void fill(ItrType first, ItrType last, const ValueType& value) {
+    details::SegmentedWalk(first, last, [&](auto local_first, auto local_last) {
+        std::fill(local_first, local_last, value);
+        return local_last;
+    });
+}
+
+
+template<segmented_iterator ItrType, typename OutItrType, typename UnaryOperationType>
+OutItrType transform(ItrType first, ItrType last, OutItrType out, UnaryOperationType operation) {
+    details::SegmentedWalk(first, last, [&](auto local_first, auto local_last) {
+        out = details::SegmentedWrite(local_first, local_last, out, [&](auto in_first, auto in_last, auto out_local) {
+            return std::transform(in_first, in_last, out_local, operation);
+        });
+        return local_last;
+    });
+    return out;
+}
+
+
+template<segmented_iterator ItrType, typename OutItrType, typename BinaryOperationType, typename ValueType>
+OutItrType inclusive_scan(ItrType first, ItrType last, OutItrType out, BinaryOperationType operation, ValueType init) {
+    details::SegmentedWalk(first, last, [&](auto local_first, auto local_last) {
+        out = details::SegmentedWrite(local_first, local_last, out, [&](auto in_first, auto in_last, auto out_local) {
+            for (; in_first != in_last; ++in_first, ++out_local) {
+                init = operation(std::move(init), *in_first);
+                *out_local = init;
+            }
+            return out_local;
+        });
+        return local_last;
+    });
+    return out;
+}
+
+
+template<segmented_iterator ItrType, typename OutItrType, typename BinaryOperationType>
+OutItrType inclusive_scan(ItrType first, ItrType last, OutItrType out, BinaryOperationType operation) {
+    if (first == last) {
+        return out;
+    }
+
+    std::iter_value_t<ItrType> init = *first;
+    out = details::SegmentedWrite(&init, &init + 1, out, [](auto in_first, auto in_last, auto out_local) {
+        return std::copy(in_first, in_last, out_local);
+    });
+
+    return labwork7::inclusive_scan(++first, last, out, operation, std::move(init));
+}
+
+
+template<segmented_iterator ItrType, typename OutItrType>
+OutItrType inclusive_scan(ItrType first, ItrType last, OutItrType out) {
+    return labwork7::inclusive_scan(first, last, out, std::plus<>{});
+}
+
+} // namespace labwork7
+
+#endif // _UNROLLED_LIST_ALGORITHM_HPP_
@@ -0,0 +1,754 @@
+#ifndef _CHECKPOINTED_UNROLLED_LIST_HPP_
+#define _CHECKPOINTED_UNROLLED_LIST_HPP_
+
+#include <algorithm>
+#include <cerrno>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include "unrolled_list.hpp"
+#include "unrolled_list_io.hpp"
+#include "details/checkpoint_log.hpp"
+
+namespace labwork7 {
+
+/*
+    unrolled_list which appends incremental checkpoints to a log, see details/checkpoint_log.hpp.
+    A checkpoint writes only the chuncks changed since the previous one and the runs of the chain around them,
+    so its cost follows the amount of writes and not the size of the list.
+
+    Every modification takes out of the dirty list the chuncks it can touch (the chunck itself and its neighbours,
+    which split/merge/borrow work with), then marks whatever lays between the untouched chuncks afterwards.
+    Chuncks keep their ids across the modification, fresh chuncks get new ones. When nothing is left between
+    the untouched chuncks, one of them is marked, the run around it cuts the removed chuncks out on replay.
+    The elements are reachable for reading only, set() and update() change them in place.
+*/
+template<std::copy_constructible DataType, size_t ChunckSize = 64, typename AllocatorType = std::allocator<DataType>,
+    chunck_fill_policy FillPolicyType = fill_policy::balanced>
+requires std::is_trivially_copyable_v<DataType>
+class checkpointed_unrolled_list
+    : private unrolled_list<DataType, ChunckSize, AllocatorType, FillPolicyType, details::JournalChunckLinks<DataType, ChunckSize>> {
+  private:
+    using base_t = unrolled_list<DataType, ChunckSize, AllocatorType, FillPolicyType, details::JournalChunckLinks<DataType, ChunckSize>>;
+    using typename base_t::node_t;
+    using chunck_traits = typename base_t::chunck_traits;
+
+  public:
+    using typename base_t::value_type;
+    using typename base_t::const_reference;
+    using typename base_t::const_pointer;
+    using typename base_t::size_type;
+    using typename base_t::difference_type;
+
+    using reference = const_reference;
+    using pointer = const_pointer;
+    using iterator = typename base_t::const_iterator;
+    using const_iterator = typename base_t::const_iterator;
+    using reverse_iterator = typename base_t::const_reverse_iterator;
+    using const_reverse_iterator = typename base_t::const_reverse_iterator;
+    using const_chunck_range = typename base_t::const_chunck_range;
+
+    using typename base_t::allocator_type;
+
+  public:
+    checkpointed_unrolled_list() = default;
+
+    template<std::convertible_to<allocator_type> AnotherAllocatorType>
+    checkpointed_unrolled_list(AnotherAllocatorType&& alloc) : base_t(std::forward<AnotherAllocatorType>(alloc)) {  };
+
+    checkpointed_unrolled_list(std::initializer_list<value_type> i_list) : base_t(i_list) { MarkAll(); };
+
+    template<std::input_iterator InItrType>
+    checkpointed_unrolled_list(InItrType beg, InItrType end, const AllocatorType& alloc = {})
+        : base_t(beg, end, alloc) { MarkAll(); };
+
+    checkpointed_unrolled_list(const checkpointed_unrolled_list& value) : base_t(value) { MarkAll(); };
+
+    checkpointed_unrolled_list(checkpointed_unrolled_list&& value) noexcept
+        : base_t(std::move(value)), dirty_m(std::move(value.dirty_m)), next_chunck_id_m(value.next_chunck_id_m), sequence_m(value.sequence_m), is_reset_pending_m(value.is_reset_pending_m) {
+        value.is_reset_pending_m = true;
+    };
+
+    ~checkpointed_unrolled_list() override = default;
+
+    checkpointed_unrolled_list& operator=(const checkpointed_unrolled_list& value) {
+        if (this == &value) {
+            return *this;
+        }
+
+        checkpointed_unrolled_list current_copy(value);
+        swap(current_copy);
+        MarkAll();
+        return *this;
+    };
+
+    checkpointed_unrolled_list& operator=(checkpointed_unrolled_list&& value) noexcept {
+        if (this == &value) {
+            return *this;
+        }
+
+        clear();
+        swap(value);
+        MarkAll();
+        return *this;
+    };
+
+  public:
+    const_iterator begin() const { return base_t::cbegin(); };
+    const_iterator end() const { return base_t::cend(); };
+    const_iterator cbegin() const { return base_t::cbegin(); };
+    const_iterator cend() const { return base_t::cend(); };
+    const_reverse_iterator rbegin() const { return base_t::crbegin(); };
+    const_reverse_iterator rend() const { return base_t::crend(); };
+
+    const_chunck_range chunks() const noexcept { return base_t::chunks(); };
+
+    using base_t::size;
+    using base_t::empty;
+    using base_t::max_size;
+    using base_t::get_allocator;
+    using base_t::occupancy;
+    using base_t::reserve;
+
+    /* Writes a full binary snapshot, see labwork7::save */
+    void save(const std::filesystem::path& path) const {
+        labwork7::save(static_cast<const base_t&>(*this), path);
+    };
+
+    const_reference front() const { return base_t::front(); };
+    const_reference back() const { return base_t::back(); };
+
+    const_iterator nth(size_type index) const noexcept { return base_t::nth(index); };
+    const_reference operator[](size_type index) const noexcept { return *nth(index); };
+
+    const_reference at(size_type index) const {
+        if (index >= size()) {
+            throw std::out_of_range{"checkpointed_unrolled_list::at: index is out of range"};
+        }
+        return (*this)[index];
+    };
+
+  public:
+    template<typename... ArgsTs>
+    requires std::constructible_from<value_type, ArgsTs...>
+    void emplace_back(ArgsTs&&... args) {
+        node_t* last_chunck = this->end_chunck_ptr_m;
+        Journaled(last_chunck, last_chunck, [&]() {
+            base_t::emplace_back(std::forward<ArgsTs>(args)...);
+        });
+    };
+
+
+    template<typename... ArgsTs>
+    requires std::constructible_from<value_type, ArgsTs...>
+    void emplace_front(ArgsTs&&... args) {
+        node_t* first_chunck = this->begin_chunck_ptr_m;
+        Journaled(first_chunck, first_chunck, [&]() {
+            base_t::emplace_front(std::forward<ArgsTs>(args)...);
+        });
+    };
+
+
+    template<typename... ArgsTs>
+    requires std::constructible_from<value_type, ArgsTs...>
+    const_iterator emplace(const_iterator pos_itr, ArgsTs&&... args) {
+        return JournaledAt(pos_itr, [&]() {
+            return base_t::emplace(pos_itr, std::forward<ArgsTs>(args)...);
+        });
+    };
+
+
+    template<typename... ArgsTs>
+    requires std::constructible_from<value_type, ArgsTs...>
+    const_iterator emplace_at(size_type index, ArgsTs&&... args) {
+        return emplace(nth(index), std::forward<ArgsTs>(args)...);
+    };
+
+
+    template<std::convertible_to<value_type> SameType>
+    void push_back(SameType&& value) {
+        emplace_back(std::forward<SameType>(value));
+    };
+
+
+    template<std::convertible_to<value_type> SameType>
+    void push_front(SameType&& value) {
+        emplace_front(std::forward<SameType>(value));
+    };
+
+
+    template<std::convertible_to<value_type> SameType>
+    const_iterator insert(const_iterator pos_itr, SameType&& value) {
+        return emplace(pos_itr, std::forward<SameType>(value));
+    };
+
+
+    const_iterator insert(const_iterator pos_itr, size_type count, const value_type& value) {
+        return JournaledAt(pos_itr, [&]() {
+            return base_t::insert(pos_itr, count, value);
+        });
+    };
+
+
+    template<std::input_iterator InItrType>
+    const_iterator insert(const_iterator pos_itr, InItrType beg_itr, InItrType end_itr) {
+        return JournaledAt(pos_itr, [&]() {
+            return base_t::insert(pos_itr, beg_itr, end_itr);
+        });
+    };
+
+
+    template<std::convertible_to<value_type> SameType>
+    const_iterator insert_at(size_type index, SameType&& value) {
+        return emplace_at(index, std::forward<SameType>(value));
+    };
+
+
+    void pop_back() {
+        node_t* last_chunck = this->end_chunck_ptr_m;
+        Journaled(last_chunck, last_chunck, [&]() {
+            base_t::pop_back();
+        });
+    };
+
+
+    void pop_front() {
+        node_t* first_chunck = this->begin_chunck_ptr_m;
+        Journaled(first_chunck, first_chunck, [&]() {
+            base_t::pop_front();
+        });
+    };
+
+
+    const_iterator erase(const_iterator pos_itr) {
+        return erase(pos_itr, std::next(pos_itr));
+    };
+
+
+    const_iterator erase(const_iterator beg_pos_itr, const_iterator end_pos_itr) {
+        if (beg_pos_itr == end_pos_itr) {
+            return end_pos_itr;
+        }
+
+        node_t* beg_chunck = static_cast<node_t*>(beg_pos_itr.base());
+        node_t* end_chunck = static_cast<node_t*>(end_pos_itr.base());
+        node_t* first_chunck = beg_chunck->prev_chunck_ptr_m ? beg_chunck->prev_chunck_ptr_m : beg_chunck;
+        node_t* last_chunck = end_chunck->next_chunck_ptr_m ? end_chunck->next_chunck_ptr_m : end_chunck;
+
+        return Journaled(first_chunck, last_chunck, [&]() {
+            return const_iterator{base_t::erase(beg_pos_itr, end_pos_itr)};
+        });
+    };
+
+
+    const_iterator erase_at(size_type index) {
+        return erase(nth(index));
+    };
+
+
+    template<std::convertible_to<value_type> SameType>
+    void set(size_type index, SameType&& value) {
+        update(index, [&](value_type& element) { element = std::forward<SameType>(value); });
+    };
+
+
+    /* Calls func with the element at index and marks its chunck dirty */
+    template<typename FuncType>
+    void update(size_type index, FuncType func) {
+        if (index >= size()) {
+            throw std::out_of_range{"checkpointed_unrolled_list::update: index is out of range"};
+        }
+
+        auto element_itr = base_t::nth(index);
+        dirty_m.Mark(static_cast<node_t*>(element_itr));
+        func(*static_cast<typename base_t::pointer>(element_itr));
+    };
+
+
+    void clear() noexcept {
+        dirty_m.Reset();
+        base_t::clear();
+        MarkAll();
+    };
+
+
+    void compact() noexcept {
+        Relinked([&]() { base_t::compact(); });
+    };
+
+
+    void sort() {
+        sort(std::less<>{});
+    };
+
+
+    template<typename CompareType>
+    void sort(CompareType comp) {
+        Relinked([&]() { base_t::sort(comp); });
+    };
+
+
+    void swap(checkpointed_unrolled_list& value) noexcept {
+        base_t::swap(value);
+        std::swap(dirty_m, value.dirty_m);
+        std::swap(next_chunck_id_m, value.next_chunck_id_m);
+        std::swap(sequence_m, value.sequence_m);
+        std::swap(is_reset_pending_m, value.is_reset_pending_m);
+    };
+
+  public:
+    /*
+        Appends to fd a record with the chuncks changed since the previous checkpoint and returns their amount.
+        The first checkpoint of a list, and the first one after clear/compact/sort, writes the whole list,
+        nothing is appended when nothing has changed.
+        The record is synced with fdatasync; on an error it is cut off the log and the changes stay pending.
+    */
+    size_type checkpoint(int fd) {
+        if (!dirty_m.Head() && !is_reset_pending_m) {
+            return 0;
+        }
+
+        details::CheckpointRecordHeader header = details::MakeCheckpointHeader<value_type>(sequence_m,
+            is_reset_pending_m ? details::kCheckpointReset : 0);
+        size_type dirty_count = 0;
+        ForEachRun([&](node_t* run_begin, const details::CheckpointRun& run) {
+            ++header.run_count_m;
+            header.body_bytes_m += sizeof(run) + run.chunck_count_m * sizeof(details::CheckpointChunck);
+            for (uint64_t ind = 0; ind != run.chunck_count_m; ++ind, run_begin = run_begin->next_chunck_ptr_m) {
+                header.body_bytes_m += run_begin->size_m * sizeof(value_type);
+            }
+            dirty_count += run.chunck_count_m;
+        });
+
+        /* the record is gathered kSnapshotIoBatch buffers per writev, a chunck takes two of them */
+        iovec buffers[details::kSnapshotIoBatch];
+        details::CheckpointRun runs[details::kSnapshotIoBatch];
+        details::CheckpointChunck chunck_headers[details::kSnapshotIoBatch / 2];
+        size_type buffer_count = 0;
+        size_type run_count = 0;
+        size_type chunck_count = 0;
+        uint32_t checksum = 0;
+
+        auto reserve_buffers = [&](size_type count) {
+            if (buffer_count + count > details::kSnapshotIoBatch) {
+                details::WriteFull(fd, buffers, buffer_count);
+                buffer_count = run_count = chunck_count = 0;
+            }
+        };
+        auto add_buffer = [&](void* data, size_t bytes) {
+            checksum = details::Crc32(checksum, data, bytes);
+            buffers[buffer_count++] = iovec{data, bytes};
+        };
+
+        off_t record_offset = ::lseek(fd, 0, SEEK_END);
+        try {
+            add_buffer(&header, sizeof(header));
+            ForEachRun([&](node_t* run_begin, const details::CheckpointRun& run) {
+                reserve_buffers(1);
+                runs[run_count] = run;
+                add_buffer(&runs[run_count++], sizeof(run));
+
+                for (uint64_t ind = 0; ind != run.chunck_count_m; ++ind, run_begin = run_begin->next_chunck_ptr_m) {
+                    reserve_buffers(2);
+                    chunck_headers[chunck_count] = details::CheckpointChunck{run_begin->extension_m.chunck_id_m, run_begin->size_m};
+                    add_buffer(&chunck_headers[chunck_count++], sizeof(details::CheckpointChunck));
+                    add_buffer(static_cast<typename base_t::pointer>(run_begin->data_m), run_begin->size_m * sizeof(value_type));
+                }
+            });
+
+            details::CheckpointRecordTrailer trailer{checksum, sequence_m ^ details::kCheckpointCommitMark};
+            reserve_buffers(1);
+            buffers[buffer_count++] = iovec{&trailer, sizeof(trailer)};
+            details::WriteFull(fd, buffers, buffer_count);
+
+            if (::fdatasync(fd) == -1) {
+                throw std::system_error{errno, std::generic_category(), "unrolled_list checkpoint log: fdatasync"};
+            }
+        } catch(...) {
+            if (record_offset != -1) {
+                [[maybe_unused]] int result = ::ftruncate(fd, record_offset);
+            }
+            throw;
+        }
+
+        dirty_m.Reset();
+        is_reset_pending_m = false;
+        ++sequence_m;
+        return dirty_count;
+    };
+
+
+    /*
+        Replaces the elements with the state recorded in the log at path and compacts the log into a single record,
+        checkpoints made after that go on appending to the compacted log.
+        A torn record at the end of the log is dropped, a record failing its checksum before the end is damage.
+        Throws std::system_error on an I/O error and std::runtime_error on a foreign or damaged log,
+        the list and the log are left untouched then. The renamed log is synced with its directory.
+    */
+    void recover(const std::filesystem::path& path) {
+        checkpointed_unrolled_list recovered(this->alloc_m);
+
+        {
+            details::FileDescriptor file(path, O_RDONLY);
+            recovered.Replay(file);
+        }
+
+        std::filesystem::path compacted_path = path;
+        compacted_path += ".compact";
+        {
+            details::FileDescriptor compacted(compacted_path, O_WRONLY | O_CREAT | O_TRUNC);
+            recovered.MarkAll();
+            recovered.sequence_m = 0;
+            recovered.checkpoint(compacted.get());
+        }
+        std::filesystem::rename(compacted_path, path);
+        details::SyncParentDirectory(path);
+
+        clear();
+        swap(recovered);
+    };
+
+  public:
+    bool operator==(const checkpointed_unrolled_list& value) const noexcept {
+        return static_cast<const base_t&>(*this) == static_cast<const base_t&>(value);
+    };
+
+    bool operator!=(const checkpointed_unrolled_list& value) const noexcept {
+        return !(*this == value);
+    };
+
+  private:
+    static uint64_t ChunckId(const node_t* chunck) noexcept {
+        return chunck ? chunck->extension_m.chunck_id_m : 0;
+    };
+
+
+    /* Calls func with the first chunck and the header of every run of dirty chuncks */
+    template<typename FuncType>
+    void ForEachRun(FuncType&& func) const {
+        for (node_t* current = dirty_m.Head(); current; current = current->extension_m.next_dirty_ptr_m) {
+            node_t* prev_chunck = current->prev_chunck_ptr_m;
+            if (prev_chunck && prev_chunck->extension_m.is_dirty_m) {
+                continue;
+            }
+
+            details::CheckpointRun run{ChunckId(prev_chunck), 0, 0};
+            node_t* run_chunck = current;
+            for (; run_chunck && run_chunck->extension_m.is_dirty_m; run_chunck = run_chunck->next_chunck_ptr_m) {
+                ++run.chunck_count_m;
+            }
+            run.right_id_m = ChunckId(run_chunck);
+            func(current, run);
+        }
+    };
+
+
+    /*
+        Runs an operation which can touch the chuncks from first_chunck to last_chunck,
+        nullptr for both means an empty list.
+    */
+    template<typename OperationType>
+    decltype(auto) Journaled(node_t* first_chunck, node_t* last_chunck, OperationType&& operation) {
+        node_t* left_bound = first_chunck ? first_chunck->prev_chunck_ptr_m : nullptr;
+        node_t* right_bound = last_chunck ? last_chunck->next_chunck_ptr_m : nullptr;
+
+        for (node_t* current = first_chunck; current && current != right_bound; current = current->next_chunck_ptr_m) {
+            dirty_m.Unmark(current);
+        }
+
+        try {
+            if constexpr (std::is_void_v<std::invoke_result_t<OperationType>>) {
+                operation();
+                Retrack(left_bound, right_bound, first_chunck);
+            } else {
+                auto result = operation();
+                Retrack(left_bound, right_bound, first_chunck);
+                return result;
+            }
+        } catch(...) {
+            Retrack(left_bound, right_bound, first_chunck);
+            throw;
+        }
+    };
+
+
+    template<typename OperationType>
+    const_iterator JournaledAt(const_iterator pos_itr, OperationType&& operation) {
+        node_t* pos_chunck = static_cast<node_t*>(pos_itr.base());
+        node_t* first_chunck = pos_chunck && pos_chunck->prev_chunck_ptr_m ? pos_chunck->prev_chunck_ptr_m : pos_chunck;
+        node_t* last_chunck = pos_chunck && pos_chunck->next_chunck_ptr_m ? pos_chunck->next_chunck_ptr_m : pos_chunck;
+
+        return Journaled(first_chunck, last_chunck, [&]() {
+            return const_iterator{operation()};
+        });
+    };
+
+
+    /*
+        Marks the chuncks between the bounds, fresh chuncks get new ids. When the touched chuncks
+        starting with first_chunck are all gone, a bound is marked, or the whole list when there is none
+    */
+    void Retrack(node_t* left_bound, node_t* right_bound, node_t* first_chunck) noexcept {
+        node_t* current = left_bound ? left_bound->next_chunck_ptr_m : this->begin_chunck_ptr_m;
+
+        if (current == right_bound) {
+            if (!first_chunck) {
+                return;
+            }
+            if (left_bound || right_bound) {
+                dirty_m.Mark(left_bound ? left_bound : right_bound);
+            } else {
+                is_reset_pending_m = true;
+            }
+            return;
+        }
+
+        for (; current != right_bound; current = current->next_chunck_ptr_m) {
+            if (!current->extension_m.chunck_id_m) {
+                current->extension_m.chunck_id_m = next_chunck_id_m++;
+            }
+            dirty_m.Mark(current);
+        }
+    };
+
+
+    /* Runs an operation which relinks the whole chunck chain, the next checkpoint rewrites the list */
+    template<typename OperationType>
+    void Relinked(OperationType&& operation) {
+        dirty_m.Reset();
+        try {
+            operation();
+        } catch(...) {
+            MarkAll();
+            throw;
+        }
+        MarkAll();
+    };
+
+
+    void MarkAll() noexcept {
+        is_reset_pending_m = true;
+
+        for (node_t* current = this->begin_chunck_ptr_m; current; current = current->next_chunck_ptr_m) {
+            if (!current->extension_m.chunck_id_m) {
+                current->extension_m.chunck_id_m = next_chunck_id_m++;
+            }
+            dirty_m.Mark(current);
+        }
+    };
+
+
+    /* Rebuilds an empty list from the committed records of a log */
+    void Replay(const details::FileDescriptor& file) {
+        details::LogReader reader(file.get(), file.file_size());
+        details::chunck_id_table<node_t, typename base_t::allocator_type> chuncks(this->alloc_m);
+        bool is_first_record = true;
+
+        while (reader.Remaining() >= sizeof(details::CheckpointRecordHeader)) {
+            details::CheckpointRecordHeader header;
+            reader.Read(&header, sizeof(header));
+
+            if (!details::IsCheckpointHeader(header)) {
+                if (is_first_record) {
+                    throw std::runtime_error{"unrolled_list checkpoint log: not a checkpoint log"};
+                }
+                break;
+            }
+            if (header.element_size_m != sizeof(value_type)) {
+                throw std::runtime_error{"unrolled_list checkpoint log: written for another element type"};
+            }
+
+            details::CheckpointRecordTrailer trailer;
+            if (header.body_bytes_m > reader.Remaining() || reader.Remaining() - header.body_bytes_m < sizeof(trailer)) {
+                break;
+            }
+            reader.ReadAt(reader.Offset() + header.body_bytes_m, &trailer, sizeof(trailer));
+            if (trailer.commit_m != (header.sequence_m ^ details::kCheckpointCommitMark)) {
+                break;
+            }
+            if (trailer.checksum_m != reader.Checksum(header.body_bytes_m, details::Crc32(0, &header, sizeof(header)))) {
+                if (reader.Remaining() - header.body_bytes_m != sizeof(trailer)) {
+                    throw std::runtime_error{"unrolled_list checkpoint log: damaged record"};
+                }
+                break;
+            }
+
+            bool is_reset = header.flags_m & details::kCheckpointReset;
+            if (is_first_record && !is_reset) {
+                throw std::runtime_error{"unrolled_list checkpoint log: the log does not start with a full checkpoint"};
+            }
+            if (!is_reset && header.sequence_m != sequence_m) {
+                throw std::runtime_error{"unrolled_list checkpoint log: records are out of sequence"};
+            }
+
+            uint64_t body_end = reader.Offset() + header.body_bytes_m;
+            ReplayRecord(reader, header, chuncks);
+            if (reader.Offset() != body_end) {
+                throw std::runtime_error{"unrolled_list checkpoint log: damaged record"};
+            }
+            reader.Read(&trailer, sizeof(trailer));
+
+            sequence_m = header.sequence_m + 1;
+            is_first_record = false;
+        }
+
+        this->size_m = 0;
+        for (node_t* current = this->begin_chunck_ptr_m; current; current = current->next_chunck_ptr_m) {
+            this->size_m += current->size_m;
+            next_chunck_id_m = std::max(next_chunck_id_m, current->extension_m.chunck_id_m + 1);
+        }
+        is_reset_pending_m = false;
+    };
+
+
+    template<typename IdTableType>
+    void ReplayRecord(details::LogReader& reader, const details::CheckpointRecordHeader& header, IdTableType& chuncks) {
+        if (header.flags_m & details::kCheckpointReset) {
+            FreeChain(this->begin_chunck_ptr_m);
+            this->begin_chunck_ptr_m = this->end_chunck_ptr_m = nullptr;
+            chuncks.Clear();
+        }
+
+        for (uint64_t ind = 0; ind != header.run_count_m; ++ind) {
+            details::CheckpointRun run;
+            reader.Read(&run, sizeof(run));
+            ReplayRun(reader, run, chuncks);
+        }
+    };
+
+
+    /* The chuncks between the bounds of the run are cut out, reused by id or freed once the run is linked */
+    template<typename IdTableType>
+    void ReplayRun(details::LogReader& reader, const details::CheckpointRun& run, IdTableType& chuncks) {
+        node_t* left_bound = FindChunck(chuncks, run.left_id_m);
+        node_t* right_bound = FindChunck(chuncks, run.right_id_m);
+
+        node_t* cut_begin = left_bound ? left_bound->next_chunck_ptr_m : this->begin_chunck_ptr_m;
+        node_t* cut_end = right_bound ? right_bound->prev_chunck_ptr_m : this->end_chunck_ptr_m;
+        node_t* cut_chain = nullptr;
+
+        if (cut_begin != right_bound) {
+            cut_begin->prev_chunck_ptr_m = nullptr;
+            cut_end->next_chunck_ptr_m = nullptr;
+            cut_chain = cut_begin;
+            for (node_t* current = cut_chain; current; current = current->next_chunck_ptr_m) {
+                current->extension_m.is_dirty_m = true;
+            }
+
+            (left_bound ? left_bound->next_chunck_ptr_m : this->begin_chunck_ptr_m) = right_bound;
+            (right_bound ? right_bound->prev_chunck_ptr_m : this->end_chunck_ptr_m) = left_bound;
+        }
+
+        try {
+            node_t* after_chunck = left_bound;
+            for (uint64_t ind = 0; ind != run.chunck_count_m; ++ind) {
+                details::CheckpointChunck record;
+                reader.Read(&record, sizeof(record));
+                if (!record.chunck_id_m || record.element_count_m > ChunckSize) {
+                    throw std::runtime_error{"unrolled_list checkpoint log: damaged record"};
+                }
+
+                node_t* current = chuncks.Find(record.chunck_id_m);
+                if (!current) {
+                    current = chunck_traits::CreateChunck(this->alloc_m);
+                    current->extension_m.chunck_id_m = record.chunck_id_m;
+                    try {
+                        chuncks.Insert(current);
+                    } catch(...) {
+                        chunck_traits::RemoveChunck(current, this->alloc_m);
+                        throw;
+                    }
+                } else {
+                    if (!current->extension_m.is_dirty_m) {
+                        throw std::runtime_error{"unrolled_list checkpoint log: damaged record"};
+                    }
+                    if (current == cut_chain) {
+                        cut_chain = current->next_chunck_ptr_m;
+                    }
+                    chunck_traits::ExcludeChunck(current);
+                    current->extension_m.is_dirty_m = false;
+                }
+
+                current->size_m = 0;
+                LinkAfter(after_chunck, current);
+                after_chunck = current;
+
+                reader.Read(static_cast<typename base_t::pointer>(current->data_m), record.element_count_m * sizeof(value_type));
+                current->size_m = record.element_count_m;
+            }
+        } catch(...) {
+            FreeChain(cut_chain);
+            throw;
+        }
+
+        for (node_t* current = cut_chain; current; current = current->next_chunck_ptr_m) {
+            chuncks.Erase(current);
+        }
+        FreeChain(cut_chain);
+    };
+
+
+    template<typename IdTableType>
+    static node_t* FindChunck(const IdTableType& chuncks, uint64_t chunck_id) {
+        if (!chunck_id) {
+            return nullptr;
+        }
+
+        node_t* current = chuncks.Find(chunck_id);
+        if (!current || current->extension_m.is_dirty_m) {
+            throw std::runtime_error{"unrolled_list checkpoint log: damaged record"};
+        }
+        return current;
+    };
+
+
+    void LinkAfter(node_t* after_chunck, node_t* current) noexcept {
+        if (after_chunck) {
+            chunck_traits::IncludeChunckBack(after_chunck, current);
+            if (after_chunck == this->end_chunck_ptr_m) {
+                this->end_chunck_ptr_m = current;
+            }
+            return;
+        }
+
+        this->begin_chunck_ptr_m = chunck_traits::IncludeChunckFront(this->begin_chunck_ptr_m, current);
+        if (!this->end_chunck_ptr_m) {
+            this->end_chunck_ptr_m = current;
+        }
+    };
+
+
+    /* Frees a detached chain ending with nullptr, the elements are trivially destructible */
+    void FreeChain(node_t* chain_begin) noexcept {
+        while (chain_begin) {
+            node_t* next_chunck = chain_begin->next_chunck_ptr_m;
+            chunck_traits::RemoveChunck(chain_begin, this->alloc_m);
+            chain_begin = next_chunck;
+        }
+    };
+
+  private:
+    details::dirty_chunck_list<node_t> dirty_m;
+    uint64_t next_chunck_id_m = 1;
+    uint64_t sequence_m = 0;
+    bool is_reset_pending_m = true;
+};
+
+} // namespace labwork7
+
+
+template<std::copy_constructible DataType, size_t ChunckSize = 64, typename AllocatorType = std::allocator<DataType>,
+    labwork7::chunck_fill_policy FillPolicyType = labwork7::fill_policy::balanced>
+using checkpointed_unrolled_list = labwork7::checkpointed_unrolled_list<DataType, ChunckSize, AllocatorType, FillPolicyType>;
+
+#endif // _CHECKPOINTED_UNROLLED_LIST_HPP_
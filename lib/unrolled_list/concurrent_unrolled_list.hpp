@@ -0,0 +1,560 @@
+#ifndef _CONCURRENT_UNROLLED_LIST_HPP_
+#define _CONCURRENT_UNROLLED_LIST_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "details/storage.hpp"
+#include "fill_policy.hpp"
+#include "relocation.hpp"
+
+namespace labwork7 {
+
+namespace details {
+
+/*
+    Lock and seqlock of a chunck in one counter: odd while a writer holds the chunck.
+    Writers take it with a CAS from an even value, readers copy what they need
+    between two even loads of the same value.
+*/
+struct ChunckSeqLock {
+    std::atomic<uint64_t> sequence_m = 0;
+};
+
+
+/* Reads a trivially copyable value a writer may be changing, the copy is checked by the seqlock afterwards */
+template<typename DataType>
+DataType RacyLoad(DataType* source) noexcept {
+    static_assert(std::is_trivially_copyable_v<DataType>);
+
+    alignas(DataType) unsigned char bytes[sizeof(DataType)];
+    unsigned char* source_bytes = reinterpret_cast<unsigned char*>(source);
+    for (size_t ind = 0; ind != sizeof(DataType); ++ind) {
+        bytes[ind] = std::atomic_ref<unsigned char>(source_bytes[ind]).load(std::memory_order_relaxed);
+    }
+    return std::bit_cast<DataType>(bytes);
+}
+
+} // namespace details
+
+
+/*
+    unrolled_list for threads which insert, erase and update at unrelated positions.
+
+    Every chunck carries its own ChunckSeqLock. Writers walk the chain hand over hand from a sentinel
+    chunck, holding the chunck they stand on and the one before it, so concurrent writers pipeline along
+    the chain and never overtake each other. A split locks the chunck and its successor, a merge or borrow
+    the chunck, its successor and the one after that, always left to right.
+
+    Readers take no locks: they copy a chunck between two loads of its sequence and check the chunck
+    before it once more, which tells that the link between them held. Each chunck a reader sees is
+    consistent, a whole pass is not a snapshot. Optimistic reads need a trivially copyable value_type,
+    other types are read hand over hand like the writers walk.
+
+    Unlinked chuncks are kept in a pool until the list is destroyed, so a reader which still
+    stands on one reads valid memory and fails the sequence check.
+*/
+template<typename DataType, size_t ChunckSize = 64, typename AllocatorType = std::allocator<DataType>,
+    chunck_fill_policy FillPolicyType = fill_policy::balanced>
+class concurrent_unrolled_list {
+    static_assert(is_nothrow_relocatable_v<DataType>, "elements are relocated while chuncks are locked");
+
+  private:
+    using node_t = UnrolledListNodeChunck<DataType, ChunckSize, details::ChunckSeqLock, kCacheLineSize>;
+    using node_traits_t = chunck_traits<node_t, AllocatorType>;
+    using fill_traits = details::fill_policy_traits<FillPolicyType, ChunckSize>;
+
+    static constexpr bool kOptimisticReads = std::is_trivially_copyable_v<DataType>;
+
+    /* index of emplace which stands for the end of the list */
+    static constexpr size_t kEndIndex = std::numeric_limits<size_t>::max();
+
+  public:
+    using value_type = DataType;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using pointer = value_type*;
+    using size_type = std::size_t;
+
+    using allocator_type = typename node_traits_t::allocator_type;
+
+  private:
+    using data_allocator_type = typename std::allocator_traits<AllocatorType>::template rebind_alloc<value_type>;
+    using data_allocator_trait_t = std::allocator_traits<data_allocator_type>;
+
+  public:
+    concurrent_unrolled_list() : concurrent_unrolled_list(allocator_type{}) {  };
+
+    explicit concurrent_unrolled_list(const allocator_type& alloc) : alloc_m(alloc), data_alloc_m(alloc_m) {
+        sentinel_chunck_ptr_m = node_traits_t::CreateChunck(alloc_m);
+    };
+
+
+    concurrent_unrolled_list(const concurrent_unrolled_list&) = delete;
+    concurrent_unrolled_list& operator=(const concurrent_unrolled_list&) = delete;
+
+
+    ~concurrent_unrolled_list() {
+        for (node_t* current = sentinel_chunck_ptr_m; current;) {
+            DestroyElements(current->data_m, current->data_m + current->size_m);
+            node_traits_t::RemoveChunck(std::exchange(current, current->next_chunck_ptr_m), alloc_m);
+        }
+        for (node_t* current = spare_chunck_ptr_m; current;) {
+            node_traits_t::RemoveChunck(std::exchange(current, current->next_chunck_ptr_m), alloc_m);
+        }
+    };
+
+  public:
+    /* Inserts before the element at index, false if the list was shorter than index */
+    template<typename... ArgsTs>
+    bool emplace(size_type index, ArgsTs&&... args) {
+        value_type value(std::forward<ArgsTs>(args)...);
+
+        HandOverHand walk(*this);
+        if (!walk.Seek(index, true)) {
+            return false;
+        }
+
+        if (!walk.current_m) {
+            node_t* added_chunck = AcquireChunck();
+            LinkAfter(walk.prev_m, nullptr, added_chunck);
+            walk.current_m = added_chunck;
+        }
+
+        size_t offset = index == kEndIndex ? walk.current_m->size_m : index - walk.passed_m;
+        if (walk.current_m->size_m == ChunckSize) {
+            SplitPlace(walk.current_m, offset, value, AcquireChunck());
+        } else {
+            PlaceInto(walk.current_m, offset, value);
+        }
+
+        size_m.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    };
+
+
+    bool insert(size_type index, const value_type& value) { return emplace(index, value); };
+    bool insert(size_type index, value_type&& value) { return emplace(index, std::move(value)); };
+
+    void push_front(const value_type& value) { emplace(0, value); };
+    void push_front(value_type&& value) { emplace(0, std::move(value)); };
+
+
+    void push_back(const value_type& value) { emplace(kEndIndex, value); };
+    void push_back(value_type&& value) { emplace(kEndIndex, std::move(value)); };
+
+
+    /* Erases the element at index, false if there was none */
+    bool erase(size_type index) {
+        HandOverHand walk(*this);
+        if (!walk.Seek(index, false)) {
+            return false;
+        }
+
+        node_t* current_chunck = walk.current_m;
+        size_t offset = index - walk.passed_m;
+
+        data_allocator_trait_t::destroy(data_alloc_m, current_chunck->data_m + offset);
+        Relocate(current_chunck->data_m + offset + 1, current_chunck->data_m + current_chunck->size_m,
+            current_chunck->data_m + offset);
+        StoreSize(current_chunck, current_chunck->size_m - 1);
+        size_m.fetch_sub(1, std::memory_order_relaxed);
+
+        Rebalance(walk);
+        return true;
+    };
+
+
+    /* Calls func(element) with the chunck of the element locked, false if there was no element at index */
+    template<typename FuncType>
+    bool update(size_type index, FuncType&& func) {
+        HandOverHand walk(*this);
+        if (!walk.Seek(index, false)) {
+            return false;
+        }
+
+        func(walk.current_m->data_m[index - walk.passed_m]);
+        return true;
+    };
+
+
+    /* Copy of the element at index, nullopt if there was none */
+    std::optional<value_type> get(size_type index) const {
+        if constexpr (kOptimisticReads) {
+            while (true) {
+                std::optional<value_type> result;
+                if (TryOptimisticGet(index, result)) {
+                    return result;
+                }
+                std::this_thread::yield();
+            }
+        } else {
+            HandOverHand walk(const_cast<concurrent_unrolled_list&>(*this));
+            if (!walk.Seek(index, false)) {
+                return std::nullopt;
+            }
+            return walk.current_m->data_m[index - walk.passed_m];
+        }
+    };
+
+
+    /* Calls func(element) for every element in order, each chunck is locked while it is visited */
+    template<typename FuncType>
+    void for_each(FuncType&& func) const {
+        node_t* current = sentinel_chunck_ptr_m;
+        Lock(current);
+
+        try {
+            while (node_t* next = current->next_chunck_ptr_m) {
+                Lock(next);
+                Unlock(std::exchange(current, next));
+
+                for (size_t ind = 0; ind != current->size_m; ++ind) {
+                    func(std::as_const(current->data_m[ind]));
+                }
+            }
+        } catch(...) {
+            Unlock(current);
+            throw;
+        }
+        Unlock(current);
+    };
+
+
+    size_type size() const noexcept { return size_m.load(std::memory_order_relaxed); };
+    bool empty() const noexcept { return size() == 0; };
+    allocator_type get_allocator() const noexcept { return alloc_m; };
+
+  private:
+    /* The pair of locked chuncks a writer stands on, both are unlocked when it goes out of scope */
+    struct HandOverHand {
+        explicit HandOverHand(concurrent_unrolled_list& owner) noexcept : prev_m(owner.sentinel_chunck_ptr_m) {
+            Lock(prev_m);
+            current_m = prev_m->next_chunck_ptr_m;
+            if (current_m) {
+                Lock(current_m);
+            }
+        };
+
+        HandOverHand(const HandOverHand&) = delete;
+        HandOverHand& operator=(const HandOverHand&) = delete;
+
+        ~HandOverHand() {
+            if (current_m) {
+                Unlock(current_m);
+            }
+            Unlock(prev_m);
+        };
+
+
+        /*
+            Stops on the chunck which keeps index and counts the elements before it in passed_m.
+            An insert may also stop right behind the last element of a chunck which is not full,
+            or of the last chunck; kEndIndex stops on the last chunck. current_m stays null in an empty list.
+        */
+        bool Seek(size_type index, bool is_insert) noexcept {
+            if (!current_m) {
+                return is_insert && (index == 0 || index == kEndIndex);
+            }
+
+            while (true) {
+                size_t size = current_m->size_m;
+                node_t* next = current_m->next_chunck_ptr_m;
+
+                if (index < passed_m + size) {
+                    return true;
+                }
+                if (is_insert && index == passed_m + size && (size != ChunckSize || !next)) {
+                    return true;
+                }
+                if (!next) {
+                    return is_insert && index == kEndIndex;
+                }
+
+                Lock(next);
+                Unlock(prev_m);
+                prev_m = std::exchange(current_m, next);
+                passed_m += size;
+            }
+        };
+
+        node_t* prev_m;
+        node_t* current_m = nullptr;
+        size_type passed_m = 0;
+    };
+
+
+    /* Splits the full current_chunck with the locked split_chunck and puts value at offset */
+    void SplitPlace(node_t* current_chunck, size_t offset, value_type& value, node_t* split_chunck) noexcept {
+        node_t* next = current_chunck->next_chunck_ptr_m;
+        if (next) {
+            Lock(next);
+        }
+
+        /* appending to the end starts a new chunck instead of leaving two half empty ones */
+        size_t split_keep = offset == ChunckSize ? ChunckSize : fill_traits::split_keep;
+
+        Relocate(current_chunck->data_m + split_keep, current_chunck->data_m + ChunckSize, split_chunck->data_m);
+        StoreSize(split_chunck, ChunckSize - split_keep);
+        StoreSize(current_chunck, split_keep);
+        LinkAfter(current_chunck, next, split_chunck);
+
+        if (offset >= split_keep) {
+            PlaceInto(split_chunck, offset - split_keep, value);
+        } else {
+            PlaceInto(current_chunck, offset, value);
+        }
+
+        Unlock(split_chunck);
+        if (next) {
+            Unlock(next);
+        }
+    };
+
+
+    void PlaceInto(node_t* current_chunck, size_t offset, value_type& value) noexcept {
+        Relocate(current_chunck->data_m + offset, current_chunck->data_m + current_chunck->size_m,
+            current_chunck->data_m + offset + 1);
+        data_allocator_trait_t::construct(data_alloc_m, current_chunck->data_m + offset, std::move(value));
+        StoreSize(current_chunck, current_chunck->size_m + 1);
+    };
+
+
+    /* Links the locked added_chunck between the locked prev_chunck and next_chunck, it stays locked */
+    void LinkAfter(node_t* prev_chunck, node_t* next_chunck, node_t* added_chunck) noexcept {
+        StorePrev(added_chunck, prev_chunck);
+        StoreNext(added_chunck, next_chunck);
+        if (next_chunck) {
+            StorePrev(next_chunck, added_chunck);
+        }
+        StoreNext(prev_chunck, added_chunck);
+    };
+
+
+    /*
+        After an erase from the current chunck of walk: merges with or borrows from its successor
+        when it got below the merge threshold, drops it when it got empty at the end of the list.
+    */
+    void Rebalance(HandOverHand& walk) noexcept {
+        node_t* current_chunck = walk.current_m;
+        size_t current_size = current_chunck->size_m;
+
+        if (current_size >= fill_traits::merge_threshold) {
+            return;
+        }
+
+        node_t* next = current_chunck->next_chunck_ptr_m;
+        if (!next) {
+            if (current_size == 0) {
+                StoreNext(walk.prev_m, nullptr);
+                Unlock(current_chunck);
+                ReleaseChunck(current_chunck);
+                walk.current_m = nullptr;
+            }
+            return;
+        }
+
+        Lock(next);
+        size_t next_size = next->size_m;
+
+        if (current_size + next_size <= fill_traits::merge_limit) {
+            node_t* after_next = next->next_chunck_ptr_m;
+            if (after_next) {
+                Lock(after_next);
+                StorePrev(after_next, current_chunck);
+            }
+
+            Relocate(next->data_m, next->data_m + next_size, current_chunck->data_m + current_size);
+            StoreSize(current_chunck, current_size + next_size);
+            StoreSize(next, 0);
+            StoreNext(current_chunck, after_next);
+
+            if (after_next) {
+                Unlock(after_next);
+            }
+            Unlock(next);
+            ReleaseChunck(next);
+        } else {
+            size_t moved = std::min(fill_traits::borrow_count, next_size - fill_traits::merge_threshold);
+
+            Relocate(next->data_m, next->data_m + moved, current_chunck->data_m + current_size);
+            Relocate(next->data_m + moved, next->data_m + next_size, next->data_m);
+            StoreSize(current_chunck, current_size + moved);
+            StoreSize(next, next_size - moved);
+            Unlock(next);
+        }
+    };
+
+
+    /* One optimistic pass, false if a writer got in the way */
+    bool TryOptimisticGet(size_type index, std::optional<value_type>& result) const noexcept {
+        node_t* prev = sentinel_chunck_ptr_m;
+        uint64_t prev_sequence = ReadBegin(prev);
+        node_t* current = LoadNext(prev);
+        size_type passed = 0;
+
+        while (current) {
+            uint64_t sequence = ReadBegin(current);
+            size_t size = LoadSize(current);
+            node_t* next = LoadNext(current);
+
+            if (index < passed + size && size <= ChunckSize) {
+                value_type value = details::RacyLoad(current->data_m + (index - passed));
+                if (!ReadValidate(current, sequence) || !ReadValidate(prev, prev_sequence)) {
+                    return false;
+                }
+                result.emplace(value);
+                return true;
+            }
+
+            if (!ReadValidate(current, sequence) || !ReadValidate(prev, prev_sequence)) {
+                return false;
+            }
+            passed += size;
+            prev = current;
+            prev_sequence = sequence;
+            current = next;
+        }
+
+        return ReadValidate(prev, prev_sequence);
+    };
+
+
+    static void Lock(node_t* current_chunck) noexcept {
+        std::atomic<uint64_t>& sequence = current_chunck->extension_m.sequence_m;
+        uint64_t value = sequence.load(std::memory_order_relaxed);
+
+        for (size_t attempt = 0;; ++attempt) {
+            if (!(value & 1) && sequence.compare_exchange_weak(value, value + 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+                return;
+            }
+            if (attempt > 64) {
+                std::this_thread::yield();
+            }
+            value = sequence.load(std::memory_order_relaxed);
+        }
+    };
+
+
+    static void Unlock(node_t* current_chunck) noexcept {
+        current_chunck->extension_m.sequence_m.fetch_add(1, std::memory_order_release);
+    };
+
+
+    static uint64_t ReadBegin(const node_t* current_chunck) noexcept {
+        uint64_t value = current_chunck->extension_m.sequence_m.load(std::memory_order_acquire);
+        while (value & 1) {
+            std::this_thread::yield();
+            value = current_chunck->extension_m.sequence_m.load(std::memory_order_acquire);
+        }
+        return value;
+    };
+
+
+    static bool ReadValidate(const node_t* current_chunck, uint64_t value) noexcept {
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return current_chunck->extension_m.sequence_m.load(std::memory_order_relaxed) == value;
+    };
+
+
+    /* Links and sizes are read by optimistic readers, so the writers store them atomically */
+    static node_t* LoadNext(node_t* current_chunck) noexcept {
+        return std::atomic_ref<node_t*>(current_chunck->next_chunck_ptr_m).load(std::memory_order_relaxed);
+    };
+
+    static size_t LoadSize(node_t* current_chunck) noexcept {
+        return std::atomic_ref<size_t>(current_chunck->size_m).load(std::memory_order_relaxed);
+    };
+
+    static void StoreNext(node_t* current_chunck, node_t* next) noexcept {
+        std::atomic_ref<node_t*>(current_chunck->next_chunck_ptr_m).store(next, std::memory_order_relaxed);
+    };
+
+    static void StorePrev(node_t* current_chunck, node_t* prev) noexcept {
+        std::atomic_ref<node_t*>(current_chunck->prev_chunck_ptr_m).store(prev, std::memory_order_relaxed);
+    };
+
+    static void StoreSize(node_t* current_chunck, size_t size) noexcept {
+        std::atomic_ref<size_t>(current_chunck->size_m).store(size, std::memory_order_relaxed);
+    };
+
+
+    /* A locked chunck from the pool or a fresh one, the pool is touched only by splits and merges */
+    node_t* AcquireChunck() {
+        node_t* acquired_chunck = nullptr;
+        {
+            std::lock_guard lock(spare_mutex_m);
+            if (spare_chunck_ptr_m) {
+                acquired_chunck = std::exchange(spare_chunck_ptr_m, spare_chunck_ptr_m->next_chunck_ptr_m);
+            }
+        }
+
+        if (!acquired_chunck) {
+            acquired_chunck = node_traits_t::CreateChunck(alloc_m);
+        }
+        Lock(acquired_chunck);
+        return acquired_chunck;
+    };
+
+
+    /* Takes an unlinked and unlocked chunck, readers may still stand on it */
+    void ReleaseChunck(node_t* released_chunck) noexcept {
+        std::lock_guard lock(spare_mutex_m);
+        StoreNext(released_chunck, spare_chunck_ptr_m);
+        spare_chunck_ptr_m = released_chunck;
+    };
+
+
+    /* Moves [from, to) to dest, the ranges may overlap in either direction */
+    void Relocate(pointer from, pointer to, pointer dest) noexcept {
+        if constexpr (is_trivially_relocatable_v<value_type>) {
+            details::RelocateBytes(dest, from, to - from);
+        } else if (dest < from) {
+            for (; from != to; ++from, ++dest) {
+                data_allocator_trait_t::construct(data_alloc_m, dest, std::move(*from));
+                data_allocator_trait_t::destroy(data_alloc_m, from);
+            }
+        } else {
+            for (pointer dest_end = dest + (to - from); to != from;) {
+                data_allocator_trait_t::construct(data_alloc_m, --dest_end, std::move(*--to));
+                data_allocator_trait_t::destroy(data_alloc_m, to);
+            }
+        }
+    };
+
+
+    void DestroyElements(pointer from, pointer to) noexcept {
+        for (; from != to; ++from) {
+            data_allocator_trait_t::destroy(data_alloc_m, from);
+        }
+    };
+
+  private:
+    node_t* sentinel_chunck_ptr_m = nullptr;
+    alignas(kCacheLineSize) std::atomic<size_type> size_m = 0;
+
+    std::mutex spare_mutex_m;
+    node_t* spare_chunck_ptr_m = nullptr;
+
+    [[no_unique_address]] allocator_type alloc_m;
+    [[no_unique_address]] data_allocator_type data_alloc_m;
+};
+
+} // namespace labwork7
+
+
+template<typename DataType, size_t ChunckSize = 64, typename AllocatorType = std::allocator<DataType>,
+    labwork7::chunck_fill_policy FillPolicyType = labwork7::fill_policy::balanced>
+using concurrent_unrolled_list = labwork7::concurrent_unrolled_list<DataType, ChunckSize, AllocatorType, FillPolicyType>;
+
+#endif // _CONCURRENT_UNROLLED_LIST_HPP_
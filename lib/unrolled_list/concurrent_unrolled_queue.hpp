@@ -0,0 +1,298 @@
+#ifndef _CONCURRENT_UNROLLED_QUEUE_HPP_
+#define _CONCURRENT_UNROLLED_QUEUE_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "details/storage.hpp"
+#include "details/hazard_pointers.hpp"
+
+namespace labwork7 {
+
+namespace details {
+
+/*
+    State of a chunck used as a segment of concurrent_unrolled_queue.
+    Producers claim slots with enqueue_index_m, consumers with dequeue_index_m,
+    both indices run past kSize once the segment is used up.
+*/
+template<size_t kSize>
+struct QueueSegmentState {
+    static constexpr uint8_t kSlotEmpty = 0;
+    static constexpr uint8_t kSlotReady = 1;
+    static constexpr uint8_t kSlotTaken = 2;
+
+    alignas(kCacheLineSize) std::atomic<size_t> enqueue_index_m = 0;
+    alignas(kCacheLineSize) std::atomic<size_t> dequeue_index_m = 0;
+    std::atomic<uint8_t> slot_states_m[kSize] = {};
+};
+
+} // namespace details
+
+
+/*
+    Lock-free multi-producer multi-consumer FIFO over a chain of chuncks.
+
+    A producer claims a slot of the tail chunck with a fetch-add, constructs the element there
+    and marks the slot ready. A consumer claims the next slot of the head chunck the same way
+    and takes the element; a slot the consumer gets to before its producer is marked taken,
+    so the producer retries with the next one. The thread which fills the tail chunck up links
+    the next chunck with its element already inside.
+
+    Used up chuncks are retired through hazard pointers and recycled through a lock-free pool,
+    so the queue allocates only when it grows past its largest size so far.
+    The allocator has to be safe to call from several threads at once.
+*/
+template<typename DataType, size_t ChunckSize = 64, typename AllocatorType = std::allocator<DataType>>
+class concurrent_unrolled_queue {
+    static_assert(ChunckSize > 0, "chunck has to keep at least one element");
+    static_assert(std::is_nothrow_move_constructible_v<DataType> && std::is_nothrow_move_assignable_v<DataType>,
+        "elements are moved between slots after they are claimed and must not throw there");
+
+  private:
+    using segment_state_t = details::QueueSegmentState<ChunckSize>;
+    using node_t = UnrolledListNodeChunck<DataType, ChunckSize, segment_state_t, kCacheLineSize>;
+    using node_traits_t = chunck_traits<node_t, AllocatorType>;
+    using hazards_t = details::HazardPointerDomain<node_t>;
+
+    /* hazard slots: the head or tail chunck and the top of the pool */
+    static constexpr size_t kChunckHazard = 0;
+    static constexpr size_t kPoolHazard = 1;
+
+  public:
+    using value_type = DataType;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using size_type = std::size_t;
+
+    using allocator_type = typename node_traits_t::allocator_type;
+
+  private:
+    using data_allocator_type = typename std::allocator_traits<AllocatorType>::template rebind_alloc<value_type>;
+    using data_allocator_trait_t = std::allocator_traits<data_allocator_type>;
+
+  public:
+    concurrent_unrolled_queue() : concurrent_unrolled_queue(allocator_type{}) {  };
+
+    explicit concurrent_unrolled_queue(const allocator_type& alloc) : alloc_m(alloc), data_alloc_m(alloc_m) {
+        node_t* first_chunck = node_traits_t::CreateChunck(alloc_m);
+        head_chunck_ptr_m.store(first_chunck, std::memory_order_relaxed);
+        tail_chunck_ptr_m.store(first_chunck, std::memory_order_relaxed);
+    };
+
+
+    concurrent_unrolled_queue(const concurrent_unrolled_queue&) = delete;
+    concurrent_unrolled_queue& operator=(const concurrent_unrolled_queue&) = delete;
+
+
+    ~concurrent_unrolled_queue() {
+        node_t* current = head_chunck_ptr_m.load(std::memory_order_acquire);
+        while (current) {
+            for (size_t ind = 0; ind != ChunckSize; ++ind) {
+                if (current->extension_m.slot_states_m[ind].load(std::memory_order_relaxed) == segment_state_t::kSlotReady) {
+                    data_allocator_trait_t::destroy(data_alloc_m, current->data_m + ind);
+                }
+            }
+            node_traits_t::RemoveChunck(std::exchange(current, NextLink(current).load(std::memory_order_relaxed)), alloc_m);
+        }
+
+        hazards_m.Drain([this](node_t* chunck) { node_traits_t::RemoveChunck(chunck, alloc_m); });
+
+        current = free_chunck_ptr_m.load(std::memory_order_acquire);
+        while (current) {
+            node_traits_t::RemoveChunck(std::exchange(current, NextLink(current).load(std::memory_order_relaxed)), alloc_m);
+        }
+    };
+
+  public:
+    void push(const value_type& value) { emplace(value); };
+
+    void push(value_type&& value) { emplace(std::move(value)); };
+
+
+    template<typename... ArgsTs>
+    void emplace(ArgsTs&&... args) {
+        value_type value(std::forward<ArgsTs>(args)...);
+        Enqueue(value);
+    };
+
+
+    /* Moves the oldest element into value, false if the queue looked empty */
+    bool try_pop(value_type& value) {
+        typename hazards_t::Guard guard(hazards_m);
+
+        while (true) {
+            node_t* head = guard.Protect(kChunckHazard, head_chunck_ptr_m);
+            segment_state_t& state = head->extension_m;
+
+            if (state.dequeue_index_m.load() >= state.enqueue_index_m.load()
+                && !NextLink(head).load(std::memory_order_acquire)) {
+                return false;
+            }
+
+            size_t index = state.dequeue_index_m.fetch_add(1);
+            if (index >= ChunckSize) {
+                node_t* next = NextLink(head).load(std::memory_order_acquire);
+                if (!next) {
+                    return false;
+                }
+
+                if (head_chunck_ptr_m.compare_exchange_strong(head, next)) {
+                    /* the tail may still lag behind on the chunck being retired */
+                    node_t* lagging_tail = head;
+                    tail_chunck_ptr_m.compare_exchange_strong(lagging_tail, next);
+                    guard.Retire(head, [this](node_t* chunck) { ReleaseChunck(chunck); });
+                }
+                continue;
+            }
+
+            if (state.slot_states_m[index].exchange(segment_state_t::kSlotTaken, std::memory_order_acq_rel)
+                != segment_state_t::kSlotReady) {
+                continue;
+            }
+
+            value_type* slot = head->data_m + index;
+            value = std::move(*slot);
+            data_allocator_trait_t::destroy(data_alloc_m, slot);
+            return true;
+        }
+    };
+
+
+    /* A snapshot, may be outdated by the time it returns */
+    bool empty() const noexcept {
+        node_t* head = head_chunck_ptr_m.load(std::memory_order_acquire);
+        const segment_state_t& state = head->extension_m;
+
+        return state.dequeue_index_m.load() >= std::min(state.enqueue_index_m.load(), ChunckSize)
+            && !NextLink(head).load(std::memory_order_acquire);
+    };
+
+
+    allocator_type get_allocator() const noexcept { return alloc_m; };
+
+  private:
+    void Enqueue(value_type& value) {
+        typename hazards_t::Guard guard(hazards_m);
+
+        while (true) {
+            node_t* tail = guard.Protect(kChunckHazard, tail_chunck_ptr_m);
+            segment_state_t& state = tail->extension_m;
+
+            size_t index = state.enqueue_index_m.fetch_add(1);
+            if (index < ChunckSize) {
+                value_type* slot = tail->data_m + index;
+                data_allocator_trait_t::construct(data_alloc_m, slot, std::move(value));
+
+                uint8_t expected = segment_state_t::kSlotEmpty;
+                if (state.slot_states_m[index].compare_exchange_strong(expected, segment_state_t::kSlotReady,
+                    std::memory_order_release, std::memory_order_relaxed)) {
+                    return;
+                }
+
+                /* a consumer has given up on the slot already */
+                value = std::move(*slot);
+                data_allocator_trait_t::destroy(data_alloc_m, slot);
+                continue;
+            }
+
+            if (tail != tail_chunck_ptr_m.load()) {
+                continue;
+            }
+
+            node_t* next = NextLink(tail).load(std::memory_order_acquire);
+            if (next) {
+                tail_chunck_ptr_m.compare_exchange_strong(tail, next);
+                continue;
+            }
+
+            node_t* added_chunck = AcquireChunck(guard);
+            value_type* slot = added_chunck->data_m;
+            data_allocator_trait_t::construct(data_alloc_m, slot, std::move(value));
+            added_chunck->extension_m.slot_states_m[0].store(segment_state_t::kSlotReady, std::memory_order_relaxed);
+            added_chunck->extension_m.enqueue_index_m.store(1, std::memory_order_relaxed);
+
+            node_t* expected = nullptr;
+            if (NextLink(tail).compare_exchange_strong(expected, added_chunck)) {
+                tail_chunck_ptr_m.compare_exchange_strong(tail, added_chunck);
+                return;
+            }
+
+            /* another producer linked its chunck first, this one may still be seen by the pool readers */
+            value = std::move(*slot);
+            data_allocator_trait_t::destroy(data_alloc_m, slot);
+            guard.Retire(added_chunck, [this](node_t* chunck) { ReleaseChunck(chunck); });
+        }
+    };
+
+
+    /* A clean chunck from the pool, a new one if the pool is empty */
+    node_t* AcquireChunck(typename hazards_t::Guard& guard) {
+        while (true) {
+            node_t* top = guard.Protect(kPoolHazard, free_chunck_ptr_m);
+            if (!top) {
+                guard.Clear(kPoolHazard);
+                return node_traits_t::CreateChunck(alloc_m);
+            }
+
+            node_t* next = NextLink(top).load(std::memory_order_acquire);
+            if (free_chunck_ptr_m.compare_exchange_strong(top, next)) {
+                guard.Clear(kPoolHazard);
+                ResetChunck(top);
+                return top;
+            }
+        }
+    };
+
+
+    /* Called only for chuncks no thread can reach any more */
+    void ReleaseChunck(node_t* released_chunck) noexcept {
+        node_t* top = free_chunck_ptr_m.load(std::memory_order_relaxed);
+        do {
+            NextLink(released_chunck).store(top, std::memory_order_relaxed);
+        } while (!free_chunck_ptr_m.compare_exchange_weak(top, released_chunck,
+            std::memory_order_release, std::memory_order_relaxed));
+    };
+
+
+    static void ResetChunck(node_t* current_chunck) noexcept {
+        segment_state_t& state = current_chunck->extension_m;
+
+        state.enqueue_index_m.store(0, std::memory_order_relaxed);
+        state.dequeue_index_m.store(0, std::memory_order_relaxed);
+        for (auto& slot_state : state.slot_states_m) {
+            slot_state.store(segment_state_t::kSlotEmpty, std::memory_order_relaxed);
+        }
+        current_chunck->prev_chunck_ptr_m = nullptr;
+        NextLink(current_chunck).store(nullptr, std::memory_order_relaxed);
+    };
+
+
+    /* next_chunck_ptr_m is read and written concurrently, so it is accessed only through here */
+    static std::atomic_ref<node_t*> NextLink(node_t* current_chunck) noexcept {
+        return std::atomic_ref<node_t*>(current_chunck->next_chunck_ptr_m);
+    };
+
+  private:
+    alignas(kCacheLineSize) std::atomic<node_t*> head_chunck_ptr_m = nullptr;
+    alignas(kCacheLineSize) std::atomic<node_t*> tail_chunck_ptr_m = nullptr;
+    alignas(kCacheLineSize) std::atomic<node_t*> free_chunck_ptr_m = nullptr;
+
+    hazards_t hazards_m;
+
+    [[no_unique_address]] allocator_type alloc_m;
+    [[no_unique_address]] data_allocator_type data_alloc_m;
+};
+
+} // namespace labwork7
+
+
+template<typename DataType, size_t ChunckSize = 64, typename AllocatorType = std::allocator<DataType>>
+using concurrent_unrolled_queue = labwork7::concurrent_unrolled_queue<DataType, ChunckSize, AllocatorType>;
+
+#endif // _CONCURRENT_UNROLLED_QUEUE_HPP_
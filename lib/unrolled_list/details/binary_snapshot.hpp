@@ -0,0 +1,319 @@
+#ifndef _UNROLLED_LIST_BINARY_SNAPSHOT_HPP_
+#define _UNROLLED_LIST_BINARY_SNAPSHOT_HPP_
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "storage.hpp"
+
+namespace labwork7 {
+
+namespace details {
+
+/*
+    Binary snapshot of a list, all the fields are in the byte order of the writer:
+        SnapshotHeader
+        uint64_t chunck_table[chunck_count_m]    element count of every chunck in list order
+        padding up to payload_offset_m
+        the elements of every chunck in list order, back to back
+
+    payload_offset_m is aligned for the elements and to a cache line, so a mapped file is read in place.
+*/
+inline constexpr char kSnapshotMagic[8] = {'U', 'L', 'S', 'N', 'A', 'P', '\0', '\0'};
+inline constexpr uint32_t kSnapshotVersion = 1;
+inline constexpr uint32_t kSnapshotByteOrder = 0x01020304;
+
+/* chuncks moved by one readv/writev */
+inline constexpr size_t kSnapshotIoBatch = 256;
+
+
+struct SnapshotHeader {
+    char magic_m[8];
+    uint32_t version_m;
+    uint32_t byte_order_m;
+    uint64_t element_size_m;
+    uint64_t element_alignment_m;
+    uint64_t element_count_m;
+    uint64_t chunck_count_m;
+    uint64_t payload_offset_m;
+};
+
+
+template<typename DataType>
+SnapshotHeader MakeSnapshotHeader(uint64_t element_count, uint64_t chunck_count) noexcept {
+    constexpr uint64_t kPayloadAlignment = std::max<uint64_t>(kCacheLineSize, alignof(DataType));
+
+    SnapshotHeader header{};
+    std::memcpy(header.magic_m, kSnapshotMagic, sizeof(kSnapshotMagic));
+    header.version_m = kSnapshotVersion;
+    header.byte_order_m = kSnapshotByteOrder;
+    header.element_size_m = sizeof(DataType);
+    header.element_alignment_m = alignof(DataType);
+    header.element_count_m = element_count;
+    header.chunck_count_m = chunck_count;
+
+    uint64_t table_end = sizeof(SnapshotHeader) + chunck_count * sizeof(uint64_t);
+    header.payload_offset_m = (table_end + kPayloadAlignment - 1) / kPayloadAlignment * kPayloadAlignment;
+    return header;
+}
+
+
+/* Throws std::runtime_error unless a file of file_bytes with this header keeps DataType elements which end the file */
+template<typename DataType>
+void CheckSnapshotHeader(const SnapshotHeader& header, uint64_t file_bytes) {
+    if (std::memcmp(header.magic_m, kSnapshotMagic, sizeof(kSnapshotMagic)) != 0) {
+        throw std::runtime_error{"unrolled_list snapshot: not a snapshot file"};
+    }
+    if (header.byte_order_m != kSnapshotByteOrder) {
+        throw std::runtime_error{"unrolled_list snapshot: written with another byte order"};
+    }
+    if (header.version_m != kSnapshotVersion) {
+        throw std::runtime_error{"unrolled_list snapshot: unsupported version"};
+    }
+    if (header.element_size_m != sizeof(DataType) || header.element_alignment_m != alignof(DataType)) {
+        throw std::runtime_error{"unrolled_list snapshot: written for another element type"};
+    }
+
+    uint64_t table_end = sizeof(SnapshotHeader) + header.chunck_count_m * sizeof(uint64_t);
+    if (header.chunck_count_m > file_bytes / sizeof(uint64_t) || header.payload_offset_m < table_end
+        || header.payload_offset_m % alignof(DataType) != 0 || header.payload_offset_m > file_bytes
+        || header.element_count_m > (file_bytes - header.payload_offset_m) / sizeof(DataType)) {
+        throw std::runtime_error{"unrolled_list snapshot: file is truncated"};
+    }
+    if (file_bytes - header.payload_offset_m != header.element_count_m * sizeof(DataType)) {
+        throw std::runtime_error{"unrolled_list snapshot: the elements do not match the file length"};
+    }
+}
+
+
+/* Owning POSIX file descriptor, throws std::system_error when the file does not open */
+class FileDescriptor {
+  public:
+    FileDescriptor(const std::filesystem::path& path, int flags, mode_t mode = 0644) {
+        do {
+            fd_m = ::open(path.c_str(), flags | O_CLOEXEC, mode);
+        } while (fd_m == -1 && errno == EINTR);
+
+        if (fd_m == -1) {
+            throw std::system_error{errno, std::generic_category(), "unrolled_list snapshot: cannot open " + path.string()};
+        }
+    };
+
+    FileDescriptor(const FileDescriptor&) = delete;
+    FileDescriptor& operator=(const FileDescriptor&) = delete;
+
+    ~FileDescriptor() noexcept {
+        ::close(fd_m);
+    };
+
+  public:
+    int get() const noexcept { return fd_m; };
+
+    uint64_t file_size() const {
+        struct stat file_stat;
+        if (::fstat(fd_m, &file_stat) == -1) {
+            throw std::system_error{errno, std::generic_category(), "unrolled_list snapshot: fstat"};
+        }
+        return static_cast<uint64_t>(file_stat.st_size);
+    };
+
+  private:
+    int fd_m = -1;
+};
+
+
+/* Syncs the directory of path, a file renamed there stays renamed after a crash */
+inline void SyncParentDirectory(const std::filesystem::path& path) {
+    std::filesystem::path directory = path.parent_path();
+    FileDescriptor directory_file(directory.empty() ? std::filesystem::path{"."} : directory, O_RDONLY | O_DIRECTORY);
+
+    if (::fsync(directory_file.get()) == -1) {
+        throw std::system_error{errno, std::generic_category(), "unrolled_list snapshot: fsync of " + directory.string()};
+    }
+}
+
+
+/* Moves the whole of every buffer, resumes after partial transfers and EINTR */
+template<typename TransferType>
+void TransferFull(TransferType transfer, iovec* buffers, size_t count, const char* what) {
+    while (count) {
+        ssize_t transferred = transfer(buffers, static_cast<int>(std::min(count, kSnapshotIoBatch)));
+        if (transferred == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw std::system_error{errno, std::generic_category(), what};
+        }
+        if (transferred == 0) {
+            throw std::runtime_error{"unrolled_list snapshot: file is truncated"};
+        }
+
+        size_t left = static_cast<size_t>(transferred);
+        while (count && left >= buffers->iov_len) {
+            left -= buffers->iov_len;
+            ++buffers;
+            --count;
+        }
+        if (count) {
+            buffers->iov_base = static_cast<std::byte*>(buffers->iov_base) + left;
+            buffers->iov_len -= left;
+        }
+    }
+}
+
+
+inline void WriteFull(int fd, iovec* buffers, size_t count) {
+    TransferFull([fd](iovec* batch, int batch_size) { return ::writev(fd, batch, batch_size); },
+        buffers, count, "unrolled_list snapshot: writev");
+}
+
+
+inline void ReadFull(int fd, iovec* buffers, size_t count) {
+    TransferFull([fd](iovec* batch, int batch_size) { return ::readv(fd, batch, batch_size); },
+        buffers, count, "unrolled_list snapshot: readv");
+}
+
+
+/* Reads until every buffer is full or the input ends, pipes and sockets included, returns the bytes read */
+inline size_t ReadAvailable(int fd, iovec* buffers, size_t count) {
+    size_t total = 0;
+
+    while (count) {
+        ssize_t transferred = ::readv(fd, buffers, static_cast<int>(std::min(count, kSnapshotIoBatch)));
+        if (transferred == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw std::system_error{errno, std::generic_category(), "unrolled_list: readv"};
+        }
+        if (transferred == 0) {
+            break;
+        }
+
+        total += static_cast<size_t>(transferred);
+        size_t left = static_cast<size_t>(transferred);
+        while (count && left >= buffers->iov_len) {
+            left -= buffers->iov_len;
+            ++buffers;
+            --count;
+        }
+        if (count) {
+            buffers->iov_base = static_cast<std::byte*>(buffers->iov_base) + left;
+            buffers->iov_len -= left;
+        }
+    }
+
+    return total;
+}
+
+
+/* Writes the elements of chuncks, a range of spans over the live elements of every chunck, kSnapshotIoBatch chuncks per writev */
+template<typename DataType, typename ChunckRangeType>
+void WritePayloads(int fd, const ChunckRangeType& chuncks) {
+    iovec payloads[kSnapshotIoBatch];
+    size_t batch_size = 0;
+    for (auto chunck : chuncks) {
+        payloads[batch_size++] = iovec{const_cast<DataType*>(chunck.data()), chunck.size_bytes()};
+        if (batch_size == kSnapshotIoBatch) {
+            WriteFull(fd, payloads, batch_size);
+            batch_size = 0;
+        }
+    }
+    WriteFull(fd, payloads, batch_size);
+}
+
+
+/*
+    Writes a snapshot of chuncks, a range of spans over the live elements of every chunck.
+    The chunck table goes out kSnapshotIoBatch entries per write,
+    the payloads are gathered straight from the chuncks, kSnapshotIoBatch chuncks per writev.
+*/
+template<typename DataType, typename ChunckRangeType>
+void WriteSnapshot(int fd, const ChunckRangeType& chuncks, uint64_t element_count) {
+    static constexpr std::byte kPadding[kCacheLineSize] = {};
+
+    uint64_t chunck_count = 0;
+    for ([[maybe_unused]] auto chunck : chuncks) {
+        ++chunck_count;
+    }
+
+    SnapshotHeader header = MakeSnapshotHeader<DataType>(element_count, chunck_count);
+    iovec header_buffer{&header, sizeof(header)};
+    WriteFull(fd, &header_buffer, 1);
+
+    uint64_t chunck_table[kSnapshotIoBatch];
+    iovec table_buffer{chunck_table, 0};
+    for (auto chunck : chuncks) {
+        chunck_table[table_buffer.iov_len / sizeof(uint64_t)] = chunck.size();
+        table_buffer.iov_len += sizeof(uint64_t);
+        if (table_buffer.iov_len == sizeof(chunck_table)) {
+            WriteFull(fd, &table_buffer, 1);
+            table_buffer = iovec{chunck_table, 0};
+        }
+    }
+    WriteFull(fd, &table_buffer, table_buffer.iov_len ? 1 : 0);
+
+    uint64_t padding_bytes = header.payload_offset_m - sizeof(SnapshotHeader) - chunck_count * sizeof(uint64_t);
+    while (padding_bytes) {
+        iovec padding_buffer{const_cast<std::byte*>(kPadding), std::min<uint64_t>(padding_bytes, sizeof(kPadding))};
+        padding_bytes -= padding_buffer.iov_len;
+        WriteFull(fd, &padding_buffer, 1);
+    }
+
+    WritePayloads<DataType>(fd, chuncks);
+}
+
+
+/*
+    Reads and checks the header, leaves the file positioned at the first element.
+    The chunck table has to add up to the element count, the table is read kSnapshotIoBatch entries at a time.
+*/
+template<typename DataType>
+SnapshotHeader ReadSnapshotHeader(const FileDescriptor& file) {
+    SnapshotHeader header;
+    iovec header_buffer{&header, sizeof(header)};
+    ReadFull(file.get(), &header_buffer, 1);
+
+    CheckSnapshotHeader<DataType>(header, file.file_size());
+
+    uint64_t chunck_table[kSnapshotIoBatch];
+    uint64_t table_count = 0;
+    for (uint64_t left = header.chunck_count_m; left;) {
+        uint64_t batch_size = std::min<uint64_t>(left, kSnapshotIoBatch);
+        iovec table_buffer{chunck_table, batch_size * sizeof(uint64_t)};
+        ReadFull(file.get(), &table_buffer, 1);
+
+        for (uint64_t ind = 0; ind != batch_size; ++ind) {
+            if (chunck_table[ind] > header.element_count_m - table_count) {
+                throw std::runtime_error{"unrolled_list snapshot: chunck table does not match the element count"};
+            }
+            table_count += chunck_table[ind];
+        }
+        left -= batch_size;
+    }
+    if (table_count != header.element_count_m) {
+        throw std::runtime_error{"unrolled_list snapshot: chunck table does not match the element count"};
+    }
+
+    if (::lseek(file.get(), static_cast<off_t>(header.payload_offset_m), SEEK_SET) == -1) {
+        throw std::system_error{errno, std::generic_category(), "unrolled_list snapshot: lseek"};
+    }
+    return header;
+}
+
+} // namespace details
+
+} // namespace labwork7
+
+#endif // _UNROLLED_LIST_BINARY_SNAPSHOT_HPP_
@@ -0,0 +1,389 @@
+#ifndef _UNROLLED_LIST_CHECKPOINT_LOG_HPP_
+#define _UNROLLED_LIST_CHECKPOINT_LOG_HPP_
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+#include <unistd.h>
+
+#include "binary_snapshot.hpp"
+#include "storage.hpp"
+
+namespace labwork7 {
+
+namespace details {
+
+/*
+    Journal state of a chunck: an identity which survives splits, merges and borrows
+    of its neighbours, the links of the dirty list, which keeps the chuncks changed since the last checkpoint,
+    and the link of the id table a log is replayed with.
+*/
+template<typename DataType, size_t kSize>
+struct JournalChunckLinks {
+    using node_t = UnrolledListNodeChunck<DataType, kSize, JournalChunckLinks>;
+
+    uint64_t chunck_id_m = 0;
+    node_t* prev_dirty_ptr_m = nullptr;
+    node_t* next_dirty_ptr_m = nullptr;
+    node_t* next_by_id_ptr_m = nullptr;
+    bool is_dirty_m = false;
+};
+
+
+template<typename node_t>
+class dirty_chunck_list {
+  public:
+    dirty_chunck_list() noexcept = default;
+
+    dirty_chunck_list(const dirty_chunck_list&) = delete;
+    dirty_chunck_list& operator=(const dirty_chunck_list&) = delete;
+
+    dirty_chunck_list(dirty_chunck_list&& value) noexcept
+        : head_m(std::exchange(value.head_m, nullptr)) {  };
+
+    dirty_chunck_list& operator=(dirty_chunck_list&& value) noexcept {
+        std::swap(head_m, value.head_m);
+        return *this;
+    };
+
+  public:
+    node_t* Head() const noexcept { return head_m; };
+
+    void Mark(node_t* current_chunck) noexcept {
+        auto& links = current_chunck->extension_m;
+        if (links.is_dirty_m) {
+            return;
+        }
+
+        links.is_dirty_m = true;
+        links.prev_dirty_ptr_m = nullptr;
+        links.next_dirty_ptr_m = head_m;
+        if (head_m) {
+            head_m->extension_m.prev_dirty_ptr_m = current_chunck;
+        }
+        head_m = current_chunck;
+    };
+
+    void Unmark(node_t* current_chunck) noexcept {
+        auto& links = current_chunck->extension_m;
+        if (!links.is_dirty_m) {
+            return;
+        }
+
+        if (links.prev_dirty_ptr_m) {
+            links.prev_dirty_ptr_m->extension_m.next_dirty_ptr_m = links.next_dirty_ptr_m;
+        } else {
+            head_m = links.next_dirty_ptr_m;
+        }
+        if (links.next_dirty_ptr_m) {
+            links.next_dirty_ptr_m->extension_m.prev_dirty_ptr_m = links.prev_dirty_ptr_m;
+        }
+
+        links.is_dirty_m = false;
+        links.prev_dirty_ptr_m = links.next_dirty_ptr_m = nullptr;
+    };
+
+    /* Unmarks every chunck, O(dirty chuncks) */
+    void Reset() noexcept {
+        while (head_m) {
+            Unmark(head_m);
+        }
+    };
+
+  private:
+    node_t* head_m = nullptr;
+};
+
+
+/*
+    Table of the chuncks by their ids, which a log is replayed with, chained through next_by_id_ptr_m.
+    Ids are handed out one after another, so the low bits of an id pick its bucket.
+    The buckets come from the allocator of the list, their count is a power of 2 and doubles with the chuncks.
+*/
+template<typename node_t, typename AllocatorType>
+class chunck_id_table {
+  private:
+    using bucket_allocator_type = typename std::allocator_traits<AllocatorType>::template rebind_alloc<node_t*>;
+    using bucket_trait_t = std::allocator_traits<bucket_allocator_type>;
+    static constexpr size_t kMinBucketCount = 64;
+
+  public:
+    explicit chunck_id_table(const AllocatorType& alloc) : alloc_m(alloc) {  };
+
+    chunck_id_table(const chunck_id_table&) = delete;
+    chunck_id_table& operator=(const chunck_id_table&) = delete;
+
+    ~chunck_id_table() noexcept {
+        if (buckets_m) {
+            bucket_trait_t::deallocate(alloc_m, buckets_m, bucket_count_m);
+        }
+    };
+
+  public:
+    node_t* Find(uint64_t chunck_id) const noexcept {
+        if (!bucket_count_m) {
+            return nullptr;
+        }
+
+        node_t* current = Bucket(chunck_id);
+        while (current && current->extension_m.chunck_id_m != chunck_id) {
+            current = current->extension_m.next_by_id_ptr_m;
+        }
+        return current;
+    };
+
+    /* Grows before the chunck is linked, so it is left out when the growth throws */
+    void Insert(node_t* chunck) {
+        if (count_m == bucket_count_m) {
+            Rehash(bucket_count_m ? 2 * bucket_count_m : kMinBucketCount);
+        }
+
+        node_t*& bucket = Bucket(chunck->extension_m.chunck_id_m);
+        chunck->extension_m.next_by_id_ptr_m = bucket;
+        bucket = chunck;
+        ++count_m;
+    };
+
+    void Erase(node_t* chunck) noexcept {
+        node_t** link = &Bucket(chunck->extension_m.chunck_id_m);
+        while (*link && *link != chunck) {
+            link = &(*link)->extension_m.next_by_id_ptr_m;
+        }
+        if (*link) {
+            *link = chunck->extension_m.next_by_id_ptr_m;
+            chunck->extension_m.next_by_id_ptr_m = nullptr;
+            --count_m;
+        }
+    };
+
+    /* Forgets the chuncks, the buckets are kept */
+    void Clear() noexcept {
+        std::fill_n(std::to_address(buckets_m), bucket_count_m, nullptr);
+        count_m = 0;
+    };
+
+  private:
+    node_t*& Bucket(uint64_t chunck_id) const noexcept {
+        return std::to_address(buckets_m)[chunck_id & (bucket_count_m - 1)];
+    };
+
+    void Rehash(size_t bucket_count) {
+        typename bucket_trait_t::pointer buckets = bucket_trait_t::allocate(alloc_m, bucket_count);
+        std::fill_n(std::to_address(buckets), bucket_count, nullptr);
+
+        for (size_t ind = 0; ind != bucket_count_m; ++ind) {
+            node_t* current = std::to_address(buckets_m)[ind];
+            while (current) {
+                node_t* next_chunck = current->extension_m.next_by_id_ptr_m;
+                node_t*& bucket = std::to_address(buckets)[current->extension_m.chunck_id_m & (bucket_count - 1)];
+                current->extension_m.next_by_id_ptr_m = bucket;
+                bucket = current;
+                current = next_chunck;
+            }
+        }
+
+        if (buckets_m) {
+            bucket_trait_t::deallocate(alloc_m, buckets_m, bucket_count_m);
+        }
+        buckets_m = buckets;
+        bucket_count_m = bucket_count;
+    };
+
+  private:
+    [[no_unique_address]] bucket_allocator_type alloc_m;
+    typename bucket_trait_t::pointer buckets_m = nullptr;
+    size_t bucket_count_m = 0;
+    size_t count_m = 0;
+};
+
+
+struct Crc32Table {
+    uint32_t values_m[256];
+};
+
+
+inline constexpr Crc32Table kCrc32Table = [] {
+    Crc32Table table{};
+    for (uint32_t byte = 0; byte != 256; ++byte) {
+        uint32_t value = byte;
+        for (int bit = 0; bit != 8; ++bit) {
+            value = value & 1 ? (value >> 1) ^ 0xEDB88320 : value >> 1;
+        }
+        table.values_m[byte] = value;
+    }
+    return table;
+}();
+
+
+/* CRC-32 of IEEE 802.3, continues crc of the bytes before, which is 0 for none */
+inline uint32_t Crc32(uint32_t crc, const void* bytes, size_t size) noexcept {
+    const unsigned char* current = static_cast<const unsigned char*>(bytes);
+    crc = ~crc;
+    for (; size; --size, ++current) {
+        crc = kCrc32Table.values_m[(crc ^ *current) & 0xff] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+
+/*
+    Append-only checkpoint log, every record is
+        CheckpointRecordHeader
+        run_count_m times:
+            CheckpointRun                                   the chain between two chuncks is replaced by the run
+            chunck_count_m times: CheckpointChunck and its elements
+        CheckpointRecordTrailer                             CRC-32 of the header and the body, the commit
+
+    Chunck ids 0 stand for the ends of the chain. A record with kCheckpointReset drops the previous state first.
+    Chuncks which left the chain lay between the bounds of some run, replacing the run cuts them out.
+    A record without a matching commit or checksum is a torn write and ends the log,
+    the commit can reach the disk before the body, the checksum catches that.
+*/
+inline constexpr char kCheckpointMagic[8] = {'U', 'L', 'C', 'K', 'P', 'T', '\0', '\0'};
+inline constexpr uint32_t kCheckpointVersion = 2;
+inline constexpr uint64_t kCheckpointReset = 1;
+inline constexpr uint64_t kCheckpointCommitMark = 0x636f6d6d69746564;
+
+
+struct CheckpointRecordHeader {
+    char magic_m[8];
+    uint32_t version_m;
+    uint32_t byte_order_m;
+    uint64_t element_size_m;
+    uint64_t sequence_m;
+    uint64_t flags_m;
+    uint64_t run_count_m;
+    uint64_t body_bytes_m;
+};
+
+
+struct CheckpointRun {
+    uint64_t left_id_m;
+    uint64_t right_id_m;
+    uint64_t chunck_count_m;
+};
+
+
+struct CheckpointChunck {
+    uint64_t chunck_id_m;
+    uint64_t element_count_m;
+};
+
+
+struct CheckpointRecordTrailer {
+    uint64_t checksum_m;
+    uint64_t commit_m;
+};
+
+
+template<typename DataType>
+CheckpointRecordHeader MakeCheckpointHeader(uint64_t sequence, uint64_t flags) noexcept {
+    CheckpointRecordHeader header{};
+    std::memcpy(header.magic_m, kCheckpointMagic, sizeof(kCheckpointMagic));
+    header.version_m = kCheckpointVersion;
+    header.byte_order_m = kSnapshotByteOrder;
+    header.element_size_m = sizeof(DataType);
+    header.sequence_m = sequence;
+    header.flags_m = flags;
+    return header;
+}
+
+
+inline bool IsCheckpointHeader(const CheckpointRecordHeader& header) noexcept {
+    return std::memcmp(header.magic_m, kCheckpointMagic, sizeof(kCheckpointMagic)) == 0
+        && header.byte_order_m == kSnapshotByteOrder && header.version_m == kCheckpointVersion;
+}
+
+
+/* Sequential reader of a log through a block buffer, reads past the end throw std::runtime_error */
+class LogReader {
+  public:
+    static constexpr size_t kBlockBytes = size_t{1} << 20;
+
+  public:
+    LogReader(int fd, uint64_t file_bytes)
+        : fd_m(fd), file_bytes_m(file_bytes), block_m(std::make_unique_for_overwrite<std::byte[]>(kBlockBytes)) {  };
+
+  public:
+    uint64_t Offset() const noexcept { return offset_m; };
+    uint64_t Remaining() const noexcept { return file_bytes_m - offset_m; };
+
+    void Read(void* buffer, size_t bytes) {
+        std::byte* output = static_cast<std::byte*>(buffer);
+
+        while (bytes) {
+            if (offset_m < block_offset_m || offset_m >= block_offset_m + block_size_m) {
+                Fill(offset_m);
+            }
+
+            size_t copied = std::min<uint64_t>(bytes, block_offset_m + block_size_m - offset_m);
+            std::memcpy(output, block_m.get() + (offset_m - block_offset_m), copied);
+            output += copied;
+            offset_m += copied;
+            bytes -= copied;
+        }
+    };
+
+    /* Continues crc with the next bytes without moving the reader, a record which fits the block is read once */
+    uint32_t Checksum(uint64_t bytes, uint32_t crc) {
+        uint64_t offset = offset_m;
+
+        while (bytes) {
+            if (offset < block_offset_m || offset >= block_offset_m + block_size_m) {
+                Fill(offset);
+            }
+
+            size_t counted = std::min<uint64_t>(bytes, block_offset_m + block_size_m - offset);
+            crc = Crc32(crc, block_m.get() + (offset - block_offset_m), counted);
+            offset += counted;
+            bytes -= counted;
+        }
+        return crc;
+    };
+
+    /* Reads at an absolute offset without moving the reader */
+    void ReadAt(uint64_t offset, void* buffer, size_t bytes) const {
+        iovec target{buffer, bytes};
+        if (offset + bytes > file_bytes_m) {
+            throw std::runtime_error{"unrolled_list checkpoint log: file is truncated"};
+        }
+        TransferFull([this, &offset](iovec* batch, int) {
+            ssize_t transferred = ::pread(fd_m, batch->iov_base, batch->iov_len, static_cast<off_t>(offset));
+            offset += transferred > 0 ? transferred : 0;
+            return transferred;
+        }, &target, 1, "unrolled_list checkpoint log: pread");
+    };
+
+  private:
+    void Fill(uint64_t offset) {
+        if (offset >= file_bytes_m) {
+            throw std::runtime_error{"unrolled_list checkpoint log: file is truncated"};
+        }
+
+        block_offset_m = offset;
+        block_size_m = std::min<uint64_t>(kBlockBytes, file_bytes_m - offset);
+        ReadAt(block_offset_m, block_m.get(), block_size_m);
+    };
+
+  private:
+    int fd_m;
+    uint64_t file_bytes_m;
+    uint64_t offset_m = 0;
+
+    std::unique_ptr<std::byte[]> block_m;
+    uint64_t block_offset_m = 0;
+    uint64_t block_size_m = 0;
+};
+
+} // namespace details
+
+} // namespace labwork7
+
+#endif // _UNROLLED_LIST_CHECKPOINT_LOG_HPP_
@@ -0,0 +1,110 @@
+#ifndef _UNROLLED_LIST_CHUNCK_VIEW_HPP_
+#define _UNROLLED_LIST_CHUNCK_VIEW_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <span>
+
+namespace labwork7 {
+
+namespace details {
+
+/*
+    Bidirectional iterator over the chuncks of a list, dereferences to a span over the live elements of a chunck.
+    last_chunck_ptr_m lets the past-the-end iterator step back onto the last chunck.
+*/
+template<typename node_t, typename SpanType>
+class ChunckIterator {
+  public:
+    using value_type = SpanType;
+    using reference = SpanType;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::bidirectional_iterator_tag;
+    using iterator_concept = std::bidirectional_iterator_tag;
+
+  private:
+    using node_ptr_t = typename node_t::node_ptr_t;
+
+  public:
+    ChunckIterator() noexcept = default;
+    ChunckIterator(node_ptr_t chunck_ptr, node_ptr_t last_chunck_ptr) noexcept
+        : chunck_ptr_m(chunck_ptr), last_chunck_ptr_m(last_chunck_ptr) {  };
+
+  public:
+    ChunckIterator& operator++() noexcept {
+        chunck_ptr_m = chunck_ptr_m->next_chunck_ptr_m;
+        return *this;
+    };
+
+    ChunckIterator operator++(int) noexcept {
+        ChunckIterator result_itr = *this;
+        ++(*this);
+        return result_itr;
+    };
+
+    ChunckIterator& operator--() noexcept {
+        chunck_ptr_m = chunck_ptr_m ? chunck_ptr_m->prev_chunck_ptr_m : last_chunck_ptr_m;
+        return *this;
+    };
+
+    ChunckIterator operator--(int) noexcept {
+        ChunckIterator result_itr = *this;
+        --(*this);
+        return result_itr;
+    };
+
+    reference operator*() const noexcept {
+        return reference{static_cast<typename SpanType::pointer>(chunck_ptr_m->data_m), chunck_ptr_m->size_m};
+    };
+
+    bool operator==(const ChunckIterator& value) const noexcept {
+        return chunck_ptr_m == value.chunck_ptr_m;
+    };
+
+  private:
+    node_ptr_t chunck_ptr_m = nullptr;
+    node_ptr_t last_chunck_ptr_m = nullptr;
+};
+
+
+template<typename node_t, typename SpanType>
+class chunck_view : public std::ranges::view_interface<chunck_view<node_t, SpanType>> {
+  public:
+    using iterator = ChunckIterator<node_t, SpanType>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+
+  private:
+    using node_ptr_t = typename node_t::node_ptr_t;
+
+  public:
+    chunck_view() noexcept = default;
+    chunck_view(node_ptr_t begin_chunck_ptr, node_ptr_t end_chunck_ptr) noexcept
+        : begin_chunck_ptr_m(begin_chunck_ptr), end_chunck_ptr_m(end_chunck_ptr) {  };
+
+  public:
+    iterator begin() const noexcept { return iterator{begin_chunck_ptr_m, end_chunck_ptr_m}; };
+    iterator end() const noexcept { return iterator{nullptr, end_chunck_ptr_m}; };
+
+    reverse_iterator rbegin() const noexcept { return reverse_iterator{end()}; };
+    reverse_iterator rend() const noexcept { return reverse_iterator{begin()}; };
+
+  private:
+    node_ptr_t begin_chunck_ptr_m = nullptr;
+    node_ptr_t end_chunck_ptr_m = nullptr;
+};
+
+
+} // namespace details
+
+} // namespace labwork7
+
+
+namespace std::ranges {
+
+template<typename node_t, typename SpanType>
+inline constexpr bool enable_borrowed_range<labwork7::details::chunck_view<node_t, SpanType>> = true;
+
+} // namespace std::ranges
+
+#endif // _UNROLLED_LIST_CHUNCK_VIEW_HPP_
@@ -0,0 +1,315 @@
+#ifndef _UNROLLED_LIST_COUNTED_INDEX_HPP_
+#define _UNROLLED_LIST_COUNTED_INDEX_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "storage.hpp"
+
+namespace labwork7 {
+
+namespace details {
+
+/*
+    Links of a chunck inside the counted index.
+    The index is a treap ordered the same way as the chunck chain,
+    every vertex keeps the amount of elements stored in its subtree.
+*/
+template<typename DataType, size_t kSize>
+struct CountedChunckLinks {
+    using node_t = UnrolledListNodeChunck<DataType, kSize, CountedChunckLinks>;
+
+    node_t* parent_m = nullptr;
+    node_t* left_m = nullptr;
+    node_t* right_m = nullptr;
+    size_t subtree_size_m = 0;
+    uint64_t priority_m = 0;
+};
+
+
+template<typename node_t>
+class counted_chunck_index {
+  public:
+    using size_type = std::size_t;
+
+  public:
+    counted_chunck_index() noexcept = default;
+
+    counted_chunck_index(const counted_chunck_index&) = delete;
+    counted_chunck_index& operator=(const counted_chunck_index&) = delete;
+
+    counted_chunck_index(counted_chunck_index&& value) noexcept
+        : root_m(std::exchange(value.root_m, nullptr)), seed_m(value.seed_m) {  };
+
+    counted_chunck_index& operator=(counted_chunck_index&& value) noexcept {
+        std::swap(root_m, value.root_m);
+        std::swap(seed_m, value.seed_m);
+        return *this;
+    };
+
+  public:
+    void Reset() noexcept { root_m = nullptr; };
+
+    size_type Size() const noexcept { return SubtreeSize(root_m); };
+
+
+    void Attach(node_t* current_chunck, node_t* after_chunck) noexcept {
+        auto& links = current_chunck->extension_m;
+        links.left_m = links.right_m = links.parent_m = nullptr;
+        links.subtree_size_m = current_chunck->size_m;
+        links.priority_m = NextPriority();
+
+        if (!root_m) {
+            root_m = current_chunck;
+            return;
+        }
+
+        node_t* parent = nullptr;
+        if (!after_chunck) {
+            parent = Leftmost(root_m);
+            parent->extension_m.left_m = current_chunck;
+        } else if (!after_chunck->extension_m.right_m) {
+            parent = after_chunck;
+            parent->extension_m.right_m = current_chunck;
+        } else {
+            parent = Leftmost(after_chunck->extension_m.right_m);
+            parent->extension_m.left_m = current_chunck;
+        }
+
+        links.parent_m = parent;
+        for (node_t* current = parent; current; current = current->extension_m.parent_m) {
+            current->extension_m.subtree_size_m += current_chunck->size_m;
+        }
+
+        while (links.parent_m && links.parent_m->extension_m.priority_m < links.priority_m) {
+            RotateUp(current_chunck);
+        }
+    };
+
+
+    void Detach(node_t* current_chunck) noexcept {
+        auto& links = current_chunck->extension_m;
+
+        while (links.left_m && links.right_m) {
+            if (links.left_m->extension_m.priority_m > links.right_m->extension_m.priority_m) {
+                RotateUp(links.left_m);
+            } else {
+                RotateUp(links.right_m);
+            }
+        }
+
+        node_t* child = links.left_m ? links.left_m : links.right_m;
+        node_t* parent = links.parent_m;
+
+        if (child) {
+            child->extension_m.parent_m = parent;
+        }
+        ReplaceChild(parent, current_chunck, child);
+
+        for (node_t* current = parent; current; current = current->extension_m.parent_m) {
+            Recalculate(current);
+        }
+
+        links = {};
+    };
+
+
+    /*
+        Detaches the chuncks of the chain from first_chunck to last_chunck in O(log(N / K)),
+        their own links are left as they are, Attach resets them.
+    */
+    void DetachRange(node_t* first_chunck, node_t* last_chunck) noexcept {
+        size_type begin_rank = Rank(first_chunck);
+        size_type end_rank = Rank(last_chunck) + last_chunck->size_m;
+
+        auto [left, rest] = Split(root_m, begin_rank);
+        node_t* right = Split(rest, end_rank - begin_rank).second;
+
+        root_m = Merge(left, right);
+        if (root_m) {
+            root_m->extension_m.parent_m = nullptr;
+        }
+    };
+
+
+    void Refresh(node_t* current_chunck) noexcept {
+        for (node_t* current = current_chunck; current; current = current->extension_m.parent_m) {
+            Recalculate(current);
+        }
+    };
+
+
+    std::pair<node_t*, size_type> Locate(size_type index) const noexcept {
+        node_t* current = root_m;
+
+        while (current) {
+            size_type left_size = SubtreeSize(current->extension_m.left_m);
+
+            if (index < left_size) {
+                current = current->extension_m.left_m;
+            } else if (index - left_size < current->size_m) {
+                return {current, index - left_size};
+            } else {
+                index -= left_size + current->size_m;
+                current = current->extension_m.right_m;
+            }
+        }
+
+        return {nullptr, 0};
+    };
+
+
+    size_type Rank(const node_t* current_chunck) const noexcept {
+        size_type result = SubtreeSize(current_chunck->extension_m.left_m);
+
+        for (const node_t* current = current_chunck; current->extension_m.parent_m;
+          current = current->extension_m.parent_m) {
+            const node_t* parent = current->extension_m.parent_m;
+
+            if (parent->extension_m.right_m == current) {
+                result += SubtreeSize(parent->extension_m.left_m) + parent->size_m;
+            }
+        }
+
+        return result;
+    };
+
+  private:
+    static size_type SubtreeSize(const node_t* current_chunck) noexcept {
+        return current_chunck ? current_chunck->extension_m.subtree_size_m : 0;
+    };
+
+
+    static void Recalculate(node_t* current_chunck) noexcept {
+        current_chunck->extension_m.subtree_size_m = current_chunck->size_m
+            + SubtreeSize(current_chunck->extension_m.left_m)
+            + SubtreeSize(current_chunck->extension_m.right_m);
+    };
+
+
+    static node_t* Leftmost(node_t* current_chunck) noexcept {
+        while (current_chunck->extension_m.left_m) {
+            current_chunck = current_chunck->extension_m.left_m;
+        }
+        return current_chunck;
+    };
+
+
+    static void SetLeft(node_t* parent, node_t* child) noexcept {
+        parent->extension_m.left_m = child;
+        if (child) {
+            child->extension_m.parent_m = parent;
+        }
+    };
+
+
+    static void SetRight(node_t* parent, node_t* child) noexcept {
+        parent->extension_m.right_m = child;
+        if (child) {
+            child->extension_m.parent_m = parent;
+        }
+    };
+
+
+    /* Splits a subtree into the chuncks keeping its first count elements and the rest, count falls between chuncks */
+    static std::pair<node_t*, node_t*> Split(node_t* current_chunck, size_type count) noexcept {
+        if (!current_chunck) {
+            return {nullptr, nullptr};
+        }
+
+        size_type left_size = SubtreeSize(current_chunck->extension_m.left_m);
+        if (count <= left_size) {
+            auto [left, right] = Split(current_chunck->extension_m.left_m, count);
+            SetLeft(current_chunck, right);
+            Recalculate(current_chunck);
+            if (left) {
+                left->extension_m.parent_m = nullptr;
+            }
+            return {left, current_chunck};
+        }
+
+        auto [left, right] = Split(current_chunck->extension_m.right_m, count - left_size - current_chunck->size_m);
+        SetRight(current_chunck, left);
+        Recalculate(current_chunck);
+        if (right) {
+            right->extension_m.parent_m = nullptr;
+        }
+        return {current_chunck, right};
+    };
+
+
+    /* Joins two subtrees, all the chuncks of left go before the chuncks of right */
+    static node_t* Merge(node_t* left, node_t* right) noexcept {
+        if (!left || !right) {
+            return left ? left : right;
+        }
+
+        if (left->extension_m.priority_m > right->extension_m.priority_m) {
+            SetRight(left, Merge(left->extension_m.right_m, right));
+            Recalculate(left);
+            return left;
+        }
+
+        SetLeft(right, Merge(left, right->extension_m.left_m));
+        Recalculate(right);
+        return right;
+    };
+
+
+    void ReplaceChild(node_t* parent, node_t* old_child, node_t* new_child) noexcept {
+        if (!parent) {
+            root_m = new_child;
+        } else if (parent->extension_m.left_m == old_child) {
+            parent->extension_m.left_m = new_child;
+        } else {
+            parent->extension_m.right_m = new_child;
+        }
+    };
+
+
+    void RotateUp(node_t* current_chunck) noexcept {
+        node_t* parent = current_chunck->extension_m.parent_m;
+        node_t* grand_parent = parent->extension_m.parent_m;
+
+        if (parent->extension_m.left_m == current_chunck) {
+            parent->extension_m.left_m = current_chunck->extension_m.right_m;
+            if (parent->extension_m.left_m) {
+                parent->extension_m.left_m->extension_m.parent_m = parent;
+            }
+            current_chunck->extension_m.right_m = parent;
+        } else {
+            parent->extension_m.right_m = current_chunck->extension_m.left_m;
+            if (parent->extension_m.right_m) {
+                parent->extension_m.right_m->extension_m.parent_m = parent;
+            }
+            current_chunck->extension_m.left_m = parent;
+        }
+
+        parent->extension_m.parent_m = current_chunck;
+        current_chunck->extension_m.parent_m = grand_parent;
+        ReplaceChild(grand_parent, parent, current_chunck);
+
+        Recalculate(parent);
+        Recalculate(current_chunck);
+    };
+
+
+    uint64_t NextPriority() noexcept {
+        uint64_t value = (seed_m += 0x9e3779b97f4a7c15ull);
+        value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+        value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+        return value ^ (value >> 31);
+    };
+
+  private:
+    node_t* root_m = nullptr;
+    uint64_t seed_m = 0;
+};
+
+
+} // namespace details
+
+} // namespace labwork7
+
+#endif // _UNROLLED_LIST_COUNTED_INDEX_HPP_
@@ -0,0 +1,200 @@
+#ifndef _UNROLLED_LIST_DETAILS_HAZARD_POINTERS_HPP_
+#define _UNROLLED_LIST_DETAILS_HAZARD_POINTERS_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "storage.hpp"
+
+namespace labwork7 {
+
+namespace details {
+
+/*
+    Hazard pointers over chuncks. A thread holds a record for the time of a single operation,
+    publishes in it the chuncks it is going to touch and retires the chuncks it has unlinked.
+    A retired chunck is handed to reclaim once no record publishes it any more.
+    Retired chuncks are chained through prev_chunck_ptr_m, so retiring allocates nothing.
+*/
+template<typename NodeType, size_t kHazardCount = 2>
+class HazardPointerDomain {
+  private:
+    struct alignas(kCacheLineSize) Record {
+        std::atomic<NodeType*> hazards_m[kHazardCount] = {};
+        std::atomic<bool> is_active_m = false;
+        Record* next_record_m = nullptr;
+
+        /* owned by the thread which holds the record */
+        NodeType* retired_chunck_ptr_m = nullptr;
+        size_t retired_count_m = 0;
+    };
+
+
+    struct RecordHint {
+        uint64_t domain_id_m = 0;
+        Record* record_m = nullptr;
+    };
+
+  public:
+    class Guard {
+      public:
+        explicit Guard(HazardPointerDomain& domain) : domain_m(domain), record_m(domain.AcquireRecord()) {  };
+
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+
+        ~Guard() {
+            for (auto& hazard : record_m->hazards_m) {
+                hazard.store(nullptr, std::memory_order_release);
+            }
+            record_m->is_active_m.store(false, std::memory_order_release);
+        };
+
+
+        /* Publishes the chunck source points to, the result stays alive until the slot changes */
+        NodeType* Protect(size_t slot, const std::atomic<NodeType*>& source) noexcept {
+            NodeType* chunck = source.load(std::memory_order_acquire);
+
+            while (true) {
+                record_m->hazards_m[slot].store(chunck);
+
+                NodeType* reloaded = source.load();
+                if (reloaded == chunck) {
+                    return chunck;
+                }
+                chunck = reloaded;
+            }
+        };
+
+
+        void Clear(size_t slot) noexcept {
+            record_m->hazards_m[slot].store(nullptr, std::memory_order_release);
+        };
+
+
+        /* chunck has to be unreachable for the threads which start protecting afterwards */
+        template<typename ReclaimType>
+        void Retire(NodeType* chunck, ReclaimType&& reclaim) {
+            chunck->prev_chunck_ptr_m = record_m->retired_chunck_ptr_m;
+            record_m->retired_chunck_ptr_m = chunck;
+
+            if (++record_m->retired_count_m >= domain_m.ScanThreshold()) {
+                domain_m.Scan(*record_m, reclaim);
+            }
+        };
+
+      private:
+        HazardPointerDomain& domain_m;
+        Record* record_m;
+    };
+
+  public:
+    HazardPointerDomain() : id_m(next_domain_id.fetch_add(1, std::memory_order_relaxed)) {  };
+
+    HazardPointerDomain(const HazardPointerDomain&) = delete;
+    HazardPointerDomain& operator=(const HazardPointerDomain&) = delete;
+
+    ~HazardPointerDomain() {
+        for (Record* current = records_m.load(std::memory_order_acquire); current;) {
+            delete std::exchange(current, current->next_record_m);
+        }
+    };
+
+
+    /* Hands every retired chunck to reclaim, no thread may hold a guard at the moment */
+    template<typename ReclaimType>
+    void Drain(ReclaimType&& reclaim) {
+        for (Record* current = records_m.load(std::memory_order_acquire); current; current = current->next_record_m) {
+            while (current->retired_chunck_ptr_m) {
+                reclaim(std::exchange(current->retired_chunck_ptr_m, current->retired_chunck_ptr_m->prev_chunck_ptr_m));
+            }
+            current->retired_count_m = 0;
+        }
+    };
+
+  private:
+    Record* AcquireRecord() {
+        Record* hinted = record_hint.domain_id_m == id_m ? record_hint.record_m : nullptr;
+        if (hinted && TryActivate(*hinted)) {
+            return hinted;
+        }
+
+        for (Record* current = records_m.load(std::memory_order_acquire); current; current = current->next_record_m) {
+            if (TryActivate(*current)) {
+                record_hint = RecordHint{id_m, current};
+                return current;
+            }
+        }
+
+        Record* added = new Record;
+        added->is_active_m.store(true, std::memory_order_relaxed);
+        added->next_record_m = records_m.load(std::memory_order_relaxed);
+        while (!records_m.compare_exchange_weak(added->next_record_m, added,
+            std::memory_order_release, std::memory_order_relaxed)) {
+        }
+        record_count_m.fetch_add(1, std::memory_order_relaxed);
+
+        record_hint = RecordHint{id_m, added};
+        return added;
+    };
+
+
+    static bool TryActivate(Record& record) noexcept {
+        return !record.is_active_m.load(std::memory_order_relaxed)
+            && !record.is_active_m.exchange(true, std::memory_order_acquire);
+    };
+
+
+    /* Enough retired chuncks to make a pass over all hazards pay off */
+    size_t ScanThreshold() const noexcept {
+        return std::max<size_t>(16, 2 * kHazardCount * record_count_m.load(std::memory_order_relaxed));
+    };
+
+
+    template<typename ReclaimType>
+    void Scan(Record& owner, ReclaimType& reclaim) {
+        NodeType* pending = std::exchange(owner.retired_chunck_ptr_m, nullptr);
+        owner.retired_count_m = 0;
+
+        while (pending) {
+            NodeType* current = std::exchange(pending, pending->prev_chunck_ptr_m);
+
+            if (IsProtected(current)) {
+                current->prev_chunck_ptr_m = owner.retired_chunck_ptr_m;
+                owner.retired_chunck_ptr_m = current;
+                ++owner.retired_count_m;
+            } else {
+                reclaim(current);
+            }
+        }
+    };
+
+
+    bool IsProtected(const NodeType* chunck) const noexcept {
+        for (Record* current = records_m.load(std::memory_order_acquire); current; current = current->next_record_m) {
+            for (const auto& hazard : current->hazards_m) {
+                if (hazard.load() == chunck) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    };
+
+  private:
+    static inline std::atomic<uint64_t> next_domain_id = 1;
+    static inline thread_local RecordHint record_hint;
+
+    const uint64_t id_m;
+    std::atomic<Record*> records_m = nullptr;
+    std::atomic<size_t> record_count_m = 0;
+};
+
+} // namespace details
+
+} // namespace labwork7
+
+#endif // _UNROLLED_LIST_DETAILS_HAZARD_POINTERS_HPP_
@@ -0,0 +1,546 @@
+#ifndef _UNROLLED_LIST_SIMD_KERNELS_HPP_
+#define _UNROLLED_LIST_SIMD_KERNELS_HPP_
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#define UNROLLED_LIST_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+namespace labwork7 {
+
+namespace details {
+
+namespace simd {
+
+/*
+    Vectorized kernels over the contiguous data of one chunck.
+    They are used by the chunck-aware algorithms for int32_t, int64_t, float and double,
+    the instruction set is chosen once at runtime: AVX2 when the cpu supports it, SSE2 otherwise.
+
+    sum is not vectorized for floating point types: reordering the additions changes the result.
+    min/max are vectorized for integral types only, because of NaN ordering.
+*/
+template<typename DataType>
+concept kernel_type = std::same_as<DataType, int32_t> || std::same_as<DataType, int64_t>
+    || std::same_as<DataType, float> || std::same_as<DataType, double>;
+
+
+enum class isa_level {
+    kScalar,
+    kSse2,
+    kAvx2,
+};
+
+
+template<kernel_type DataType>
+struct kernel_table {
+    using wide_t = std::conditional_t<std::is_integral_v<DataType>, int64_t, DataType>;
+
+    const DataType* (*find)(const DataType*, const DataType*, DataType) = nullptr;
+    std::ptrdiff_t (*count)(const DataType*, const DataType*, DataType) = nullptr;
+
+    /* nullptr for floating point types */
+    DataType (*sum)(const DataType*, const DataType*) = nullptr;
+    wide_t (*sum_wide)(const DataType*, const DataType*) = nullptr;
+    const DataType* (*min_element)(const DataType*, const DataType*) = nullptr;
+    const DataType* (*max_element)(const DataType*, const DataType*) = nullptr;
+};
+
+
+namespace scalar {
+
+template<typename DataType>
+const DataType* Find(const DataType* first, const DataType* last, DataType value) noexcept {
+    return std::find(first, last, value);
+}
+
+
+template<typename DataType>
+std::ptrdiff_t Count(const DataType* first, const DataType* last, DataType value) noexcept {
+    return std::count(first, last, value);
+}
+
+
+template<typename DataType>
+DataType WrappingAdd(DataType lhs, DataType rhs) noexcept {
+    using unsigned_t = std::make_unsigned_t<DataType>;
+    return static_cast<DataType>(static_cast<unsigned_t>(lhs) + static_cast<unsigned_t>(rhs));
+}
+
+
+/* Wraps around on overflow the same way the vector lanes do */
+template<typename ResultType, typename DataType>
+ResultType Sum(const DataType* first, const DataType* last) noexcept {
+    using unsigned_t = std::make_unsigned_t<ResultType>;
+
+    unsigned_t result = 0;
+    for (; first != last; ++first) {
+        result += static_cast<unsigned_t>(static_cast<ResultType>(*first));
+    }
+    return static_cast<ResultType>(result);
+}
+
+
+template<typename DataType>
+const DataType* MinElement(const DataType* first, const DataType* last) noexcept {
+    return std::min_element(first, last);
+}
+
+
+template<typename DataType>
+const DataType* MaxElement(const DataType* first, const DataType* last) noexcept {
+    return std::max_element(first, last);
+}
+
+} // namespace scalar
+
+
+#ifdef UNROLLED_LIST_SIMD_X86
+
+namespace sse2 {
+
+template<typename DataType>
+struct Ops;
+
+
+template<>
+struct Ops<int32_t> {
+    using vec_t = __m128i;
+    static constexpr size_t kLanes = 4;
+
+    static vec_t Broadcast(int32_t value) noexcept { return _mm_set1_epi32(value); };
+    static vec_t Load(const int32_t* ptr) noexcept { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)); };
+    static uint32_t EqualMask(vec_t lhs, vec_t rhs) noexcept { return _mm_movemask_epi8(_mm_cmpeq_epi32(lhs, rhs)); };
+    static vec_t Zero() noexcept { return _mm_setzero_si128(); };
+    static vec_t Add(vec_t lhs, vec_t rhs) noexcept { return _mm_add_epi32(lhs, rhs); };
+    static void Store(int32_t* ptr, vec_t value) noexcept { _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), value); };
+
+    static vec_t Min(vec_t lhs, vec_t rhs) noexcept {
+        __m128i mask = _mm_cmplt_epi32(lhs, rhs);
+        return _mm_or_si128(_mm_and_si128(mask, lhs), _mm_andnot_si128(mask, rhs));
+    };
+
+    static vec_t Max(vec_t lhs, vec_t rhs) noexcept {
+        __m128i mask = _mm_cmpgt_epi32(lhs, rhs);
+        return _mm_or_si128(_mm_and_si128(mask, lhs), _mm_andnot_si128(mask, rhs));
+    };
+};
+
+
+template<>
+struct Ops<int64_t> {
+    using vec_t = __m128i;
+    static constexpr size_t kLanes = 2;
+
+    static vec_t Broadcast(int64_t value) noexcept { return _mm_set1_epi64x(value); };
+    static vec_t Load(const int64_t* ptr) noexcept { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)); };
+    static vec_t Zero() noexcept { return _mm_setzero_si128(); };
+    static vec_t Add(vec_t lhs, vec_t rhs) noexcept { return _mm_add_epi64(lhs, rhs); };
+    static void Store(int64_t* ptr, vec_t value) noexcept { _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), value); };
+
+    /* SSE2 has no 64-bit compare: both 32-bit halves have to be equal */
+    static uint32_t EqualMask(vec_t lhs, vec_t rhs) noexcept {
+        __m128i halves = _mm_cmpeq_epi32(lhs, rhs);
+        return _mm_movemask_epi8(_mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1))));
+    };
+};
+
+
+template<>
+struct Ops<float> {
+    using vec_t = __m128;
+    static constexpr size_t kLanes = 4;
+
+    static vec_t Broadcast(float value) noexcept { return _mm_set1_ps(value); };
+    static vec_t Load(const float* ptr) noexcept { return _mm_loadu_ps(ptr); };
+    static uint32_t EqualMask(vec_t lhs, vec_t rhs) noexcept {
+        return _mm_movemask_epi8(_mm_castps_si128(_mm_cmpeq_ps(lhs, rhs)));
+    };
+};
+
+
+template<>
+struct Ops<double> {
+    using vec_t = __m128d;
+    static constexpr size_t kLanes = 2;
+
+    static vec_t Broadcast(double value) noexcept { return _mm_set1_pd(value); };
+    static vec_t Load(const double* ptr) noexcept { return _mm_loadu_pd(ptr); };
+    static uint32_t EqualMask(vec_t lhs, vec_t rhs) noexcept {
+        return _mm_movemask_epi8(_mm_castpd_si128(_mm_cmpeq_pd(lhs, rhs)));
+    };
+};
+
+
+template<typename DataType>
+const DataType* Find(const DataType* first, const DataType* last, DataType value) noexcept {
+    using ops = Ops<DataType>;
+
+    auto broadcast = ops::Broadcast(value);
+    for (; static_cast<size_t>(last - first) >= ops::kLanes; first += ops::kLanes) {
+        uint32_t mask = ops::EqualMask(ops::Load(first), broadcast);
+        if (mask) {
+            return first + __builtin_ctz(mask) / sizeof(DataType);
+        }
+    }
+    return scalar::Find(first, last, value);
+}
+
+
+template<typename DataType>
+std::ptrdiff_t Count(const DataType* first, const DataType* last, DataType value) noexcept {
+    using ops = Ops<DataType>;
+
+    std::ptrdiff_t result = 0;
+    auto broadcast = ops::Broadcast(value);
+    for (; static_cast<size_t>(last - first) >= ops::kLanes; first += ops::kLanes) {
+        result += __builtin_popcount(ops::EqualMask(ops::Load(first), broadcast));
+    }
+    return result / static_cast<std::ptrdiff_t>(sizeof(DataType)) + scalar::Count(first, last, value);
+}
+
+
+template<typename DataType>
+DataType Sum(const DataType* first, const DataType* last) noexcept {
+    using ops = Ops<DataType>;
+
+    auto accumulator = ops::Zero();
+    for (; static_cast<size_t>(last - first) >= ops::kLanes; first += ops::kLanes) {
+        accumulator = ops::Add(accumulator, ops::Load(first));
+    }
+
+    DataType lanes[ops::kLanes];
+    ops::Store(lanes, accumulator);
+    return scalar::WrappingAdd(scalar::Sum<DataType>(lanes, lanes + ops::kLanes), scalar::Sum<DataType>(first, last));
+}
+
+
+inline int64_t SumWide(const int32_t* first, const int32_t* last) noexcept {
+    __m128i accumulator = _mm_setzero_si128();
+    for (; last - first >= 4; first += 4) {
+        __m128i value = Ops<int32_t>::Load(first);
+        __m128i sign = _mm_cmpgt_epi32(_mm_setzero_si128(), value);
+        accumulator = _mm_add_epi64(accumulator, _mm_unpacklo_epi32(value, sign));
+        accumulator = _mm_add_epi64(accumulator, _mm_unpackhi_epi32(value, sign));
+    }
+
+    int64_t lanes[2];
+    Ops<int64_t>::Store(lanes, accumulator);
+    return scalar::WrappingAdd(scalar::Sum<int64_t>(lanes, lanes + 2), scalar::Sum<int64_t>(first, last));
+}
+
+
+inline const int32_t* MinElement(const int32_t* first, const int32_t* last) noexcept {
+    using ops = Ops<int32_t>;
+    if (last - first < static_cast<std::ptrdiff_t>(ops::kLanes)) {
+        return scalar::MinElement(first, last);
+    }
+
+    const int32_t* current = first;
+    auto accumulator = ops::Load(current);
+    for (current += ops::kLanes; last - current >= static_cast<std::ptrdiff_t>(ops::kLanes); current += ops::kLanes) {
+        accumulator = ops::Min(accumulator, ops::Load(current));
+    }
+
+    int32_t lanes[ops::kLanes];
+    ops::Store(lanes, accumulator);
+    int32_t result = *std::min_element(lanes, lanes + ops::kLanes);
+    if (current != last) {
+        result = std::min(result, *scalar::MinElement(current, last));
+    }
+    return Find(first, last, result);
+}
+
+
+inline const int32_t* MaxElement(const int32_t* first, const int32_t* last) noexcept {
+    using ops = Ops<int32_t>;
+    if (last - first < static_cast<std::ptrdiff_t>(ops::kLanes)) {
+        return scalar::MaxElement(first, last);
+    }
+
+    const int32_t* current = first;
+    auto accumulator = ops::Load(current);
+    for (current += ops::kLanes; last - current >= static_cast<std::ptrdiff_t>(ops::kLanes); current += ops::kLanes) {
+        accumulator = ops::Max(accumulator, ops::Load(current));
+    }
+
+    int32_t lanes[ops::kLanes];
+    ops::Store(lanes, accumulator);
+    int32_t result = *std::max_element(lanes, lanes + ops::kLanes);
+    if (current != last) {
+        result = std::max(result, *scalar::MaxElement(current, last));
+    }
+    return Find(first, last, result);
+}
+
+} // namespace sse2
+
+
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx2"))), apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#endif
+
+namespace avx2 {
+
+template<typename DataType>
+struct Ops;
+
+
+template<>
+struct Ops<int32_t> {
+    using vec_t = __m256i;
+    static constexpr size_t kLanes = 8;
+
+    static vec_t Broadcast(int32_t value) noexcept { return _mm256_set1_epi32(value); };
+    static vec_t Load(const int32_t* ptr) noexcept { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr)); };
+    static uint32_t EqualMask(vec_t lhs, vec_t rhs) noexcept { return _mm256_movemask_epi8(_mm256_cmpeq_epi32(lhs, rhs)); };
+    static vec_t Zero() noexcept { return _mm256_setzero_si256(); };
+    static vec_t Add(vec_t lhs, vec_t rhs) noexcept { return _mm256_add_epi32(lhs, rhs); };
+    static vec_t Min(vec_t lhs, vec_t rhs) noexcept { return _mm256_min_epi32(lhs, rhs); };
+    static vec_t Max(vec_t lhs, vec_t rhs) noexcept { return _mm256_max_epi32(lhs, rhs); };
+    static void Store(int32_t* ptr, vec_t value) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), value); };
+};
+
+
+template<>
+struct Ops<int64_t> {
+    using vec_t = __m256i;
+    static constexpr size_t kLanes = 4;
+
+    static vec_t Broadcast(int64_t value) noexcept { return _mm256_set1_epi64x(value); };
+    static vec_t Load(const int64_t* ptr) noexcept { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr)); };
+    static uint32_t EqualMask(vec_t lhs, vec_t rhs) noexcept { return _mm256_movemask_epi8(_mm256_cmpeq_epi64(lhs, rhs)); };
+    static vec_t Zero() noexcept { return _mm256_setzero_si256(); };
+    static vec_t Add(vec_t lhs, vec_t rhs) noexcept { return _mm256_add_epi64(lhs, rhs); };
+    static void Store(int64_t* ptr, vec_t value) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), value); };
+
+    static vec_t Min(vec_t lhs, vec_t rhs) noexcept {
+        return _mm256_blendv_epi8(lhs, rhs, _mm256_cmpgt_epi64(lhs, rhs));
+    };
+
+    static vec_t Max(vec_t lhs, vec_t rhs) noexcept {
+        return _mm256_blendv_epi8(rhs, lhs, _mm256_cmpgt_epi64(lhs, rhs));
+    };
+};
+
+
+template<>
+struct Ops<float> {
+    using vec_t = __m256;
+    static constexpr size_t kLanes = 8;
+
+    static vec_t Broadcast(float value) noexcept { return _mm256_set1_ps(value); };
+    static vec_t Load(const float* ptr) noexcept { return _mm256_loadu_ps(ptr); };
+    static uint32_t EqualMask(vec_t lhs, vec_t rhs) noexcept {
+        return _mm256_movemask_epi8(_mm256_castps_si256(_mm256_cmp_ps(lhs, rhs, _CMP_EQ_OQ)));
+    };
+};
+
+
+template<>
+struct Ops<double> {
+    using vec_t = __m256d;
+    static constexpr size_t kLanes = 4;
+
+    static vec_t Broadcast(double value) noexcept { return _mm256_set1_pd(value); };
+    static vec_t Load(const double* ptr) noexcept { return _mm256_loadu_pd(ptr); };
+    static uint32_t EqualMask(vec_t lhs, vec_t rhs) noexcept {
+        return _mm256_movemask_epi8(_mm256_castpd_si256(_mm256_cmp_pd(lhs, rhs, _CMP_EQ_OQ)));
+    };
+};
+
+
+template<typename DataType>
+const DataType* Find(const DataType* first, const DataType* last, DataType value) noexcept {
+    using ops = Ops<DataType>;
+
+    auto broadcast = ops::Broadcast(value);
+    for (; static_cast<size_t>(last - first) >= ops::kLanes; first += ops::kLanes) {
+        uint32_t mask = ops::EqualMask(ops::Load(first), broadcast);
+        if (mask) {
+            return first + __builtin_ctz(mask) / sizeof(DataType);
+        }
+    }
+    return sse2::Find(first, last, value);
+}
+
+
+template<typename DataType>
+std::ptrdiff_t Count(const DataType* first, const DataType* last, DataType value) noexcept {
+    using ops = Ops<DataType>;
+
+    std::ptrdiff_t result = 0;
+    auto broadcast = ops::Broadcast(value);
+    for (; static_cast<size_t>(last - first) >= ops::kLanes; first += ops::kLanes) {
+        result += __builtin_popcount(ops::EqualMask(ops::Load(first), broadcast));
+    }
+    return result / static_cast<std::ptrdiff_t>(sizeof(DataType)) + sse2::Count(first, last, value);
+}
+
+
+template<typename DataType>
+DataType Sum(const DataType* first, const DataType* last) noexcept {
+    using ops = Ops<DataType>;
+
+    auto accumulator = ops::Zero();
+    for (; static_cast<size_t>(last - first) >= ops::kLanes; first += ops::kLanes) {
+        accumulator = ops::Add(accumulator, ops::Load(first));
+    }
+
+    DataType lanes[ops::kLanes];
+    ops::Store(lanes, accumulator);
+    return scalar::WrappingAdd(scalar::Sum<DataType>(lanes, lanes + ops::kLanes), scalar::Sum<DataType>(first, last));
+}
+
+
+inline int64_t SumWide(const int32_t* first, const int32_t* last) noexcept {
+    __m256i accumulator = _mm256_setzero_si256();
+    for (; last - first >= 4; first += 4) {
+        __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+        accumulator = _mm256_add_epi64(accumulator, _mm256_cvtepi32_epi64(value));
+    }
+
+    int64_t lanes[4];
+    Ops<int64_t>::Store(lanes, accumulator);
+    return scalar::WrappingAdd(scalar::Sum<int64_t>(lanes, lanes + 4), scalar::Sum<int64_t>(first, last));
+}
+
+
+template<typename DataType>
+const DataType* MinElement(const DataType* first, const DataType* last) noexcept {
+    using ops = Ops<DataType>;
+    if (last - first < static_cast<std::ptrdiff_t>(ops::kLanes)) {
+        return scalar::MinElement(first, last);
+    }
+
+    const DataType* current = first;
+    auto accumulator = ops::Load(current);
+    for (current += ops::kLanes; last - current >= static_cast<std::ptrdiff_t>(ops::kLanes); current += ops::kLanes) {
+        accumulator = ops::Min(accumulator, ops::Load(current));
+    }
+
+    DataType lanes[ops::kLanes];
+    ops::Store(lanes, accumulator);
+    DataType result = *std::min_element(lanes, lanes + ops::kLanes);
+    if (current != last) {
+        result = std::min(result, *scalar::MinElement(current, last));
+    }
+    return Find(first, last, result);
+}
+
+
+template<typename DataType>
+const DataType* MaxElement(const DataType* first, const DataType* last) noexcept {
+    using ops = Ops<DataType>;
+    if (last - first < static_cast<std::ptrdiff_t>(ops::kLanes)) {
+        return scalar::MaxElement(first, last);
+    }
+
+    const DataType* current = first;
+    auto accumulator = ops::Load(current);
+    for (current += ops::kLanes; last - current >= static_cast<std::ptrdiff_t>(ops::kLanes); current += ops::kLanes) {
+        accumulator = ops::Max(accumulator, ops::Load(current));
+    }
+
+    DataType lanes[ops::kLanes];
+    ops::Store(lanes, accumulator);
+    DataType result = *std::max_element(lanes, lanes + ops::kLanes);
+    if (current != last) {
+        result = std::max(result, *scalar::MaxElement(current, last));
+    }
+    return Find(first, last, result);
+}
+
+} // namespace avx2
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#endif
+
+#endif // UNROLLED_LIST_SIMD_X86
+
+
+inline isa_level DetectIsaLevel() noexcept {
+#ifdef UNROLLED_LIST_SIMD_X86
+    static const isa_level level = __builtin_cpu_supports("avx2") ? isa_level::kAvx2 : isa_level::kSse2;
+    return level;
+#else
+    return isa_level::kScalar;
+#endif
+}
+
+
+template<kernel_type DataType>
+kernel_table<DataType> MakeKernels(isa_level level) noexcept {
+    using wide_t = typename kernel_table<DataType>::wide_t;
+
+    kernel_table<DataType> table;
+    table.find = &scalar::Find<DataType>;
+    table.count = &scalar::Count<DataType>;
+    if constexpr (std::is_integral_v<DataType>) {
+        table.sum = &scalar::Sum<DataType, DataType>;
+        table.sum_wide = &scalar::Sum<wide_t, DataType>;
+        table.min_element = &scalar::MinElement<DataType>;
+        table.max_element = &scalar::MaxElement<DataType>;
+    }
+
+#ifdef UNROLLED_LIST_SIMD_X86
+    if (level == isa_level::kSse2) {
+        table.find = &sse2::Find<DataType>;
+        table.count = &sse2::Count<DataType>;
+        if constexpr (std::is_integral_v<DataType>) {
+            table.sum = &sse2::Sum<DataType>;
+        }
+        if constexpr (std::same_as<DataType, int32_t>) {
+            table.sum_wide = &sse2::SumWide;
+            table.min_element = &sse2::MinElement;
+            table.max_element = &sse2::MaxElement;
+        } else if constexpr (std::same_as<DataType, int64_t>) {
+            table.sum_wide = &sse2::Sum<DataType>;
+        }
+    }
+
+    if (level == isa_level::kAvx2) {
+        table.find = &avx2::Find<DataType>;
+        table.count = &avx2::Count<DataType>;
+        if constexpr (std::is_integral_v<DataType>) {
+            table.sum = &avx2::Sum<DataType>;
+            table.min_element = &avx2::MinElement<DataType>;
+            table.max_element = &avx2::MaxElement<DataType>;
+        }
+        if constexpr (std::same_as<DataType, int32_t>) {
+            table.sum_wide = &avx2::SumWide;
+        } else if constexpr (std::same_as<DataType, int64_t>) {
+            table.sum_wide = &avx2::Sum<DataType>;
+        }
+    }
+#endif
+
+    return table;
+}
+
+
+template<kernel_type DataType>
+const kernel_table<DataType>& Kernels() noexcept {
+    static const kernel_table<DataType> table = MakeKernels<DataType>(DetectIsaLevel());
+    return table;
+}
+
+} // namespace simd
+
+} // namespace details
+
+} // namespace labwork7
+
+#endif // _UNROLLED_LIST_SIMD_KERNELS_HPP_
@@ -1,6 +1,7 @@
 #ifndef _UNROLLED_LIST_STORAGE_HPP_
 #define _UNROLLED_LIST_STORAGE_HPP_
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
 #include <type_traits>
@@ -18,33 +19,72 @@ class RawArrayStorage {
 };
 
 
-template<typename DataType, size_t kSize>
-struct UnrolledListNodeChunck {
+struct EmptyChunckExtension {};
+
+
+/*
+    The header goes first, so it shares the first cache line with the first elements.
+    kAlignment over-aligns the whole chunck, 0 or anything below the alignment of the members keeps the natural one.
+    VoidPointerType is the void_pointer of the allocator, the links are the same kind of pointer,
+    so a fancy pointer of the allocator (e.g. offset_ptr) keeps the chain valid wherever it is mapped.
+*/
+template<typename DataType, size_t kSize, typename ExtensionType = EmptyChunckExtension, size_t kAlignment = 0,
+    typename VoidPointerType = void*>
+struct alignas(std::max({kAlignment, alignof(size_t), alignof(VoidPointerType), alignof(ExtensionType), alignof(DataType)}))
+UnrolledListNodeChunck {
   public:
     using store_t = RawArrayStorage<DataType, kSize>;
+    using extension_t = ExtensionType;
+    using node_ptr_t = typename std::pointer_traits<VoidPointerType>::template rebind<UnrolledListNodeChunck>;
 
   public:
     static constexpr size_t size_value = kSize;
 
   public:
     size_t size_m = 0;
-    UnrolledListNodeChunck* prev_chunck_ptr_m = nullptr;
-    UnrolledListNodeChunck* next_chunck_ptr_m = nullptr;
+    node_ptr_t prev_chunck_ptr_m = nullptr;
+    node_ptr_t next_chunck_ptr_m = nullptr;
+    [[no_unique_address]] extension_t extension_m;
     store_t data_m;
 };
 
 
+inline constexpr size_t kCacheLineSize = 64;
+inline constexpr size_t kPageSize = 4096;
+
+
+/*
+    Turns a byte budget of a chunck into the amount of elements it keeps.
+    Chuncks of a page and more are page aligned, smaller ones are cache line aligned.
+    A chunck keeps at least two elements, even if they do not fit into the budget.
+*/
+template<typename DataType, size_t kBytes, typename ExtensionType = EmptyChunckExtension>
+struct chunck_byte_budget {
+    static_assert(kBytes % kCacheLineSize == 0, "chunck byte budget has to be a multiple of the cache line size");
+
+    static constexpr size_t alignment = kBytes >= kPageSize ? kPageSize : kCacheLineSize;
+
+    static constexpr size_t header_bytes = [] {
+        size_t links_bytes = sizeof(size_t) + 2 * sizeof(void*) + (std::is_empty_v<ExtensionType> ? 0 : sizeof(ExtensionType));
+        return (links_bytes + alignof(DataType) - 1) / alignof(DataType) * alignof(DataType);
+    }();
+
+    static constexpr size_t chunck_size =
+        kBytes > header_bytes + sizeof(DataType) ? std::max<size_t>(2, (kBytes - header_bytes) / sizeof(DataType)) : 2;
+};
+
+
 template<typename node_t, typename AllocatorType = std::allocator<node_t>>
 class chunck_traits {
   public:
     using allocator_type = typename std::allocator_traits<AllocatorType>::template rebind_alloc<node_t>;
     using allocator_trait_t = std::allocator_traits<allocator_type>;
-    using node_ptr_t = node_t*;
+    using node_ptr_t = typename allocator_trait_t::pointer;
 
   public:
     static node_ptr_t CreateChunck(allocator_type& alloc) {
-        node_t* chunck_ptr = allocator_trait_t::allocate(alloc, 1);
-        allocator_trait_t::construct(alloc, chunck_ptr);
+        node_ptr_t chunck_ptr = allocator_trait_t::allocate(alloc, 1);
+        allocator_trait_t::construct(alloc, std::to_address(chunck_ptr));
         return chunck_ptr;
     };
 
@@ -127,7 +167,7 @@ class chunck_traits {
 
     static void RemoveChunck(node_ptr_t current_chunck, allocator_type& alloc)
       noexcept(std::is_nothrow_destructible_v<node_t>) {
-        allocator_trait_t::destroy(alloc, current_chunck);
+        allocator_trait_t::destroy(alloc, std::to_address(current_chunck));
         allocator_trait_t::deallocate(alloc, current_chunck, 1);
         current_chunck = nullptr;
     };
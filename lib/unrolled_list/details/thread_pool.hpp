@@ -0,0 +1,275 @@
+#ifndef _UNROLLED_LIST_DETAILS_THREAD_POOL_HPP_
+#define _UNROLLED_LIST_DETAILS_THREAD_POOL_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+
+namespace labwork7 {
+
+namespace details {
+
+/*
+    Work-stealing thread pool: every worker owns a ring of tasks, takes its own tasks from the back
+    and steals from the front of the others when its ring runs dry.
+    The thread which calls Run executes tasks as well until its whole batch is done,
+    so a task may call Run again without a deadlock. Tasks which find every ring full run on the calling thread.
+*/
+class WorkStealingPool {
+  private:
+    /* Shared state of one Run call */
+    struct TaskGroup {
+        void (*invoke_m)(void*, size_t) = nullptr;
+        void* func_m = nullptr;
+
+        std::atomic<size_t> pending_m = 0;
+        std::mutex exception_mutex_m;
+        std::exception_ptr exception_m;
+    };
+
+
+    struct Task {
+        TaskGroup* group_m = nullptr;
+        size_t index_m = 0;
+    };
+
+
+    /* Fixed ring of tasks, front_m and back_m only grow and wrap around kCapacity */
+    struct WorkerQueue {
+        static constexpr size_t kCapacity = 512;
+
+        std::mutex mutex_m;
+        size_t front_m = 0;
+        size_t back_m = 0;
+        Task tasks_m[kCapacity];
+    };
+
+  public:
+    explicit WorkStealingPool(size_t worker_count)
+        : queues_m(std::make_unique<WorkerQueue[]>(std::max<size_t>(worker_count, 1))),
+          queue_count_m(std::max<size_t>(worker_count, 1)),
+          workers_m(std::make_unique<std::thread[]>(worker_count)) {
+        try {
+            for (; worker_count_m != worker_count; ++worker_count_m) {
+                workers_m[worker_count_m] = std::thread([this, ind = worker_count_m] { WorkerLoop(ind); });
+            }
+        } catch(...) {
+            Stop();
+            throw;
+        }
+    };
+
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+
+    ~WorkStealingPool() {
+        Stop();
+    };
+
+
+    /* Pool shared by the parallel algorithms, the calling thread makes up the last worker */
+    static WorkStealingPool& Default() {
+        static WorkStealingPool pool(std::max<size_t>(std::thread::hardware_concurrency(), 2) - 1);
+        return pool;
+    };
+
+
+    size_t Concurrency() const noexcept { return worker_count_m + 1; };
+
+
+    /*
+        Calls func(index) for every index of [0, task_count) and returns once all of them are done.
+        The first exception thrown by a task is rethrown here, the rest of the tasks still run.
+    */
+    template<typename FuncType>
+    void Run(size_t task_count, FuncType&& func) {
+        if (task_count == 0) {
+            return;
+        }
+
+        if (task_count == 1 || worker_count_m == 0) {
+            for (size_t ind = 0; ind != task_count; ++ind) {
+                func(ind);
+            }
+            return;
+        }
+
+        using func_t = std::remove_reference_t<FuncType>;
+
+        TaskGroup group;
+        group.invoke_m = [](void* func_ptr, size_t index) { (*static_cast<func_t*>(func_ptr))(index); };
+        group.func_m = const_cast<void*>(static_cast<const void*>(std::addressof(func)));
+        group.pending_m.store(task_count, std::memory_order_relaxed);
+
+        /* the calling thread keeps the first task and whatever does not fit the rings, the rest is dealt out round-robin */
+        size_t dealt_count = 1;
+        while (dealt_count != task_count && TryPush(Task{&group, dealt_count})) {
+            ++dealt_count;
+        }
+        {
+            std::lock_guard lock(sleep_mutex_m);
+        }
+        sleep_cv_m.notify_all();
+
+        Execute(Task{&group, 0});
+        for (size_t ind = dealt_count; ind != task_count; ++ind) {
+            Execute(Task{&group, ind});
+        }
+
+        /* the epoch is read before pending_m, a group finished after the read moves it on */
+        while (true) {
+            size_t epoch = finished_epoch_m.load(std::memory_order_acquire);
+            if (group.pending_m.load(std::memory_order_acquire) == 0) {
+                break;
+            }
+
+            Task task;
+            if (TryTake(CurrentQueue(), task)) {
+                Execute(task);
+            } else {
+                finished_epoch_m.wait(epoch, std::memory_order_acquire);
+            }
+        }
+
+        if (group.exception_m) {
+            std::rethrow_exception(group.exception_m);
+        }
+    };
+
+  private:
+    void Stop() noexcept {
+        {
+            std::lock_guard lock(sleep_mutex_m);
+            is_stopped_m = true;
+        }
+        sleep_cv_m.notify_all();
+
+        for (size_t ind = 0; ind != worker_count_m; ++ind) {
+            workers_m[ind].join();
+        }
+    };
+
+
+    void WorkerLoop(size_t queue_index) {
+        current_queue_index = queue_index;
+        current_pool = this;
+
+        while (true) {
+            Task task;
+            if (TryTake(queue_index, task)) {
+                Execute(task);
+                continue;
+            }
+
+            std::unique_lock lock(sleep_mutex_m);
+            sleep_cv_m.wait(lock, [this] {
+                return is_stopped_m || queued_count_m.load(std::memory_order_acquire) != 0;
+            });
+            if (is_stopped_m) {
+                return;
+            }
+        }
+    };
+
+
+    /* Next queue round-robin which has room, false if every queue is full */
+    bool TryPush(Task task) {
+        size_t first_index = next_queue_m.fetch_add(1, std::memory_order_relaxed);
+
+        for (size_t shift = 0; shift != queue_count_m; ++shift) {
+            WorkerQueue& queue = queues_m[(first_index + shift) % queue_count_m];
+            std::lock_guard lock(queue.mutex_m);
+
+            if (queue.back_m - queue.front_m == WorkerQueue::kCapacity) {
+                continue;
+            }
+
+            queue.tasks_m[queue.back_m++ % WorkerQueue::kCapacity] = task;
+            queued_count_m.fetch_add(1, std::memory_order_release);
+            return true;
+        }
+        return false;
+    };
+
+
+    /* Own queue from the back first, then the fronts of the other queues */
+    bool TryTake(size_t own_index, Task& task) {
+        if (queued_count_m.load(std::memory_order_acquire) == 0) {
+            return false;
+        }
+
+        for (size_t shift = 0; shift != queue_count_m; ++shift) {
+            WorkerQueue& queue = queues_m[(own_index + shift) % queue_count_m];
+            std::lock_guard lock(queue.mutex_m);
+
+            if (queue.back_m == queue.front_m) {
+                continue;
+            }
+
+            if (shift == 0) {
+                task = queue.tasks_m[--queue.back_m % WorkerQueue::kCapacity];
+            } else {
+                task = queue.tasks_m[queue.front_m++ % WorkerQueue::kCapacity];
+            }
+            queued_count_m.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+        return false;
+    };
+
+
+    void Execute(Task task) noexcept {
+        TaskGroup& group = *task.group_m;
+
+        try {
+            group.invoke_m(group.func_m, task.index_m);
+        } catch(...) {
+            std::lock_guard lock(group.exception_mutex_m);
+            if (!group.exception_m) {
+                group.exception_m = std::current_exception();
+            }
+        }
+
+        /* group dies as soon as Run sees the last decrement, the wake-up goes through the pool */
+        if (group.pending_m.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            finished_epoch_m.fetch_add(1, std::memory_order_release);
+            finished_epoch_m.notify_all();
+        }
+    };
+
+
+    size_t CurrentQueue() const noexcept {
+        return current_pool == this ? current_queue_index : 0;
+    };
+
+  private:
+    static inline thread_local size_t current_queue_index = 0;
+    static inline thread_local const WorkStealingPool* current_pool = nullptr;
+
+    std::unique_ptr<WorkerQueue[]> queues_m;
+    size_t queue_count_m = 0;
+    std::unique_ptr<std::thread[]> workers_m;
+    size_t worker_count_m = 0;
+
+    std::atomic<size_t> queued_count_m = 0;
+    std::atomic<size_t> next_queue_m = 0;
+    std::atomic<size_t> finished_epoch_m = 0;
+
+    std::mutex sleep_mutex_m;
+    std::condition_variable sleep_cv_m;
+    bool is_stopped_m = false;
+};
+
+} // namespace details
+
+} // namespace labwork7
+
+#endif // _UNROLLED_LIST_DETAILS_THREAD_POOL_HPP_
@@ -0,0 +1,125 @@
+#ifndef _UNROLLED_LIST_FILL_POLICY_HPP_
+#define _UNROLLED_LIST_FILL_POLICY_HPP_
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+
+namespace labwork7 {
+
+namespace fill_policy {
+
+/*
+    Fill policies of unrolled_list chuncks, every ratio is a part of ChunckSize:
+        split_ratio     - part of a full chunck which stays in it when an element is inserted into the middle
+        merge_threshold - a chunck which gets less filled than that borrows from a neighbour or merges with it
+        merge_limit     - neighbours are merged only when the result fills no more than that part of a chunck
+        borrow_ratio    - part of a chunck moved at once when borrowing from a neighbour
+        adaptive_split  - a full chunck is split right at the insertion point when the inserts go one after another
+
+    The gap between split_ratio and merge_threshold/merge_limit is the hysteresis: a freshly split chunck
+    does not merge back after a single erase.
+*/
+struct balanced {
+    static constexpr double split_ratio = 0.5;
+    static constexpr double merge_threshold = 0.25;
+    static constexpr double merge_limit = 0.75;
+    static constexpr double borrow_ratio = 0.25;
+    static constexpr bool adaptive_split = true;
+};
+
+
+/* Keeps chuncks as full as possible, less memory at the cost of more element moves */
+struct dense {
+    static constexpr double split_ratio = 0.5;
+    static constexpr double merge_threshold = 0.5;
+    static constexpr double merge_limit = 1.0;
+    static constexpr double borrow_ratio = 0.5;
+    static constexpr bool adaptive_split = true;
+};
+
+
+/* Leaves a lot of slack in chuncks, so insert/erase heavy workloads rarely split or merge */
+struct write_heavy {
+    static constexpr double split_ratio = 0.5;
+    static constexpr double merge_threshold = 0.125;
+    static constexpr double merge_limit = 0.5;
+    static constexpr double borrow_ratio = 0.125;
+    static constexpr bool adaptive_split = true;
+};
+
+} // namespace fill_policy
+
+
+template<typename PolicyType>
+concept chunck_fill_policy = requires {
+    { PolicyType::split_ratio } -> std::convertible_to<double>;
+    { PolicyType::merge_threshold } -> std::convertible_to<double>;
+    { PolicyType::merge_limit } -> std::convertible_to<double>;
+    { PolicyType::borrow_ratio } -> std::convertible_to<double>;
+    { PolicyType::adaptive_split } -> std::convertible_to<bool>;
+};
+
+
+namespace details {
+
+/* Policy ratios turned into amounts of elements for a chunck of kSize */
+template<chunck_fill_policy PolicyType, size_t kSize>
+struct fill_policy_traits {
+    static constexpr size_t split_keep =
+        std::clamp<size_t>(static_cast<size_t>(kSize * PolicyType::split_ratio + 0.5), 1, kSize > 1 ? kSize - 1 : 1);
+
+    static constexpr size_t merge_threshold =
+        std::max<size_t>(1, static_cast<size_t>(kSize * PolicyType::merge_threshold));
+
+    /* two chuncks below merge_threshold always fit into a merged one */
+    static constexpr size_t merge_limit =
+        std::min<size_t>(kSize, std::max<size_t>(2 * merge_threshold, static_cast<size_t>(kSize * PolicyType::merge_limit)));
+
+    static constexpr size_t borrow_count =
+        std::max<size_t>(1, static_cast<size_t>(kSize * PolicyType::borrow_ratio));
+
+    static constexpr bool adaptive_split = PolicyType::adaptive_split;
+};
+
+
+/* Remembers where the previous insert landed to recognize inserts going one after another */
+template<typename node_ptr_t, bool kEnabled>
+struct InsertPatternTracker {
+    bool IsSequential(node_ptr_t, size_t) const noexcept { return false; };
+    void Remember(node_ptr_t, size_t) noexcept {  };
+    void Reset() noexcept {  };
+};
+
+
+template<typename node_ptr_t>
+struct InsertPatternTracker<node_ptr_t, true> {
+    bool IsSequential(node_ptr_t chunck, size_t offset) const noexcept {
+        if (!last_chunck_m) {
+            return false;
+        }
+        if (chunck == last_chunck_m) {
+            return offset == last_offset_m || offset == last_offset_m + 1;
+        }
+        return offset == 0 && chunck->prev_chunck_ptr_m == last_chunck_m && last_offset_m + 1 == last_chunck_m->size_m;
+    };
+
+    void Remember(node_ptr_t chunck, size_t offset) noexcept {
+        last_chunck_m = chunck;
+        last_offset_m = offset;
+    };
+
+    void Reset() noexcept {
+        last_chunck_m = nullptr;
+        last_offset_m = 0;
+    };
+
+    node_ptr_t last_chunck_m = nullptr;
+    size_t last_offset_m = 0;
+};
+
+} // namespace details
+
+} // namespace labwork7
+
+#endif // _UNROLLED_LIST_FILL_POLICY_HPP_
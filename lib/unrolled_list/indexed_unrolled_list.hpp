@@ -0,0 +1,465 @@
+#ifndef _INDEXED_UNROLLED_LIST_HPP_
+#define _INDEXED_UNROLLED_LIST_HPP_
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "unrolled_list.hpp"
+#include "details/counted_index.hpp"
+
+namespace labwork7 {
+
+/*
+    unrolled_list with a counted index over its chuncks.
+    nth, index_of and insert/erase by index cost O(log(N / ChunckSize) + ChunckSize).
+
+    Every modification detaches from the index the chuncks it can touch
+    (the chunck itself and its neighbours, which split/merge/borrow work with)
+    and attaches whatever lays between the untouched chuncks afterwards.
+    A range erase detaches its whole run of chuncks at once, so it costs O(log(N / K)) on top of the base erase.
+*/
+template<std::copy_constructible DataType, size_t ChunckSize = 10, typename AllocatorType = std::allocator<DataType>,
+    chunck_fill_policy FillPolicyType = fill_policy::balanced>
+class indexed_unrolled_list
+    : private unrolled_list<DataType, ChunckSize, AllocatorType, FillPolicyType, details::CountedChunckLinks<DataType, ChunckSize>> {
+  private:
+    using base_t = unrolled_list<DataType, ChunckSize, AllocatorType, FillPolicyType, details::CountedChunckLinks<DataType, ChunckSize>>;
+    using typename base_t::node_t;
+    using index_t = details::counted_chunck_index<node_t>;
+
+  public:
+    using typename base_t::value_type;
+    using typename base_t::reference;
+    using typename base_t::const_reference;
+    using typename base_t::pointer;
+    using typename base_t::const_pointer;
+    using typename base_t::size_type;
+    using typename base_t::difference_type;
+
+    using typename base_t::iterator;
+    using typename base_t::const_iterator;
+    using typename base_t::reverse_iterator;
+    using typename base_t::const_reverse_iterator;
+
+    using typename base_t::chunck_range;
+    using typename base_t::const_chunck_range;
+
+    using typename base_t::allocator_type;
+
+  public:
+    indexed_unrolled_list() = default;
+
+    template<std::convertible_to<allocator_type> AnotherAllocatorType>
+    indexed_unrolled_list(AnotherAllocatorType&& alloc) : base_t(std::forward<AnotherAllocatorType>(alloc)) {  };
+
+    indexed_unrolled_list(std::initializer_list<value_type> i_list) : base_t(i_list) { RebuildIndex(); };
+
+    template<std::input_iterator InItrType>
+    indexed_unrolled_list(InItrType beg, InItrType end, const AllocatorType& alloc = {})
+        : base_t(beg, end, alloc) { RebuildIndex(); };
+
+    indexed_unrolled_list(const indexed_unrolled_list& value) : base_t(value) { RebuildIndex(); };
+
+    indexed_unrolled_list(indexed_unrolled_list&& value) noexcept
+        : base_t(std::move(value)), index_m(std::move(value.index_m)) {  };
+
+    ~indexed_unrolled_list() override = default;
+
+    indexed_unrolled_list& operator=(const indexed_unrolled_list& value) {
+        if (this == &value) {
+            return *this;
+        }
+
+        indexed_unrolled_list current_copy(value);
+        swap(current_copy);
+        return *this;
+    };
+
+    indexed_unrolled_list& operator=(indexed_unrolled_list&& value) noexcept {
+        if (this == &value) {
+            return *this;
+        }
+
+        clear();
+        swap(value);
+        return *this;
+    };
+
+  public:
+    using base_t::begin;
+    using base_t::end;
+    using base_t::cbegin;
+    using base_t::cend;
+    using base_t::rbegin;
+    using base_t::rend;
+    using base_t::crbegin;
+    using base_t::crend;
+    using base_t::chunks;
+
+    using base_t::size;
+    using base_t::empty;
+    using base_t::max_size;
+    using base_t::get_allocator;
+    using base_t::occupancy;
+    using base_t::reserve;
+
+    using base_t::front;
+    using base_t::back;
+
+  public:
+    iterator nth(size_type index) noexcept {
+        auto [chunck, offset] = index_m.Locate(index);
+        if (!chunck) {
+            return end();
+        }
+        return iterator{chunck, offset};
+    };
+
+    const_iterator nth(size_type index) const noexcept {
+        return const_cast<indexed_unrolled_list*>(this)->nth(index);
+    };
+
+    size_type index_of(const_iterator pos_itr) const noexcept {
+        const node_t* chunck = static_cast<node_t*>(pos_itr.base());
+        if (!chunck) {
+            return 0;
+        }
+        return index_m.Rank(chunck) + pos_itr.base().get_chunck_offset();
+    };
+
+    reference operator[](size_type index) noexcept { return *static_cast<pointer>(nth(index)); };
+    const_reference operator[](size_type index) const noexcept { return *nth(index); };
+
+    reference at(size_type index) {
+        if (index >= size()) {
+            throw std::out_of_range{"indexed_unrolled_list::at: index is out of range"};
+        }
+        return (*this)[index];
+    };
+
+    const_reference at(size_type index) const {
+        if (index >= size()) {
+            throw std::out_of_range{"indexed_unrolled_list::at: index is out of range"};
+        }
+        return (*this)[index];
+    };
+
+  public:
+    template<typename... ArgsTs>
+    requires std::constructible_from<value_type, ArgsTs...>
+    void emplace_back(ArgsTs&&... args) {
+        node_t* last_chunck = this->end_chunck_ptr_m;
+
+        if (last_chunck && last_chunck->size_m != last_chunck->size_value) {
+            base_t::emplace_back(std::forward<ArgsTs>(args)...);
+            index_m.Refresh(last_chunck);
+            return;
+        }
+
+        base_t::emplace_back(std::forward<ArgsTs>(args)...);
+        index_m.Attach(this->end_chunck_ptr_m, last_chunck);
+    };
+
+
+    template<typename... ArgsTs>
+    requires std::constructible_from<value_type, ArgsTs...>
+    void emplace_front(ArgsTs&&... args) {
+        node_t* first_chunck = this->begin_chunck_ptr_m;
+
+        if (first_chunck && first_chunck->size_m != first_chunck->size_value) {
+            base_t::emplace_front(std::forward<ArgsTs>(args)...);
+            index_m.Refresh(first_chunck);
+            return;
+        }
+
+        base_t::emplace_front(std::forward<ArgsTs>(args)...);
+        index_m.Attach(this->begin_chunck_ptr_m, nullptr);
+    };
+
+
+    template<typename... ArgsTs>
+    requires std::constructible_from<value_type, ArgsTs...>
+    iterator emplace(const_iterator pos_itr, ArgsTs&&... args) {
+        node_t* pos_chunck = static_cast<node_t*>(pos_itr.base());
+
+        if (!pos_chunck) {
+            emplace_back(std::forward<ArgsTs>(args)...);
+            return begin();
+        }
+
+        node_t* prev_chunck = pos_chunck->prev_chunck_ptr_m;
+        bool is_placed_into_prev = pos_itr.base().get_chunck_offset() == 0
+            && prev_chunck && prev_chunck->size_m != prev_chunck->size_value;
+
+        if (is_placed_into_prev || pos_chunck->size_m != pos_chunck->size_value) {
+            iterator result_itr = base_t::emplace(pos_itr, std::forward<ArgsTs>(args)...);
+            index_m.Refresh(static_cast<node_t*>(result_itr));
+            return result_itr;
+        }
+
+        return Reindexed(pos_chunck, pos_chunck, [&]() {
+            return base_t::emplace(pos_itr, std::forward<ArgsTs>(args)...);
+        });
+    };
+
+
+    template<typename... ArgsTs>
+    requires std::constructible_from<value_type, ArgsTs...>
+    iterator emplace_at(size_type index, ArgsTs&&... args) {
+        return emplace(nth(index), std::forward<ArgsTs>(args)...);
+    };
+
+
+    template<std::convertible_to<value_type> SameType>
+    void push_back(SameType&& value) {
+        emplace_back(std::forward<SameType>(value));
+    };
+
+
+    template<std::convertible_to<value_type> SameType>
+    void push_front(SameType&& value) {
+        emplace_front(std::forward<SameType>(value));
+    };
+
+
+    template<std::convertible_to<value_type> SameType>
+    iterator insert(const_iterator pos_itr, SameType&& value) {
+        return emplace(pos_itr, std::forward<SameType>(value));
+    };
+
+
+    iterator insert(const_iterator pos_itr, size_type count, const value_type& value) {
+        return InsertReindexed(pos_itr, [&]() {
+            return base_t::insert(pos_itr, count, value);
+        });
+    };
+
+
+    template<std::input_iterator InItrType>
+    iterator insert(const_iterator pos_itr, InItrType beg_itr, InItrType end_itr) {
+        return InsertReindexed(pos_itr, [&]() {
+            return base_t::insert(pos_itr, beg_itr, end_itr);
+        });
+    };
+
+
+    template<std::convertible_to<value_type> SameType>
+    iterator insert_at(size_type index, SameType&& value) {
+        return emplace_at(index, std::forward<SameType>(value));
+    };
+
+
+    void pop_back() noexcept(std::is_nothrow_destructible_v<value_type>) {
+        node_t* last_chunck = this->end_chunck_ptr_m;
+
+        if (last_chunck->size_m == 1) {
+            index_m.Detach(last_chunck);
+            base_t::pop_back();
+            return;
+        }
+
+        base_t::pop_back();
+        index_m.Refresh(last_chunck);
+    };
+
+
+    void pop_front() noexcept(std::is_nothrow_destructible_v<value_type>) {
+        node_t* first_chunck = this->begin_chunck_ptr_m;
+
+        if (first_chunck->size_m == 1) {
+            index_m.Detach(first_chunck);
+            base_t::pop_front();
+            return;
+        }
+
+        base_t::pop_front();
+        index_m.Refresh(first_chunck);
+    };
+
+
+    iterator erase(const_iterator pos_itr) {
+        node_t* pos_chunck = static_cast<node_t*>(pos_itr.base());
+        node_t* first_chunck = pos_chunck->prev_chunck_ptr_m ? pos_chunck->prev_chunck_ptr_m : pos_chunck;
+        node_t* last_chunck = pos_chunck->next_chunck_ptr_m ? pos_chunck->next_chunck_ptr_m : pos_chunck;
+
+        return Reindexed(first_chunck, last_chunck, [&]() {
+            return base_t::erase(pos_itr);
+        });
+    };
+
+
+    iterator erase(const_iterator beg_pos_itr, const_iterator end_pos_itr) {
+        if (beg_pos_itr == end_pos_itr) {
+            return end_pos_itr.base();
+        }
+
+        node_t* beg_chunck = static_cast<node_t*>(beg_pos_itr.base());
+        node_t* end_chunck = static_cast<node_t*>(end_pos_itr.base());
+        node_t* first_chunck = beg_chunck->prev_chunck_ptr_m ? beg_chunck->prev_chunck_ptr_m : beg_chunck;
+        node_t* last_chunck = end_chunck->next_chunck_ptr_m ? end_chunck->next_chunck_ptr_m : end_chunck;
+
+        return Reindexed(first_chunck, last_chunck, [&]() {
+            return base_t::erase(beg_pos_itr, end_pos_itr);
+        });
+    };
+
+
+    iterator erase_at(size_type index) {
+        return erase(nth(index));
+    };
+
+
+    void clear() noexcept(noexcept(std::declval<base_t&>().clear())) {
+        base_t::clear();
+        index_m.Reset();
+    };
+
+
+    void compact() noexcept(is_nothrow_relocatable_v<value_type>) {
+        base_t::compact();
+        RebuildIndex();
+    };
+
+
+    void shrink_to_fit() noexcept(is_nothrow_relocatable_v<value_type>) {
+        base_t::shrink_to_fit();
+        RebuildIndex();
+    };
+
+
+    void sort() {
+        sort(std::less<>{});
+    };
+
+
+    template<typename CompareType>
+    void sort(CompareType comp) {
+        Relinked([&]() { base_t::sort(comp); });
+    };
+
+
+    void stable_sort() {
+        stable_sort(std::less<>{});
+    };
+
+
+    template<typename CompareType>
+    void stable_sort(CompareType comp) {
+        Relinked([&]() { base_t::stable_sort(comp); });
+    };
+
+
+    void merge(indexed_unrolled_list& other) {
+        merge(other, std::less<>{});
+    };
+
+
+    template<typename CompareType>
+    void merge(indexed_unrolled_list& other, CompareType comp) {
+        try {
+            Relinked([&]() { base_t::merge(other, comp); });
+        } catch(...) {
+            other.RebuildIndex();
+            throw;
+        }
+        other.RebuildIndex();
+    };
+
+
+    void swap(indexed_unrolled_list& value) noexcept {
+        base_t::swap(value);
+        std::swap(index_m, value.index_m);
+    };
+
+  public:
+    bool operator==(const indexed_unrolled_list& value) const noexcept {
+        return static_cast<const base_t&>(*this) == static_cast<const base_t&>(value);
+    };
+
+    bool operator!=(const indexed_unrolled_list& value) const noexcept {
+        return !(*this == value);
+    };
+
+  private:
+    template<typename OperationType>
+    iterator Reindexed(node_t* first_chunck, node_t* last_chunck, OperationType&& operation) {
+        node_t* left_bound = first_chunck->prev_chunck_ptr_m;
+        node_t* right_bound = last_chunck->next_chunck_ptr_m;
+
+        index_m.DetachRange(first_chunck, last_chunck);
+
+        try {
+            iterator result_itr = operation();
+            AttachRange(left_bound, right_bound);
+            return result_itr;
+        } catch(...) {
+            AttachRange(left_bound, right_bound);
+            throw;
+        }
+    };
+
+
+    template<typename OperationType>
+    iterator InsertReindexed(const_iterator pos_itr, OperationType&& operation) {
+        node_t* pos_chunck = static_cast<node_t*>(pos_itr.base());
+
+        if (!pos_chunck) {
+            iterator result_itr = operation();
+            RebuildIndex();
+            return result_itr;
+        }
+
+        node_t* first_chunck = pos_chunck->prev_chunck_ptr_m ? pos_chunck->prev_chunck_ptr_m : pos_chunck;
+        node_t* last_chunck = pos_chunck->next_chunck_ptr_m ? pos_chunck->next_chunck_ptr_m : pos_chunck;
+        return Reindexed(first_chunck, last_chunck, std::forward<OperationType>(operation));
+    };
+
+
+    void AttachRange(node_t* left_bound, node_t* right_bound) noexcept {
+        node_t* current = left_bound ? left_bound->next_chunck_ptr_m : this->begin_chunck_ptr_m;
+
+        for (node_t* after = left_bound; current && current != right_bound;
+          after = current, current = current->next_chunck_ptr_m) {
+            index_m.Attach(current, after);
+        }
+    };
+
+
+    /* Runs an operation which relinks the whole chunck chain and rebuilds the index after it */
+    template<typename OperationType>
+    void Relinked(OperationType&& operation) {
+        try {
+            operation();
+        } catch(...) {
+            RebuildIndex();
+            throw;
+        }
+        RebuildIndex();
+    };
+
+
+    void RebuildIndex() noexcept {
+        index_m.Reset();
+        AttachRange(nullptr, nullptr);
+    };
+
+
+  private:
+    index_t index_m;
+};
+
+
+} // namespace labwork7
+
+
+template<std::copy_constructible DataType, size_t ChunckSize = 10, typename AllocatorType = std::allocator<DataType>,
+    labwork7::chunck_fill_policy FillPolicyType = labwork7::fill_policy::balanced>
+using indexed_unrolled_list = labwork7::indexed_unrolled_list<DataType, ChunckSize, AllocatorType, FillPolicyType>;
+
+#endif // _INDEXED_UNROLLED_LIST_HPP_
@@ -0,0 +1,181 @@
+#ifndef _MAPPED_UNROLLED_LIST_HPP_
+#define _MAPPED_UNROLLED_LIST_HPP_
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <span>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <sys/mman.h>
+
+#include "details/binary_snapshot.hpp"
+
+namespace labwork7 {
+
+/*
+    Read-only view of a snapshot written by labwork7::save() from unrolled_list_io.hpp, the file is mmaped
+    and the elements are read in place, so opening costs a header check and a pass over the chunck table.
+    The elements lie back to back in list order, the iterators are plain pointers.
+*/
+template<typename DataType>
+requires std::is_trivially_copyable_v<DataType>
+class mapped_unrolled_list {
+  public:
+    using value_type = DataType;
+    using reference = const value_type&;
+    using const_reference = const value_type&;
+    using pointer = const value_type*;
+    using const_pointer = const value_type*;
+
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    using iterator = const value_type*;
+    using const_iterator = const value_type*;
+
+  public:
+    mapped_unrolled_list() noexcept = default;
+
+    explicit mapped_unrolled_list(const std::filesystem::path& path) {
+        details::FileDescriptor file(path, O_RDONLY);
+        mapping_bytes_m = file.file_size();
+
+        if (mapping_bytes_m < sizeof(details::SnapshotHeader)) {
+            throw std::runtime_error{"unrolled_list snapshot: file is truncated"};
+        }
+
+        mapping_ptr_m = ::mmap(nullptr, mapping_bytes_m, PROT_READ, MAP_SHARED, file.get(), 0);
+        if (mapping_ptr_m == MAP_FAILED) {
+            mapping_ptr_m = nullptr;
+            throw std::system_error{errno, std::generic_category(), "unrolled_list snapshot: mmap"};
+        }
+
+        try {
+            Attach();
+        } catch(...) {
+            Unmap();
+            throw;
+        }
+    };
+
+
+    mapped_unrolled_list(const mapped_unrolled_list&) = delete;
+    mapped_unrolled_list& operator=(const mapped_unrolled_list&) = delete;
+
+    mapped_unrolled_list(mapped_unrolled_list&& value) noexcept {
+        swap(value);
+    };
+
+    mapped_unrolled_list& operator=(mapped_unrolled_list&& value) noexcept {
+        mapped_unrolled_list moved(std::move(value));
+        swap(moved);
+        return *this;
+    };
+
+    ~mapped_unrolled_list() noexcept {
+        Unmap();
+    };
+
+  public:
+    iterator begin() const noexcept { return elements_ptr_m; };
+    iterator end() const noexcept { return elements_ptr_m + size_m; };
+    const_iterator cbegin() const noexcept { return begin(); };
+    const_iterator cend() const noexcept { return end(); };
+
+    std::span<const value_type> elements() const noexcept { return {elements_ptr_m, size_m}; };
+
+    /* Calls func with a span over every chunck of the saved list, in list order */
+    template<typename FuncType>
+    void for_each_chunck(FuncType func) const {
+        const value_type* chunck_begin = elements_ptr_m;
+        for (size_type ind = 0; ind != chunck_count_m; ++ind) {
+            func(std::span<const value_type>{chunck_begin, static_cast<size_type>(chunck_table_ptr_m[ind])});
+            chunck_begin += chunck_table_ptr_m[ind];
+        }
+    };
+
+  public:
+    size_type size() const noexcept { return size_m; };
+    bool empty() const noexcept { return size_m == 0; };
+    size_type chunck_count() const noexcept { return chunck_count_m; };
+
+    const_reference front() const noexcept { return elements_ptr_m[0]; };
+    const_reference back() const noexcept { return elements_ptr_m[size_m - 1]; };
+
+    const_reference operator[](size_type index) const noexcept { return elements_ptr_m[index]; };
+
+    const_reference at(size_type index) const {
+        if (index >= size_m) {
+            throw std::out_of_range{"mapped_unrolled_list::at: index is out of range"};
+        }
+        return elements_ptr_m[index];
+    };
+
+  public:
+    void swap(mapped_unrolled_list& value) noexcept {
+        std::swap(mapping_ptr_m, value.mapping_ptr_m);
+        std::swap(mapping_bytes_m, value.mapping_bytes_m);
+        std::swap(chunck_table_ptr_m, value.chunck_table_ptr_m);
+        std::swap(chunck_count_m, value.chunck_count_m);
+        std::swap(elements_ptr_m, value.elements_ptr_m);
+        std::swap(size_m, value.size_m);
+    };
+
+  private:
+    void Attach() {
+        const std::byte* mapping_begin = static_cast<const std::byte*>(mapping_ptr_m);
+
+        details::SnapshotHeader header;
+        std::memcpy(&header, mapping_begin, sizeof(header));
+        details::CheckSnapshotHeader<value_type>(header, mapping_bytes_m);
+
+        chunck_table_ptr_m = reinterpret_cast<const uint64_t*>(mapping_begin + sizeof(details::SnapshotHeader));
+        chunck_count_m = header.chunck_count_m;
+
+        uint64_t table_count = 0;
+        for (size_type ind = 0; ind != chunck_count_m; ++ind) {
+            if (chunck_table_ptr_m[ind] > header.element_count_m - table_count) {
+                throw std::runtime_error{"unrolled_list snapshot: chunck table does not match the element count"};
+            }
+            table_count += chunck_table_ptr_m[ind];
+        }
+        if (table_count != header.element_count_m) {
+            throw std::runtime_error{"unrolled_list snapshot: chunck table does not match the element count"};
+        }
+
+        elements_ptr_m = reinterpret_cast<const value_type*>(mapping_begin + header.payload_offset_m);
+        size_m = header.element_count_m;
+    };
+
+
+    void Unmap() noexcept {
+        if (mapping_ptr_m) {
+            ::munmap(mapping_ptr_m, mapping_bytes_m);
+        }
+        mapping_ptr_m = nullptr;
+    };
+
+  private:
+    void* mapping_ptr_m = nullptr;
+    size_type mapping_bytes_m = 0;
+
+    const uint64_t* chunck_table_ptr_m = nullptr;
+    size_type chunck_count_m = 0;
+
+    const value_type* elements_ptr_m = nullptr;
+    size_type size_m = 0;
+};
+
+} // namespace labwork7
+
+
+template<typename DataType>
+using mapped_unrolled_list = labwork7::mapped_unrolled_list<DataType>;
+
+#endif // _MAPPED_UNROLLED_LIST_HPP_
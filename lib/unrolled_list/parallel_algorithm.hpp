@@ -0,0 +1,380 @@
+#ifndef _UNROLLED_LIST_PARALLEL_ALGORITHM_HPP_
+#define _UNROLLED_LIST_PARALLEL_ALGORITHM_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <execution>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "algorithm.hpp"
+#include "segmented_iterator.hpp"
+#include "details/thread_pool.hpp"
+
+namespace labwork7 {
+
+/*
+    Execution policy overloads of the chunck-aware algorithms.
+    The chunck chain is cut at chunck boundaries into work units of whole chuncks, every unit runs
+    the sequential algorithm from algorithm.hpp, and the units are spread over details::WorkStealingPool.
+    Define UNROLLED_LIST_STD_PARALLEL_BACKEND to hand the units to std::for_each(std::execution::par, ...)
+    instead, exceptions thrown by the callables then end up in std::terminate.
+    sequenced and unsequenced policies run the sequential algorithm right away.
+*/
+
+namespace details {
+
+template<typename PolicyType>
+concept execution_policy = std::is_execution_policy_v<std::remove_cvref_t<PolicyType>>;
+
+template<typename PolicyType>
+concept parallel_execution_policy = execution_policy<PolicyType>
+    && (std::same_as<std::remove_cvref_t<PolicyType>, std::execution::parallel_policy>
+        || std::same_as<std::remove_cvref_t<PolicyType>, std::execution::parallel_unsequenced_policy>);
+
+
+/*
+    Elements of a work unit: small enough to leave plenty of units for stealing,
+    big enough to pay off the hand-over to another thread.
+*/
+inline constexpr size_t kParallelUnitElements = 16384;
+
+/* Most of the tasks a single parallel call is split into, the work units included */
+inline constexpr size_t kParallelTaskBlocks = 256;
+
+
+template<typename ItrType>
+struct WorkUnit {
+    ItrType first_m;
+    ItrType last_m;
+    size_t size_m;
+};
+
+
+/* Work units of one call, in the list order */
+template<typename ItrType>
+struct WorkUnits {
+    WorkUnit<ItrType> units_m[kParallelTaskBlocks];
+    size_t count_m = 0;
+
+    size_t size() const noexcept { return count_m; };
+    WorkUnit<ItrType>& operator[](size_t index) noexcept { return units_m[index]; };
+    const WorkUnit<ItrType>* begin() const noexcept { return units_m; };
+    const WorkUnit<ItrType>* end() const noexcept { return units_m + count_m; };
+
+    /* Joins every pair of neighbour units, the units get twice as big */
+    void Coalesce() noexcept {
+        size_t joined_count = 0;
+        for (size_t ind = 0; ind < count_m; ind += 2) {
+            WorkUnit<ItrType> unit = units_m[ind];
+            if (ind + 1 != count_m) {
+                unit.last_m = units_m[ind + 1].last_m;
+                unit.size_m += units_m[ind + 1].size_m;
+            }
+            units_m[joined_count++] = unit;
+        }
+        count_m = joined_count;
+    };
+};
+
+
+/*
+    Cuts [first, last) into work units at chunck boundaries in one pass over the chunck headers.
+    Once there are kParallelTaskBlocks units the neighbours are joined and the unit size doubles.
+*/
+template<segmented_iterator ItrType>
+WorkUnits<ItrType> PartitionUnits(ItrType first, ItrType last) {
+    using traits = segmented_iterator_traits<ItrType>;
+
+    WorkUnits<ItrType> units;
+    if (first == last) {
+        return units;
+    }
+
+    auto last_segment = traits::segment(last);
+    auto unit_segment = traits::segment(first);
+    auto unit_local = traits::local(first);
+    size_t unit_size = 0;
+    size_t unit_elements = kParallelUnitElements;
+
+    for (auto segment = unit_segment, local_first = unit_local; ; ) {
+        auto local_last = segment == last_segment ? traits::local(last) : traits::end(segment);
+        unit_size += local_last - local_first;
+
+        if (segment == last_segment || unit_size >= unit_elements) {
+            ItrType unit_last = segment == last_segment ? last : traits::compose(segment, local_last);
+
+            if (unit_size) {
+                if (units.count_m == kParallelTaskBlocks) {
+                    units.Coalesce();
+                    unit_elements *= 2;
+                }
+                units[units.count_m++] = WorkUnit<ItrType>{traits::compose(unit_segment, unit_local), unit_last, unit_size};
+            }
+            if (segment == last_segment) {
+                break;
+            }
+
+            unit_size = 0;
+            unit_segment = traits::next(segment);
+            unit_local = traits::begin(unit_segment);
+        }
+
+        segment = traits::next(segment);
+        local_first = traits::begin(segment);
+    }
+
+    return units;
+}
+
+
+/* Calls unit_func(index) for every unit index of [0, unit_count) concurrently, unit_count is up to kParallelTaskBlocks */
+template<typename UnitFuncType>
+void RunUnits(size_t unit_count, UnitFuncType&& unit_func) {
+#if defined(UNROLLED_LIST_STD_PARALLEL_BACKEND)
+    size_t indices[kParallelTaskBlocks];
+    std::iota(indices, indices + unit_count, size_t{0});
+    std::for_each(std::execution::par, indices, indices + unit_count, [&](size_t index) { unit_func(index); });
+#else
+    WorkStealingPool::Default().Run(unit_count, unit_func);
+#endif
+}
+
+
+/* Tasks policy of the parallel sort, see unrolled_list::SequentialSortTasks */
+struct ParallelSortTasks {
+    static constexpr size_t kMaxTasks = kParallelTaskBlocks;
+    static constexpr size_t kMinTaskElements = kParallelUnitElements;
+    using lock_type = std::mutex;
+
+    template<typename TaskType>
+    void operator()(size_t count, TaskType&& task) const {
+        RunUnits(count, task);
+    };
+};
+
+
+/* Gives the parallel sort access to the chunck merging of unrolled_list */
+struct ListSortAccess {
+    template<typename ListType, typename CompareType>
+    static void Sort(ListType& list, CompareType& comp, bool is_stable) {
+        list.SortChuncks(comp, is_stable, ParallelSortTasks{});
+    };
+};
+
+} // namespace details
+
+
+template<details::execution_policy PolicyType, segmented_iterator ItrType, typename FuncType>
+void for_each(PolicyType&&, ItrType first, ItrType last, FuncType func) {
+    if constexpr (!details::parallel_execution_policy<PolicyType>) {
+        labwork7::for_each(first, last, std::move(func));
+    } else {
+        auto units = details::PartitionUnits(first, last);
+
+        details::RunUnits(units.size(), [&](size_t index) {
+            labwork7::for_each(units[index].first_m, units[index].last_m, func);
+        });
+    }
+}
+
+
+/* out has to be a forward iterator, every unit writes from its own position of it */
+template<details::execution_policy PolicyType, segmented_iterator ItrType, std::forward_iterator OutItrType,
+    typename UnaryOperationType>
+OutItrType transform(PolicyType&&, ItrType first, ItrType last, OutItrType out, UnaryOperationType operation) {
+    if constexpr (!details::parallel_execution_policy<PolicyType>) {
+        return labwork7::transform(first, last, out, std::move(operation));
+    } else {
+        auto units = details::PartitionUnits(first, last);
+
+        OutItrType unit_outs[details::kParallelTaskBlocks + 1];
+        unit_outs[0] = out;
+        for (size_t ind = 0; ind != units.size(); ++ind) {
+            using std::advance;
+
+            unit_outs[ind + 1] = unit_outs[ind];
+            if constexpr (std::same_as<OutItrType, ItrType>) {
+                /* in place every unit writes over itself, no need to walk out */
+                if (out == first) {
+                    unit_outs[ind + 1] = units[ind].last_m;
+                    continue;
+                }
+            }
+            advance(unit_outs[ind + 1], units[ind].size_m);
+        }
+
+        details::RunUnits(units.size(), [&](size_t index) {
+            labwork7::transform(units[index].first_m, units[index].last_m, unit_outs[index], operation);
+        });
+        return unit_outs[units.size()];
+    }
+}
+
+
+/*
+    Partial results of the units are combined in the list order, so operation has to be associative
+    but does not have to be commutative.
+*/
+template<details::execution_policy PolicyType, segmented_iterator ItrType, typename ValueType,
+    typename BinaryOperationType>
+ValueType reduce(PolicyType&&, ItrType first, ItrType last, ValueType init, BinaryOperationType operation) {
+    if constexpr (!details::parallel_execution_policy<PolicyType>) {
+        return labwork7::accumulate(first, last, std::move(init), std::move(operation));
+    } else {
+        auto units = details::PartitionUnits(first, last);
+        std::optional<ValueType> partials[details::kParallelTaskBlocks];
+
+        details::RunUnits(units.size(), [&](size_t index) {
+            ItrType unit_first = units[index].first_m;
+            ValueType partial = *unit_first;
+            partials[index].emplace(labwork7::accumulate(++unit_first, units[index].last_m, std::move(partial), operation));
+        });
+
+        for (size_t ind = 0; ind != units.size(); ++ind) {
+            init = operation(std::move(init), std::move(*partials[ind]));
+        }
+        return init;
+    }
+}
+
+
+template<details::execution_policy PolicyType, segmented_iterator ItrType, typename ValueType>
+ValueType reduce(PolicyType&& policy, ItrType first, ItrType last, ValueType init) {
+    if constexpr (!details::parallel_execution_policy<PolicyType> || !std::is_arithmetic_v<ValueType>) {
+        return labwork7::reduce(std::forward<PolicyType>(policy), first, last, std::move(init), std::plus<>{});
+    } else {
+        /* arithmetic sums start every unit from zero to get the vectorized accumulate */
+        auto units = details::PartitionUnits(first, last);
+        ValueType partials[details::kParallelTaskBlocks] = {};
+
+        details::RunUnits(units.size(), [&](size_t index) {
+            partials[index] = labwork7::accumulate(units[index].first_m, units[index].last_m, ValueType{});
+        });
+
+        return std::accumulate(partials, partials + units.size(), init);
+    }
+}
+
+
+template<details::execution_policy PolicyType, segmented_iterator ItrType>
+std::iter_value_t<ItrType> reduce(PolicyType&& policy, ItrType first, ItrType last) {
+    return labwork7::reduce(std::forward<PolicyType>(policy), first, last, std::iter_value_t<ItrType>{});
+}
+
+
+template<details::execution_policy PolicyType, segmented_iterator ItrType, typename PredicateType>
+std::iter_difference_t<ItrType> count_if(PolicyType&&, ItrType first, ItrType last, PredicateType pred) {
+    auto count_unit = [&](ItrType unit_first, ItrType unit_last) {
+        std::iter_difference_t<ItrType> result = 0;
+        details::SegmentedWalk(unit_first, unit_last, [&](auto local_first, auto local_last) {
+            result += std::count_if(local_first, local_last, pred);
+            return local_last;
+        });
+        return result;
+    };
+
+    if constexpr (!details::parallel_execution_policy<PolicyType>) {
+        return count_unit(first, last);
+    } else {
+        auto units = details::PartitionUnits(first, last);
+        std::iter_difference_t<ItrType> partials[details::kParallelTaskBlocks] = {};
+
+        details::RunUnits(units.size(), [&](size_t index) {
+            partials[index] = count_unit(units[index].first_m, units[index].last_m);
+        });
+
+        return std::accumulate(partials, partials + units.size(), std::iter_difference_t<ItrType>{0});
+    }
+}
+
+
+/*
+    Returns the first element satisfying pred, as the sequential find_if does.
+    A unit stops once a unit before it has found a match.
+*/
+template<details::execution_policy PolicyType, segmented_iterator ItrType, typename PredicateType>
+ItrType find_if(PolicyType&&, ItrType first, ItrType last, PredicateType pred) {
+    if constexpr (!details::parallel_execution_policy<PolicyType>) {
+        return details::SegmentedWalk(first, last, [&](auto local_first, auto local_last) {
+            return std::find_if(local_first, local_last, pred);
+        });
+    } else {
+        auto units = details::PartitionUnits(first, last);
+        ItrType found[details::kParallelTaskBlocks];
+        std::atomic<size_t> found_unit = units.size();
+
+        details::RunUnits(units.size(), [&](size_t index) {
+            ItrType unit_last = units[index].last_m;
+
+            ItrType result = details::SegmentedWalk(units[index].first_m, unit_last, [&](auto local_first, auto local_last) {
+                if (found_unit.load(std::memory_order_relaxed) < index) {
+                    return local_first;
+                }
+                return std::find_if(local_first, local_last, pred);
+            });
+
+            if (result == unit_last || found_unit.load(std::memory_order_relaxed) < index) {
+                return;
+            }
+
+            found[index] = result;
+            size_t current = found_unit.load(std::memory_order_relaxed);
+            while (index < current && !found_unit.compare_exchange_weak(current, index, std::memory_order_relaxed)) {  }
+        });
+
+        size_t result_unit = found_unit.load(std::memory_order_relaxed);
+        return result_unit == units.size() ? last : found[result_unit];
+    }
+}
+
+
+template<details::execution_policy PolicyType, segmented_iterator ItrType, typename PredicateType>
+bool any_of(PolicyType&& policy, ItrType first, ItrType last, PredicateType pred) {
+    return labwork7::find_if(std::forward<PolicyType>(policy), first, last, std::move(pred)) != last;
+}
+
+
+template<details::execution_policy PolicyType, segmented_iterator ItrType, typename PredicateType>
+bool all_of(PolicyType&& policy, ItrType first, ItrType last, PredicateType pred) {
+    return labwork7::find_if(std::forward<PolicyType>(policy), first, last,
+        [&](const auto& value) { return !pred(value); }) == last;
+}
+
+/*
+    Sorts segments of neighbour chuncks of list concurrently, then merges the segments in a tree,
+    the merges of one level run concurrently. Iterators of list are invalidated.
+*/
+template<details::execution_policy PolicyType, typename DataType, size_t ChunckSize, typename AllocatorType,
+    typename FillPolicyType, typename ChunckExtensionType, size_t ChunckAlignment, typename CompareType = std::less<>>
+void sort(PolicyType&&, unrolled_list<DataType, ChunckSize, AllocatorType, FillPolicyType, ChunckExtensionType, ChunckAlignment>& list,
+    CompareType comp = {}) {
+    if constexpr (!details::parallel_execution_policy<PolicyType>) {
+        list.sort(comp);
+    } else {
+        details::ListSortAccess::Sort(list, comp, false);
+    }
+}
+
+
+template<details::execution_policy PolicyType, typename DataType, size_t ChunckSize, typename AllocatorType,
+    typename FillPolicyType, typename ChunckExtensionType, size_t ChunckAlignment, typename CompareType = std::less<>>
+void stable_sort(PolicyType&&, unrolled_list<DataType, ChunckSize, AllocatorType, FillPolicyType, ChunckExtensionType, ChunckAlignment>& list,
+    CompareType comp = {}) {
+    if constexpr (!details::parallel_execution_policy<PolicyType>) {
+        list.stable_sort(comp);
+    } else {
+        details::ListSortAccess::Sort(list, comp, true);
+    }
+}
+
+} // namespace labwork7
+
+#endif // _UNROLLED_LIST_PARALLEL_ALGORITHM_HPP_
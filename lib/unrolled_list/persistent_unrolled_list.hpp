@@ -0,0 +1,937 @@
+#ifndef _PERSISTENT_UNROLLED_LIST_HPP_
+#define _PERSISTENT_UNROLLED_LIST_HPP_
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "details/storage.hpp"
+#include "fill_policy.hpp"
+#include "relocation.hpp"
+
+namespace labwork7 {
+
+namespace details {
+
+/* Versions and branches which link a node, the node is freed when the last of them lets it go */
+struct SharedNodeCount {
+    std::atomic<size_t> ref_count_m = 1;
+};
+
+
+/* Inner node of the counted tree above the chuncks, keeps the amount of elements under every child */
+template<size_t kBranching>
+struct PersistentBranch {
+    SharedNodeCount count_m;
+    size_t child_count_m = 0;
+    size_t subtree_size_m[kBranching] = {};
+    void* child_ptr_m[kBranching] = {};
+};
+
+} // namespace details
+
+
+/*
+    unrolled_list whose versions share structure, for readers which need a consistent snapshot
+    while a writer keeps changing the list.
+
+    Chuncks hang under a B-tree of branches which count the elements under each child, so positional
+    access walks O(log(N / ChunckSize)) branches. Chuncks and branches count the versions and branches
+    linking them. snapshot() and copies take one more reference to the root: O(1). A mutation first
+    makes the path to the touched chunck its own, copying only the nodes on it which are still shared,
+    then changes that path in place, so a version which shares nothing copies nothing. Nodes of old
+    versions are freed once the last reference to them drops.
+
+    Different versions may be used from different threads, a single version is not synchronized.
+*/
+template<std::copy_constructible DataType, size_t ChunckSize = 64, typename AllocatorType = std::allocator<DataType>,
+    chunck_fill_policy FillPolicyType = fill_policy::balanced>
+class persistent_unrolled_list {
+    static_assert(ChunckSize > 1, "a full chunck has to split into two");
+    static_assert(is_nothrow_relocatable_v<DataType>, "elements are relocated between chuncks of a single version");
+
+  private:
+    static constexpr size_t kBranching = 16;
+
+    /* non-root branches keep at least half of kBranching children, so the height never gets close */
+    static constexpr size_t kMaxHeight = 24;
+
+    static constexpr size_t kSpareChuncks = 2;
+
+    using node_t = UnrolledListNodeChunck<DataType, ChunckSize, details::SharedNodeCount>;
+    using branch_t = details::PersistentBranch<kBranching>;
+    using node_traits_t = chunck_traits<node_t, AllocatorType>;
+    using branch_traits_t = chunck_traits<branch_t, AllocatorType>;
+    using fill_traits = details::fill_policy_traits<FillPolicyType, ChunckSize>;
+
+    /* A branch on the way down from the root and the child the way goes on through */
+    struct PathStep {
+        branch_t* branch_m = nullptr;
+        size_t child_index_m = 0;
+    };
+
+    using path_t = std::array<PathStep, kMaxHeight>;
+
+  public:
+    using value_type = DataType;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using pointer = value_type*;
+    using const_pointer = const value_type*;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    using allocator_type = typename node_traits_t::allocator_type;
+
+  private:
+    using branch_allocator_type = typename branch_traits_t::allocator_type;
+    using data_allocator_type = typename std::allocator_traits<AllocatorType>::template rebind_alloc<value_type>;
+    using data_allocator_trait_t = std::allocator_traits<data_allocator_type>;
+
+  public:
+    /* Forward iterator over one version, stays valid while that version is not changed */
+    class Iterator {
+      public:
+        using iterator_concept = std::forward_iterator_tag;
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = persistent_unrolled_list::value_type;
+        using difference_type = persistent_unrolled_list::difference_type;
+        using reference = persistent_unrolled_list::const_reference;
+        using pointer = persistent_unrolled_list::const_pointer;
+
+      public:
+        Iterator() noexcept = default;
+
+      public:
+        reference operator*() const noexcept { return chunck_ptr_m->data_m[chunck_offset_m]; };
+        pointer operator->() const noexcept { return chunck_ptr_m->data_m + chunck_offset_m; };
+
+        Iterator& operator++() noexcept {
+            if (++chunck_offset_m == chunck_ptr_m->size_m) {
+                NextChunck();
+            }
+            return *this;
+        };
+
+        Iterator operator++(int) noexcept {
+            Iterator result_itr = *this;
+            ++(*this);
+            return result_itr;
+        };
+
+        bool operator==(const Iterator& value) const noexcept {
+            return chunck_ptr_m == value.chunck_ptr_m && chunck_offset_m == value.chunck_offset_m;
+        };
+
+      private:
+        friend class persistent_unrolled_list;
+
+        Iterator(void* root_ptr, size_t height) noexcept : height_m(height) {
+            if (root_ptr) {
+                DescendLeftmost(root_ptr, 0);
+            }
+        };
+
+
+        void DescendLeftmost(void* link, size_t depth) noexcept {
+            for (; depth != height_m; ++depth) {
+                branch_t* branch = AsBranch(link);
+                path_m[depth] = PathStep{branch, 0};
+                link = branch->child_ptr_m[0];
+            }
+            chunck_ptr_m = AsChunck(link);
+            chunck_offset_m = 0;
+        };
+
+
+        void NextChunck() noexcept {
+            size_t depth = height_m;
+            while (depth && path_m[depth - 1].child_index_m + 1 == path_m[depth - 1].branch_m->child_count_m) {
+                --depth;
+            }
+
+            if (!depth) {
+                chunck_ptr_m = nullptr;
+                chunck_offset_m = 0;
+                return;
+            }
+
+            PathStep& step = path_m[depth - 1];
+            ++step.child_index_m;
+            DescendLeftmost(step.branch_m->child_ptr_m[step.child_index_m], depth);
+        };
+
+      private:
+        path_t path_m;
+        size_t height_m = 0;
+        node_t* chunck_ptr_m = nullptr;
+        size_t chunck_offset_m = 0;
+    };
+
+    using iterator = Iterator;
+    using const_iterator = Iterator;
+
+  public:
+    persistent_unrolled_list() : persistent_unrolled_list(allocator_type{}) {  };
+
+    explicit persistent_unrolled_list(const allocator_type& alloc)
+        : alloc_m(alloc), branch_alloc_m(alloc_m), data_alloc_m(alloc_m) {  };
+
+
+    persistent_unrolled_list(std::initializer_list<value_type> i_list, const allocator_type& alloc = allocator_type{})
+        : persistent_unrolled_list(i_list.begin(), i_list.end(), alloc) {  };
+
+
+    template<std::input_iterator InItrType>
+    persistent_unrolled_list(InItrType beg, InItrType end, const allocator_type& alloc = allocator_type{})
+        : persistent_unrolled_list(alloc) {
+        for (; beg != end; ++beg) {
+            push_back(*beg);
+        }
+    };
+
+
+    /* Shares the whole tree of value: O(1) */
+    persistent_unrolled_list(const persistent_unrolled_list& value) noexcept
+        : root_ptr_m(value.root_ptr_m), height_m(value.height_m), size_m(value.size_m),
+        alloc_m(value.alloc_m), branch_alloc_m(value.branch_alloc_m), data_alloc_m(value.data_alloc_m) {
+        if (root_ptr_m) {
+            Retain(root_ptr_m, height_m);
+        }
+    };
+
+
+    persistent_unrolled_list(persistent_unrolled_list&& value) noexcept
+        : root_ptr_m(std::exchange(value.root_ptr_m, nullptr)), height_m(std::exchange(value.height_m, 0)),
+        size_m(std::exchange(value.size_m, 0)),
+        alloc_m(value.alloc_m), branch_alloc_m(value.branch_alloc_m), data_alloc_m(value.data_alloc_m) {  };
+
+
+    persistent_unrolled_list& operator=(const persistent_unrolled_list& value) noexcept {
+        persistent_unrolled_list shared(value);
+        swap(shared);
+        return *this;
+    };
+
+
+    persistent_unrolled_list& operator=(persistent_unrolled_list&& value) noexcept {
+        persistent_unrolled_list moved(std::move(value));
+        swap(moved);
+        return *this;
+    };
+
+
+    ~persistent_unrolled_list() {
+        clear();
+        FreeSpares();
+    };
+
+  public:
+    /* Version which keeps the current contents whatever happens to this one later: O(1) */
+    persistent_unrolled_list snapshot() const noexcept { return *this; };
+
+
+    /*
+        Inserts before the element at index. The value is built first and the path to its chunck
+        is made private to this version, so the list stays the same when either of them throws.
+    */
+    template<typename... ArgsTs>
+    requires std::constructible_from<value_type, ArgsTs...>
+    void emplace(size_type index, ArgsTs&&... args) {
+        if (index > size_m) {
+            throw std::out_of_range{"persistent_unrolled_list::emplace: index is out of range"};
+        }
+
+        value_type value(std::forward<ArgsTs>(args)...);
+
+        if (!root_ptr_m) {
+            node_t* added_chunck = AcquireChunck();
+            PlaceInto(added_chunck, 0, value);
+            root_ptr_m = added_chunck;
+            size_m = 1;
+            return;
+        }
+
+        path_t path;
+        size_type offset = index;
+        node_t* current_chunck = OwnPath(offset, path, true);
+        ReserveSpares(height_m + 1, 1);
+
+        /* nothing throws from here on */
+        void* sibling_ptr = nullptr;
+        size_type sibling_size = 0;
+
+        if (current_chunck->size_m != ChunckSize) {
+            PlaceInto(current_chunck, offset, value);
+        } else {
+            node_t* split_chunck = SplitPlace(current_chunck, offset, value);
+            sibling_ptr = split_chunck;
+            sibling_size = split_chunck->size_m;
+        }
+        ++size_m;
+
+        for (size_t depth = height_m; depth--;) {
+            auto [branch, child_index] = path[depth];
+            ++branch->subtree_size_m[child_index];
+
+            if (sibling_ptr) {
+                branch->subtree_size_m[child_index] -= sibling_size;
+                std::tie(sibling_ptr, sibling_size) = InsertChild(branch, child_index + 1, sibling_ptr, sibling_size);
+            }
+        }
+
+        if (sibling_ptr) {
+            branch_t* added_root = AcquireBranch();
+            added_root->child_count_m = 2;
+            added_root->child_ptr_m[0] = root_ptr_m;
+            added_root->subtree_size_m[0] = size_m - sibling_size;
+            added_root->child_ptr_m[1] = sibling_ptr;
+            added_root->subtree_size_m[1] = sibling_size;
+
+            root_ptr_m = added_root;
+            ++height_m;
+        }
+    };
+
+
+    template<std::convertible_to<value_type> SameType>
+    void insert(size_type index, SameType&& value) { emplace(index, std::forward<SameType>(value)); };
+
+    template<std::convertible_to<value_type> SameType>
+    void push_back(SameType&& value) { emplace(size_m, std::forward<SameType>(value)); };
+
+    template<std::convertible_to<value_type> SameType>
+    void push_front(SameType&& value) { emplace(0, std::forward<SameType>(value)); };
+
+
+    /* Erases the element at index, its chunck is merged with or borrows from a neighbour when it gets too empty */
+    void erase(size_type index) {
+        if (index >= size_m) {
+            throw std::out_of_range{"persistent_unrolled_list::erase: index is out of range"};
+        }
+
+        path_t path;
+        size_type offset = index;
+        node_t* current_chunck = OwnPath(offset, path, false);
+
+        /* a neighbour per level may have to be copied to rebalance with it */
+        ReserveSpares(height_m, 1);
+
+        data_allocator_trait_t::destroy(data_alloc_m, current_chunck->data_m + offset);
+        Relocate(current_chunck->data_m + offset + 1, current_chunck->data_m + current_chunck->size_m,
+            current_chunck->data_m + offset);
+        --current_chunck->size_m;
+        --size_m;
+
+        for (size_t depth = height_m; depth--;) {
+            auto [branch, child_index] = path[depth];
+            --branch->subtree_size_m[child_index];
+            Rebalance(branch, child_index, height_m - depth - 1);
+        }
+
+        ShrinkRoot();
+    };
+
+
+    void pop_back() { erase(size_m - 1); };
+    void pop_front() { erase(0); };
+
+
+    /* Calls func(element) on the element at index, whose chunck is made private to this version first */
+    template<typename FuncType>
+    void update(size_type index, FuncType&& func) {
+        if (index >= size_m) {
+            throw std::out_of_range{"persistent_unrolled_list::update: index is out of range"};
+        }
+
+        path_t path;
+        size_type offset = index;
+        node_t* current_chunck = OwnPath(offset, path, false);
+        func(current_chunck->data_m[offset]);
+    };
+
+
+    template<std::convertible_to<value_type> SameType>
+    void set(size_type index, SameType&& value) {
+        update(index, [&](reference element) { element = std::forward<SameType>(value); });
+    };
+
+
+    void clear() noexcept {
+        if (root_ptr_m) {
+            Release(root_ptr_m, height_m);
+        }
+        root_ptr_m = nullptr;
+        height_m = 0;
+        size_m = 0;
+    };
+
+
+    void swap(persistent_unrolled_list& value) noexcept {
+        std::swap(root_ptr_m, value.root_ptr_m);
+        std::swap(height_m, value.height_m);
+        std::swap(size_m, value.size_m);
+        std::swap(spare_chunck_ptr_m, value.spare_chunck_ptr_m);
+        std::swap(spare_chunck_count_m, value.spare_chunck_count_m);
+        std::swap(spare_branch_ptr_m, value.spare_branch_ptr_m);
+        std::swap(spare_branch_count_m, value.spare_branch_count_m);
+        std::swap(alloc_m, value.alloc_m);
+        std::swap(branch_alloc_m, value.branch_alloc_m);
+        std::swap(data_alloc_m, value.data_alloc_m);
+    };
+
+
+    /* Calls func(std::span<const value_type>) for the elements of every chunck, in list order */
+    template<typename FuncType>
+    void for_each_chunck(FuncType&& func) const {
+        if (root_ptr_m) {
+            VisitChuncks(root_ptr_m, height_m, func);
+        }
+    };
+
+  public:
+    const_iterator begin() const noexcept { return const_iterator{root_ptr_m, height_m}; };
+    const_iterator end() const noexcept { return const_iterator{}; };
+    const_iterator cbegin() const noexcept { return begin(); };
+    const_iterator cend() const noexcept { return end(); };
+
+  public:
+    size_type size() const noexcept { return size_m; };
+    bool empty() const noexcept { return size_m == 0; };
+    allocator_type get_allocator() const noexcept { return alloc_m; };
+
+  public:
+    const_reference operator[](size_type index) const noexcept {
+        void* current = root_ptr_m;
+        for (size_t level = height_m; level; --level) {
+            branch_t* branch = AsBranch(current);
+            current = branch->child_ptr_m[FindChild(branch, index, false, level)];
+        }
+        return AsChunck(current)->data_m[index];
+    };
+
+
+    const_reference at(size_type index) const {
+        if (index >= size_m) {
+            throw std::out_of_range{"persistent_unrolled_list::at: index is out of range"};
+        }
+        return (*this)[index];
+    };
+
+
+    const_reference front() const noexcept { return (*this)[0]; };
+    const_reference back() const noexcept { return (*this)[size_m - 1]; };
+
+
+    bool operator==(const persistent_unrolled_list& value) const {
+        if (size_m != value.size_m) {
+            return false;
+        }
+        return root_ptr_m == value.root_ptr_m || std::equal(begin(), end(), value.begin());
+    };
+
+  private:
+    static node_t* AsChunck(void* link) noexcept { return static_cast<node_t*>(link); };
+    static branch_t* AsBranch(void* link) noexcept { return static_cast<branch_t*>(link); };
+
+
+    /* Links at level 0 are chuncks, the ones above are branches */
+    static std::atomic<size_t>& RefCount(void* link, size_t level) noexcept {
+        return level ? AsBranch(link)->count_m.ref_count_m : AsChunck(link)->extension_m.ref_count_m;
+    };
+
+
+    static void Retain(void* link, size_t level) noexcept {
+        RefCount(link, level).fetch_add(1, std::memory_order_relaxed);
+    };
+
+
+    /* Drops a reference, frees the node and lets its children go once it was the last one */
+    void Release(void* link, size_t level) noexcept {
+        if (RefCount(link, level).fetch_sub(1, std::memory_order_acq_rel) != 1) {
+            return;
+        }
+
+        if (!level) {
+            node_t* released_chunck = AsChunck(link);
+            DestroyElements(released_chunck->data_m, released_chunck->data_m + released_chunck->size_m);
+            ReleaseChunck(released_chunck);
+            return;
+        }
+
+        branch_t* released_branch = AsBranch(link);
+        for (size_t ind = 0; ind != released_branch->child_count_m; ++ind) {
+            Release(released_branch->child_ptr_m[ind], level - 1);
+        }
+        ReleaseBranch(released_branch);
+    };
+
+
+    /*
+        Replaces link with a private copy of the node unless this version is its only owner already.
+        A copied branch shares all the children of the original, a copied chunck copies the elements.
+    */
+    void OwnLink(void*& link, size_t level) {
+        if (RefCount(link, level).load(std::memory_order_acquire) == 1) {
+            return;
+        }
+
+        void* shared_link = link;
+        if (!level) {
+            node_t* source_chunck = AsChunck(shared_link);
+            node_t* copied_chunck = AcquireChunck();
+            CopyElements(source_chunck, copied_chunck);
+            link = copied_chunck;
+        } else {
+            branch_t* source_branch = AsBranch(shared_link);
+            branch_t* copied_branch = AcquireBranch();
+
+            copied_branch->child_count_m = source_branch->child_count_m;
+            std::copy_n(source_branch->subtree_size_m, source_branch->child_count_m, copied_branch->subtree_size_m);
+            std::copy_n(source_branch->child_ptr_m, source_branch->child_count_m, copied_branch->child_ptr_m);
+            for (size_t ind = 0; ind != copied_branch->child_count_m; ++ind) {
+                Retain(copied_branch->child_ptr_m[ind], level - 1);
+            }
+            link = copied_branch;
+        }
+
+        Release(shared_link, level);
+    };
+
+
+    void CopyElements(node_t* source_chunck, node_t* copied_chunck) {
+        if constexpr (std::is_trivially_copyable_v<value_type>) {
+            std::memcpy(static_cast<void*>(copied_chunck->data_m), static_cast<const void*>(source_chunck->data_m),
+                source_chunck->size_m * sizeof(value_type));
+            copied_chunck->size_m = source_chunck->size_m;
+        } else {
+            try {
+                for (; copied_chunck->size_m != source_chunck->size_m; ++copied_chunck->size_m) {
+                    data_allocator_trait_t::construct(data_alloc_m, copied_chunck->data_m + copied_chunck->size_m,
+                        source_chunck->data_m[copied_chunck->size_m]);
+                }
+            } catch(...) {
+                DestroyElements(copied_chunck->data_m, copied_chunck->data_m + copied_chunck->size_m);
+                ReleaseChunck(copied_chunck);
+                throw;
+            }
+        }
+    };
+
+
+    /*
+        Walks from the root to the chunck keeping index, owning every node on the way,
+        and leaves the offset inside that chunck in index. An insert stays right behind
+        the last element of a chunck which is not full instead of going to the next one.
+    */
+    node_t* OwnPath(size_type& index, path_t& path, bool is_insert) {
+        OwnLink(root_ptr_m, height_m);
+
+        void* current = root_ptr_m;
+        for (size_t depth = 0; depth != height_m; ++depth) {
+            branch_t* branch = AsBranch(current);
+            size_t level = height_m - depth;
+            size_t child_index = FindChild(branch, index, is_insert, level);
+
+            OwnLink(branch->child_ptr_m[child_index], level - 1);
+            path[depth] = PathStep{branch, child_index};
+            current = branch->child_ptr_m[child_index];
+        }
+        return AsChunck(current);
+    };
+
+
+    /* Child of branch at level which keeps index, index becomes the position inside that child */
+    static size_t FindChild(branch_t* branch, size_type& index, bool is_insert, size_t level) noexcept {
+        size_t child_index = 0;
+        while (child_index + 1 != branch->child_count_m && index >= branch->subtree_size_m[child_index]) {
+            if (is_insert && level == 1 && index == branch->subtree_size_m[child_index]
+                && branch->subtree_size_m[child_index] != ChunckSize) {
+                break;
+            }
+            index -= branch->subtree_size_m[child_index++];
+        }
+        return child_index;
+    };
+
+
+    /* Splits the full current_chunck with a spare one and puts value at offset, returns the new right half */
+    node_t* SplitPlace(node_t* current_chunck, size_t offset, value_type& value) noexcept {
+        node_t* split_chunck = AcquireChunck();
+
+        /* appending to the end starts a new chunck instead of leaving two half empty ones */
+        size_t split_keep = offset == ChunckSize ? ChunckSize : fill_traits::split_keep;
+
+        Relocate(current_chunck->data_m + split_keep, current_chunck->data_m + ChunckSize, split_chunck->data_m);
+        split_chunck->size_m = ChunckSize - split_keep;
+        current_chunck->size_m = split_keep;
+
+        if (offset >= split_keep) {
+            PlaceInto(split_chunck, offset - split_keep, value);
+        } else {
+            PlaceInto(current_chunck, offset, value);
+        }
+        return split_chunck;
+    };
+
+
+    void PlaceInto(node_t* current_chunck, size_t offset, value_type& value) noexcept {
+        Relocate(current_chunck->data_m + offset, current_chunck->data_m + current_chunck->size_m,
+            current_chunck->data_m + offset + 1);
+        data_allocator_trait_t::construct(data_alloc_m, current_chunck->data_m + offset, std::move(value));
+        ++current_chunck->size_m;
+    };
+
+
+    /*
+        Links child at position of the owned branch. A full branch is split with a spare one first,
+        the new right half is returned together with the amount of elements under it.
+    */
+    std::pair<void*, size_type> InsertChild(branch_t* branch, size_t position, void* child, size_type child_size) noexcept {
+        if (branch->child_count_m != kBranching) {
+            PlaceChild(branch, position, child, child_size);
+            return {nullptr, 0};
+        }
+
+        branch_t* split_branch = AcquireBranch();
+        size_t split_keep = position == kBranching ? kBranching : kBranching / 2;
+
+        MoveChildren(branch, split_keep, kBranching - split_keep, split_branch, 0);
+
+        if (position >= split_keep) {
+            PlaceChild(split_branch, position - split_keep, child, child_size);
+        } else {
+            PlaceChild(branch, position, child, child_size);
+        }
+        return {split_branch, SubtreeSize(split_branch)};
+    };
+
+
+    static void PlaceChild(branch_t* branch, size_t position, void* child, size_type child_size) noexcept {
+        size_t count = branch->child_count_m;
+        std::copy_backward(branch->child_ptr_m + position, branch->child_ptr_m + count, branch->child_ptr_m + count + 1);
+        std::copy_backward(branch->subtree_size_m + position, branch->subtree_size_m + count, branch->subtree_size_m + count + 1);
+        branch->child_ptr_m[position] = child;
+        branch->subtree_size_m[position] = child_size;
+        ++branch->child_count_m;
+    };
+
+
+    static void RemoveChild(branch_t* branch, size_t position) noexcept {
+        size_t count = branch->child_count_m;
+        std::copy(branch->child_ptr_m + position + 1, branch->child_ptr_m + count, branch->child_ptr_m + position);
+        std::copy(branch->subtree_size_m + position + 1, branch->subtree_size_m + count, branch->subtree_size_m + position);
+        --branch->child_count_m;
+    };
+
+
+    /* Moves count children of from starting at from_position in front of the children of to at to_position */
+    static void MoveChildren(branch_t* from, size_t from_position, size_t count, branch_t* to, size_t to_position) noexcept {
+        size_t to_count = to->child_count_m;
+        std::copy_backward(to->child_ptr_m + to_position, to->child_ptr_m + to_count, to->child_ptr_m + to_count + count);
+        std::copy_backward(to->subtree_size_m + to_position, to->subtree_size_m + to_count, to->subtree_size_m + to_count + count);
+        std::copy_n(from->child_ptr_m + from_position, count, to->child_ptr_m + to_position);
+        std::copy_n(from->subtree_size_m + from_position, count, to->subtree_size_m + to_position);
+        to->child_count_m += count;
+
+        for (size_t ind = 0; ind != count; ++ind) {
+            RemoveChild(from, from_position);
+        }
+    };
+
+
+    static size_type SubtreeSize(const branch_t* branch) noexcept {
+        size_type result = 0;
+        for (size_t ind = 0; ind != branch->child_count_m; ++ind) {
+            result += branch->subtree_size_m[ind];
+        }
+        return result;
+    };
+
+
+    /*
+        After an erase under the child at child_index of the owned branch: drops the child when it got empty,
+        merges it with or refills it from a neighbour when it got too empty. Chuncks follow the fill policy,
+        branches keep at least half of kBranching children. A shared neighbour chunck is copied only when
+        copying cannot throw, otherwise the chunck is left as it is.
+    */
+    void Rebalance(branch_t* branch, size_t child_index, size_t level) noexcept {
+        void* child = branch->child_ptr_m[child_index];
+        size_t fill = level ? AsBranch(child)->child_count_m : AsChunck(child)->size_m;
+
+        if (!fill) {
+            RemoveChild(branch, child_index);
+            Release(child, level);
+            return;
+        }
+
+        size_t threshold = level ? kBranching / 2 : fill_traits::merge_threshold;
+        if (fill >= threshold || branch->child_count_m < 2) {
+            return;
+        }
+
+        size_t left_index = child_index + 1 != branch->child_count_m ? child_index : child_index - 1;
+        size_t neighbour_index = left_index == child_index ? left_index + 1 : left_index;
+
+        if constexpr (!std::is_nothrow_copy_constructible_v<value_type>) {
+            if (!level && RefCount(branch->child_ptr_m[neighbour_index], 0).load(std::memory_order_acquire) != 1) {
+                return;
+            }
+        }
+        OwnLink(branch->child_ptr_m[neighbour_index], level);
+
+        if (level) {
+            RebalanceBranches(branch, left_index);
+        } else {
+            RebalanceChuncks(branch, left_index);
+        }
+    };
+
+
+    void RebalanceChuncks(branch_t* branch, size_t left_index) noexcept {
+        node_t* left_chunck = AsChunck(branch->child_ptr_m[left_index]);
+        node_t* right_chunck = AsChunck(branch->child_ptr_m[left_index + 1]);
+        size_t left_size = left_chunck->size_m;
+        size_t right_size = right_chunck->size_m;
+
+        if (left_size + right_size <= fill_traits::merge_limit) {
+            Relocate(right_chunck->data_m, right_chunck->data_m + right_size, left_chunck->data_m + left_size);
+            left_chunck->size_m += right_size;
+            right_chunck->size_m = 0;
+
+            branch->subtree_size_m[left_index] += right_size;
+            RemoveChild(branch, left_index + 1);
+            Release(right_chunck, 0);
+            return;
+        }
+
+        if (left_size < fill_traits::merge_threshold) {
+            size_t moved = std::min(fill_traits::borrow_count, right_size - fill_traits::merge_threshold);
+
+            Relocate(right_chunck->data_m, right_chunck->data_m + moved, left_chunck->data_m + left_size);
+            Relocate(right_chunck->data_m + moved, right_chunck->data_m + right_size, right_chunck->data_m);
+            left_chunck->size_m += moved;
+            right_chunck->size_m -= moved;
+
+            branch->subtree_size_m[left_index] += moved;
+            branch->subtree_size_m[left_index + 1] -= moved;
+        } else {
+            size_t moved = std::min(fill_traits::borrow_count, left_size - fill_traits::merge_threshold);
+
+            Relocate(right_chunck->data_m, right_chunck->data_m + right_size, right_chunck->data_m + moved);
+            Relocate(left_chunck->data_m + left_size - moved, left_chunck->data_m + left_size, right_chunck->data_m);
+            left_chunck->size_m -= moved;
+            right_chunck->size_m += moved;
+
+            branch->subtree_size_m[left_index] -= moved;
+            branch->subtree_size_m[left_index + 1] += moved;
+        }
+    };
+
+
+    void RebalanceBranches(branch_t* branch, size_t left_index) noexcept {
+        branch_t* left_branch = AsBranch(branch->child_ptr_m[left_index]);
+        branch_t* right_branch = AsBranch(branch->child_ptr_m[left_index + 1]);
+        size_t left_count = left_branch->child_count_m;
+        size_t right_count = right_branch->child_count_m;
+
+        if (left_count + right_count <= kBranching) {
+            MoveChildren(right_branch, 0, right_count, left_branch, left_count);
+
+            branch->subtree_size_m[left_index] += branch->subtree_size_m[left_index + 1];
+            RemoveChild(branch, left_index + 1);
+            Release(right_branch, 1);
+            return;
+        }
+
+        size_t left_target = (left_count + right_count) / 2;
+        if (left_count < left_target) {
+            MoveChildren(right_branch, 0, left_target - left_count, left_branch, left_count);
+        } else {
+            MoveChildren(left_branch, left_target, left_count - left_target, right_branch, 0);
+        }
+
+        size_type left_size = SubtreeSize(left_branch);
+        branch->subtree_size_m[left_index + 1] += branch->subtree_size_m[left_index] - left_size;
+        branch->subtree_size_m[left_index] = left_size;
+    };
+
+
+    /* Drops the owned root levels which are left with a single child */
+    void ShrinkRoot() noexcept {
+        if (!size_m) {
+            clear();
+            return;
+        }
+
+        while (height_m && AsBranch(root_ptr_m)->child_count_m == 1) {
+            branch_t* root_branch = AsBranch(root_ptr_m);
+            root_ptr_m = root_branch->child_ptr_m[0];
+            root_branch->child_count_m = 0;
+            ReleaseBranch(root_branch);
+            --height_m;
+        }
+    };
+
+
+    template<typename FuncType>
+    static void VisitChuncks(void* link, size_t level, FuncType& func) {
+        if (!level) {
+            node_t* current_chunck = AsChunck(link);
+            func(std::span<const value_type>(current_chunck->data_m, current_chunck->size_m));
+            return;
+        }
+
+        branch_t* branch = AsBranch(link);
+        for (size_t ind = 0; ind != branch->child_count_m; ++ind) {
+            VisitChuncks(branch->child_ptr_m[ind], level - 1, func);
+        }
+    };
+
+
+    /* Stocks the spare caches, so that the rest of a mutation takes its nodes without reaching the allocator */
+    void ReserveSpares(size_type branch_count, size_type chunck_count) {
+        while (spare_branch_count_m < branch_count) {
+            branch_t* created_branch = branch_traits_t::CreateChunck(branch_alloc_m);
+            created_branch->child_ptr_m[0] = spare_branch_ptr_m;
+            spare_branch_ptr_m = created_branch;
+            ++spare_branch_count_m;
+        }
+
+        while (spare_chunck_count_m < chunck_count) {
+            node_t* created_chunck = node_traits_t::CreateChunck(alloc_m);
+            created_chunck->next_chunck_ptr_m = spare_chunck_ptr_m;
+            spare_chunck_ptr_m = created_chunck;
+            ++spare_chunck_count_m;
+        }
+    };
+
+
+    /* An empty chunck owned by this version only, from the spare cache or the allocator */
+    node_t* AcquireChunck() {
+        if (!spare_chunck_ptr_m) {
+            return node_traits_t::CreateChunck(alloc_m);
+        }
+
+        node_t* acquired_chunck = std::exchange(spare_chunck_ptr_m, spare_chunck_ptr_m->next_chunck_ptr_m);
+        acquired_chunck->next_chunck_ptr_m = nullptr;
+        acquired_chunck->extension_m.ref_count_m.store(1, std::memory_order_relaxed);
+        --spare_chunck_count_m;
+        return acquired_chunck;
+    };
+
+
+    void ReleaseChunck(node_t* released_chunck) noexcept {
+        if (spare_chunck_count_m >= kSpareChuncks) {
+            node_traits_t::RemoveChunck(released_chunck, alloc_m);
+            return;
+        }
+
+        released_chunck->size_m = 0;
+        released_chunck->next_chunck_ptr_m = spare_chunck_ptr_m;
+        spare_chunck_ptr_m = released_chunck;
+        ++spare_chunck_count_m;
+    };
+
+
+    branch_t* AcquireBranch() {
+        if (!spare_branch_ptr_m) {
+            return branch_traits_t::CreateChunck(branch_alloc_m);
+        }
+
+        branch_t* acquired_branch = std::exchange(spare_branch_ptr_m, AsBranch(spare_branch_ptr_m->child_ptr_m[0]));
+        acquired_branch->child_ptr_m[0] = nullptr;
+        acquired_branch->count_m.ref_count_m.store(1, std::memory_order_relaxed);
+        --spare_branch_count_m;
+        return acquired_branch;
+    };
+
+
+    /* Spare branches are linked through the first child, a split of every level fits into the cache */
+    void ReleaseBranch(branch_t* released_branch) noexcept {
+        if (spare_branch_count_m >= height_m + 2) {
+            branch_traits_t::RemoveChunck(released_branch, branch_alloc_m);
+            return;
+        }
+
+        released_branch->child_count_m = 0;
+        released_branch->child_ptr_m[0] = spare_branch_ptr_m;
+        spare_branch_ptr_m = released_branch;
+        ++spare_branch_count_m;
+    };
+
+
+    void FreeSpares() noexcept {
+        while (spare_chunck_ptr_m) {
+            node_traits_t::RemoveChunck(std::exchange(spare_chunck_ptr_m, spare_chunck_ptr_m->next_chunck_ptr_m), alloc_m);
+        }
+        while (spare_branch_ptr_m) {
+            branch_traits_t::RemoveChunck(std::exchange(spare_branch_ptr_m, AsBranch(spare_branch_ptr_m->child_ptr_m[0])),
+                branch_alloc_m);
+        }
+        spare_chunck_count_m = spare_branch_count_m = 0;
+    };
+
+
+    /* Moves [from, to) to dest, the ranges may overlap in either direction */
+    void Relocate(pointer from, pointer to, pointer dest) noexcept {
+        if constexpr (is_trivially_relocatable_v<value_type>) {
+            details::RelocateBytes(dest, from, to - from);
+        } else if (dest < from) {
+            for (; from != to; ++from, ++dest) {
+                data_allocator_trait_t::construct(data_alloc_m, dest, std::move(*from));
+                data_allocator_trait_t::destroy(data_alloc_m, from);
+            }
+        } else {
+            for (pointer dest_end = dest + (to - from); to != from;) {
+                data_allocator_trait_t::construct(data_alloc_m, --dest_end, std::move(*--to));
+                data_allocator_trait_t::destroy(data_alloc_m, to);
+            }
+        }
+    };
+
+
+    void DestroyElements(pointer from, pointer to) noexcept {
+        if constexpr (!std::is_trivially_destructible_v<value_type>) {
+            for (; from != to; ++from) {
+                data_allocator_trait_t::destroy(data_alloc_m, from);
+            }
+        }
+    };
+
+  private:
+    /* branch_t* when height_m is above 0, node_t* otherwise */
+    void* root_ptr_m = nullptr;
+    size_type height_m = 0;
+    size_type size_m = 0;
+
+    /* nodes of this version kept for reuse, never shared with other versions */
+    node_t* spare_chunck_ptr_m = nullptr;
+    size_type spare_chunck_count_m = 0;
+    branch_t* spare_branch_ptr_m = nullptr;
+    size_type spare_branch_count_m = 0;
+
+    [[no_unique_address]] allocator_type alloc_m;
+    [[no_unique_address]] branch_allocator_type branch_alloc_m;
+    [[no_unique_address]] data_allocator_type data_alloc_m;
+};
+
+} // namespace labwork7
+
+
+template<std::copy_constructible DataType, size_t ChunckSize = 64, typename AllocatorType = std::allocator<DataType>,
+    labwork7::chunck_fill_policy FillPolicyType = labwork7::fill_policy::balanced>
+using persistent_unrolled_list = labwork7::persistent_unrolled_list<DataType, ChunckSize, AllocatorType, FillPolicyType>;
+
+#endif // _PERSISTENT_UNROLLED_LIST_HPP_
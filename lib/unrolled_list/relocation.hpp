@@ -0,0 +1,49 @@
+#ifndef _UNROLLED_LIST_RELOCATION_HPP_
+#define _UNROLLED_LIST_RELOCATION_HPP_
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+namespace labwork7 {
+
+/*
+    Relocation is a move into raw storage followed by the destruction of the source.
+    For a trivially relocatable type it is the same as copying the bytes, so unrolled_list
+    shifts, splits and merges chuncks of such elements with a single memmove.
+
+    Trivially copyable types are relocatable out of the box, other types (handles which own
+    a heap buffer and never point to themselves) opt in by specializing the trait:
+
+        template<>
+        struct labwork7::is_trivially_relocatable<string_handle> : std::true_type {};
+*/
+template<typename DataType>
+struct is_trivially_relocatable : std::bool_constant<std::is_trivially_copyable_v<DataType>> {};
+
+
+template<typename DataType>
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<DataType>::value;
+
+
+template<typename DataType>
+inline constexpr bool is_nothrow_relocatable_v = is_trivially_relocatable_v<DataType>
+    || (std::is_nothrow_move_constructible_v<DataType> && std::is_nothrow_destructible_v<DataType>);
+
+
+namespace details {
+
+/* Relocates count elements from source to dest, the ranges may overlap */
+template<typename DataType>
+requires is_trivially_relocatable_v<DataType>
+void RelocateBytes(DataType* dest, DataType* source, size_t count) noexcept {
+    if (count) {
+        std::memmove(static_cast<void*>(dest), static_cast<const void*>(source), count * sizeof(DataType));
+    }
+}
+
+} // namespace details
+
+} // namespace labwork7
+
+#endif // _UNROLLED_LIST_RELOCATION_HPP_
@@ -0,0 +1,197 @@
+#ifndef _UNROLLED_LIST_SEGMENTED_ITERATOR_HPP_
+#define _UNROLLED_LIST_SEGMENTED_ITERATOR_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "unrolled_list.hpp"
+
+namespace labwork7 {
+
+/*
+    Segmented iterator protocol: an iterator of unrolled_list is split into
+    the chunck it points to (segment) and a plain pointer inside that chunck (local).
+    Algorithms walk segments and run contiguous loops over [begin(segment), end(segment)).
+*/
+template<typename IteratorType>
+struct segmented_iterator_traits {
+    static constexpr bool is_segmented = false;
+};
+
+
+template<typename UnrolledListType>
+struct segmented_iterator_traits<details::Iterator<UnrolledListType>> {
+    static constexpr bool is_segmented = true;
+
+    using iterator = details::Iterator<UnrolledListType>;
+    using segment_iterator = typename iterator::segment_pointer;
+    using local_iterator = typename iterator::pointer;
+
+    static segment_iterator segment(const iterator& itr) noexcept { return itr.segment(); };
+    static local_iterator local(const iterator& itr) noexcept { return itr.local(); };
+
+    static local_iterator begin(segment_iterator segment) noexcept { return segment->data_m; };
+    static local_iterator end(segment_iterator segment) noexcept { return segment->data_m + segment->size_m; };
+    static segment_iterator next(segment_iterator segment) noexcept { return segment->next_chunck_ptr_m; };
+
+    static iterator compose(segment_iterator segment, local_iterator local) noexcept {
+        if (local == end(segment) && segment->next_chunck_ptr_m) {
+            return iterator{segment->next_chunck_ptr_m, 0};
+        }
+        return iterator{segment, static_cast<size_t>(local - begin(segment))};
+    };
+};
+
+
+template<typename UnrolledListType>
+struct segmented_iterator_traits<std::basic_const_iterator<details::Iterator<UnrolledListType>>> {
+  private:
+    using base_traits = segmented_iterator_traits<details::Iterator<UnrolledListType>>;
+
+  public:
+    static constexpr bool is_segmented = true;
+
+    using iterator = std::basic_const_iterator<details::Iterator<UnrolledListType>>;
+    using segment_iterator = typename base_traits::segment_iterator;
+    using local_iterator = typename base_traits::iterator::const_pointer;
+
+    static segment_iterator segment(const iterator& itr) noexcept { return itr.base().segment(); };
+    static local_iterator local(const iterator& itr) noexcept { return itr.base().local(); };
+
+    static local_iterator begin(segment_iterator segment) noexcept { return base_traits::begin(segment); };
+    static local_iterator end(segment_iterator segment) noexcept { return base_traits::end(segment); };
+    static segment_iterator next(segment_iterator segment) noexcept { return base_traits::next(segment); };
+
+    static iterator compose(segment_iterator segment, local_iterator local) noexcept {
+        return base_traits::compose(segment, base_traits::begin(segment) + (local - begin(segment)));
+    };
+};
+
+
+template<typename IteratorType>
+concept segmented_iterator = segmented_iterator_traits<std::remove_cvref_t<IteratorType>>::is_segmented;
+
+
+namespace details {
+
+/*
+    Calls chunck_func(local_first, local_last) for every contiguous piece of [first, last).
+    chunck_func returns the local position where the walk has to stop, or local_last to continue.
+*/
+template<segmented_iterator ItrType, typename ChunckFuncType>
+ItrType SegmentedWalk(ItrType first, ItrType last, ChunckFuncType&& chunck_func) {
+    using traits = segmented_iterator_traits<ItrType>;
+
+    auto current_segment = traits::segment(first);
+    auto last_segment = traits::segment(last);
+
+    if (!current_segment) {
+        return last;
+    }
+
+    auto local_first = traits::local(first);
+    while (current_segment != last_segment) {
+        auto local_last = traits::end(current_segment);
+        auto stop_position = chunck_func(local_first, local_last);
+
+        if (stop_position != local_last) {
+            return traits::compose(current_segment, stop_position);
+        }
+
+        current_segment = traits::next(current_segment);
+        local_first = traits::begin(current_segment);
+    }
+
+    auto local_last = traits::local(last);
+    auto stop_position = chunck_func(local_first, local_last);
+
+    if (stop_position != local_last) {
+        return traits::compose(current_segment, stop_position);
+    }
+    return last;
+}
+
+
+/*
+    Picks the best element of [first, last): chunck_best(local_first, local_last) returns the best position
+    of a non-empty contiguous piece, better(candidate, best) tells whether the candidate replaces the current best.
+*/
+template<segmented_iterator ItrType, typename ChunckBestType, typename BetterType>
+ItrType SegmentedSelect(ItrType first, ItrType last, ChunckBestType&& chunck_best, BetterType&& better) {
+    using traits = segmented_iterator_traits<ItrType>;
+
+    if (first == last) {
+        return last;
+    }
+
+    auto current_segment = traits::segment(first);
+    auto last_segment = traits::segment(last);
+    auto best_segment = current_segment;
+    typename traits::local_iterator best_local = nullptr;
+
+    auto local_first = traits::local(first);
+    while (true) {
+        bool is_last_segment = current_segment == last_segment;
+        auto local_last = is_last_segment ? traits::local(last) : traits::end(current_segment);
+
+        if (local_first != local_last) {
+            auto candidate = chunck_best(local_first, local_last);
+            if (!best_local || better(*candidate, *best_local)) {
+                best_segment = current_segment;
+                best_local = candidate;
+            }
+        }
+
+        if (is_last_segment) {
+            break;
+        }
+        current_segment = traits::next(current_segment);
+        local_first = traits::begin(current_segment);
+    }
+
+    return traits::compose(best_segment, best_local);
+}
+
+
+/*
+    Writes the contiguous input [in_first, in_last) to out with chunck_func(in_first, in_last, out_local),
+    splitting the input when out is a segmented iterator itself.
+*/
+template<typename InPtrType, typename OutItrType, typename ChunckFuncType>
+OutItrType SegmentedWrite(InPtrType in_first, InPtrType in_last, OutItrType out, ChunckFuncType&& chunck_func) {
+    if constexpr (segmented_iterator<OutItrType>) {
+        using out_traits = segmented_iterator_traits<OutItrType>;
+
+        auto out_segment = out_traits::segment(out);
+        auto out_local = out_traits::local(out);
+
+        while (in_first != in_last) {
+            auto out_local_last = out_traits::end(out_segment);
+
+            if (out_local == out_local_last) {
+                out_segment = out_traits::next(out_segment);
+                out_local = out_traits::begin(out_segment);
+                continue;
+            }
+
+            std::ptrdiff_t count = std::min<std::ptrdiff_t>(in_last - in_first, out_local_last - out_local);
+            out_local = chunck_func(in_first, in_first + count, out_local);
+            in_first += count;
+        }
+
+        if (!out_segment) {
+            return out;
+        }
+        return out_traits::compose(out_segment, out_local);
+    } else {
+        return chunck_func(in_first, in_last, out);
+    }
+}
+
+} // namespace details
+
+} // namespace labwork7
+
+#endif // _UNROLLED_LIST_SEGMENTED_ITERATOR_HPP_
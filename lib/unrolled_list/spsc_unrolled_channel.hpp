@@ -0,0 +1,282 @@
+#ifndef _SPSC_UNROLLED_CHANNEL_HPP_
+#define _SPSC_UNROLLED_CHANNEL_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "details/storage.hpp"
+
+namespace labwork7 {
+
+/*
+    Channel from one producer thread to one consumer thread which hands over whole chuncks.
+
+    The producer fills a chunck nobody else sees and publishes it, once it is full or on flush(),
+    with a single release store of a link. The consumer drains published chuncks and returns
+    the empty ones to a recycling stack, which the producer takes over in one exchange when it
+    runs out of its own. Elements cost no atomic operation of their own, neither side ever waits
+    for the other and neither side allocates once the channel has grown to its working size.
+
+    max_chuncks bounds the chuncks the channel owns, counting the one the consumer stands on:
+    try_push fails rather than allocate past it. Producer methods must be called from the producer
+    thread only, consumer methods from the consumer thread only.
+*/
+template<typename DataType, size_t ChunckSize = 256, typename AllocatorType = std::allocator<DataType>>
+class spsc_unrolled_channel {
+    static_assert(ChunckSize > 0, "chunck has to keep at least one element");
+
+  private:
+    using node_t = UnrolledListNodeChunck<DataType, ChunckSize>;
+    using node_traits_t = chunck_traits<node_t, AllocatorType>;
+
+  public:
+    using value_type = DataType;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using pointer = value_type*;
+    using size_type = std::size_t;
+
+    using allocator_type = typename node_traits_t::allocator_type;
+
+  private:
+    using data_allocator_type = typename std::allocator_traits<AllocatorType>::template rebind_alloc<value_type>;
+    using data_allocator_trait_t = std::allocator_traits<data_allocator_type>;
+
+  public:
+    spsc_unrolled_channel() : spsc_unrolled_channel(std::numeric_limits<size_type>::max()) {  };
+
+    explicit spsc_unrolled_channel(size_type max_chuncks, const allocator_type& alloc = allocator_type{})
+        : max_chunck_count_m(max_chuncks), alloc_m(alloc), data_alloc_m(alloc_m) {
+        if (max_chuncks < 2) {
+            throw std::invalid_argument("spsc_unrolled_channel needs at least two chuncks");
+        }
+
+        tail_chunck_ptr_m = node_traits_t::CreateChunck(alloc_m);
+        consumer_chunck_ptr_m = tail_chunck_ptr_m;
+        chunck_count_m = 1;
+    };
+
+
+    spsc_unrolled_channel(const spsc_unrolled_channel&) = delete;
+    spsc_unrolled_channel& operator=(const spsc_unrolled_channel&) = delete;
+
+
+    ~spsc_unrolled_channel() {
+        node_t* current = consumer_chunck_ptr_m;
+        DestroyElements(current->data_m + read_offset_m, current->data_m + current->size_m);
+        while (current) {
+            node_t* next = NextLink(current).load(std::memory_order_acquire);
+            if (next) {
+                DestroyElements(next->data_m, next->data_m + next->size_m);
+            }
+            node_traits_t::RemoveChunck(std::exchange(current, next), alloc_m);
+        }
+
+        if (fill_chunck_ptr_m) {
+            DestroyElements(fill_chunck_ptr_m->data_m, fill_chunck_ptr_m->data_m + fill_chunck_ptr_m->size_m);
+            node_traits_t::RemoveChunck(fill_chunck_ptr_m, alloc_m);
+        }
+
+        RemoveChain(spare_chunck_ptr_m);
+        RemoveChain(recycled_chunck_ptr_m.load(std::memory_order_acquire));
+    };
+
+  public:
+    /* Producer: false if the channel already owns max_chuncks chuncks and none came back yet */
+    bool try_push(const value_type& value) { return try_emplace(value); };
+
+    bool try_push(value_type&& value) { return try_emplace(std::move(value)); };
+
+
+    template<typename... ArgsTs>
+    bool try_emplace(ArgsTs&&... args) {
+        if (!fill_chunck_ptr_m && !(fill_chunck_ptr_m = AcquireChunck())) [[unlikely]] {
+            return false;
+        }
+
+        node_t* fill_chunck = fill_chunck_ptr_m;
+        data_allocator_trait_t::construct(data_alloc_m, fill_chunck->data_m + fill_chunck->size_m, std::forward<ArgsTs>(args)...);
+        if (++fill_chunck->size_m == ChunckSize) {
+            Publish();
+        }
+        return true;
+    };
+
+
+    /* Producer: pushes elements from [first, last) until it runs out of chuncks, returns where it stopped */
+    template<std::input_iterator InItrType, std::sentinel_for<InItrType> SentinelType>
+    InItrType push_batch(InItrType first, SentinelType last) {
+        while (first != last) {
+            if (!fill_chunck_ptr_m && !(fill_chunck_ptr_m = AcquireChunck())) {
+                break;
+            }
+
+            node_t* fill_chunck = fill_chunck_ptr_m;
+            pointer slots = fill_chunck->data_m;
+            for (; fill_chunck->size_m != ChunckSize && first != last; ++first) {
+                data_allocator_trait_t::construct(data_alloc_m, slots + fill_chunck->size_m, *first);
+                ++fill_chunck->size_m;
+            }
+
+            if (fill_chunck->size_m == ChunckSize) {
+                Publish();
+            }
+        }
+        return first;
+    };
+
+
+    /* Producer: publishes the chunck being filled even if it is not full */
+    void flush() noexcept {
+        if (fill_chunck_ptr_m && fill_chunck_ptr_m->size_m != 0) {
+            Publish();
+        }
+    };
+
+
+    /* Consumer: moves the oldest published element into value, false if there is none */
+    bool try_pop(value_type& value) {
+        if (read_offset_m == consumer_chunck_ptr_m->size_m && !Advance()) {
+            return false;
+        }
+
+        pointer slot = consumer_chunck_ptr_m->data_m + read_offset_m;
+        value = std::move(*slot);
+        data_allocator_trait_t::destroy(data_alloc_m, slot);
+        ++read_offset_m;
+        return true;
+    };
+
+
+    /* Consumer: moves up to max_count published elements to out, returns how many */
+    template<std::output_iterator<value_type&&> OutItrType>
+    size_type pop_batch(OutItrType out, size_type max_count) {
+        size_type popped = 0;
+        while (popped != max_count) {
+            if (read_offset_m == consumer_chunck_ptr_m->size_m && !Advance()) {
+                break;
+            }
+
+            pointer first = consumer_chunck_ptr_m->data_m + read_offset_m;
+            size_t count = std::min(consumer_chunck_ptr_m->size_m - read_offset_m, max_count - popped);
+
+            out = std::move(first, first + count, out);
+            DestroyElements(first, first + count);
+            read_offset_m += count;
+            popped += count;
+        }
+        return popped;
+    };
+
+
+    /* Consumer: true if nothing published is left to pop, elements not flushed yet are not counted */
+    bool empty() const noexcept {
+        return read_offset_m == consumer_chunck_ptr_m->size_m
+            && !NextLink(consumer_chunck_ptr_m).load(std::memory_order_acquire);
+    };
+
+
+    allocator_type get_allocator() const noexcept { return alloc_m; };
+
+  private:
+    void Publish() noexcept {
+        NextLink(tail_chunck_ptr_m).store(fill_chunck_ptr_m, std::memory_order_release);
+        tail_chunck_ptr_m = std::exchange(fill_chunck_ptr_m, nullptr);
+    };
+
+
+    /* Producer: an empty chunck from the spare ones, the recycled ones or the allocator, null at max_chuncks */
+    node_t* AcquireChunck() {
+        if (!spare_chunck_ptr_m) {
+            spare_chunck_ptr_m = recycled_chunck_ptr_m.exchange(nullptr, std::memory_order_acquire);
+        }
+
+        if (spare_chunck_ptr_m) {
+            node_t* acquired_chunck = std::exchange(spare_chunck_ptr_m, spare_chunck_ptr_m->next_chunck_ptr_m);
+            acquired_chunck->size_m = 0;
+            acquired_chunck->next_chunck_ptr_m = nullptr;
+            return acquired_chunck;
+        }
+
+        if (chunck_count_m == max_chunck_count_m) {
+            return nullptr;
+        }
+        node_t* created_chunck = node_traits_t::CreateChunck(alloc_m);
+        ++chunck_count_m;
+        return created_chunck;
+    };
+
+
+    /* Consumer: steps to the next published chunck and recycles the drained one */
+    bool Advance() noexcept {
+        node_t* next = NextLink(consumer_chunck_ptr_m).load(std::memory_order_acquire);
+        if (!next) {
+            return false;
+        }
+
+        /*
+            The producer has moved its tail past the drained chunck, so the consumer owns it.
+            The push needs two attempts at most: the producer only ever swaps the stack for null.
+        */
+        node_t* drained_chunck = std::exchange(consumer_chunck_ptr_m, next);
+        node_t* top = recycled_chunck_ptr_m.load(std::memory_order_relaxed);
+        do {
+            drained_chunck->next_chunck_ptr_m = top;
+        } while (!recycled_chunck_ptr_m.compare_exchange_weak(top, drained_chunck,
+            std::memory_order_release, std::memory_order_relaxed));
+
+        read_offset_m = 0;
+        return true;
+    };
+
+
+    void DestroyElements(pointer from, pointer to) noexcept {
+        for (; from != to; ++from) {
+            data_allocator_trait_t::destroy(data_alloc_m, from);
+        }
+    };
+
+
+    void RemoveChain(node_t* current) noexcept {
+        while (current) {
+            node_traits_t::RemoveChunck(std::exchange(current, current->next_chunck_ptr_m), alloc_m);
+        }
+    };
+
+
+    /* links of published chuncks are written by the producer and read by the consumer */
+    static std::atomic_ref<node_t*> NextLink(node_t* current_chunck) noexcept {
+        return std::atomic_ref<node_t*>(current_chunck->next_chunck_ptr_m);
+    };
+
+  private:
+    /* producer side */
+    alignas(kCacheLineSize) node_t* fill_chunck_ptr_m = nullptr;
+    node_t* tail_chunck_ptr_m = nullptr;
+    node_t* spare_chunck_ptr_m = nullptr;
+    size_type chunck_count_m = 0;
+    size_type max_chunck_count_m;
+
+    /* consumer side */
+    alignas(kCacheLineSize) node_t* consumer_chunck_ptr_m = nullptr;
+    size_type read_offset_m = 0;
+
+    alignas(kCacheLineSize) std::atomic<node_t*> recycled_chunck_ptr_m = nullptr;
+
+    [[no_unique_address]] allocator_type alloc_m;
+    [[no_unique_address]] data_allocator_type data_alloc_m;
+};
+
+} // namespace labwork7
+
+
+template<typename DataType, size_t ChunckSize = 256, typename AllocatorType = std::allocator<DataType>>
+using spsc_unrolled_channel = labwork7::spsc_unrolled_channel<DataType, ChunckSize, AllocatorType>;
+
+#endif // _SPSC_UNROLLED_CHANNEL_HPP_
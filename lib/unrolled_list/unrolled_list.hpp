@@ -14,16 +14,26 @@
 #include <concepts>
 #include <memory>
 #include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <system_error>
+#include <tuple>
 #include <utility>
 #include <variant>
 #include <memory>
 
 #include "details/storage.hpp"
+#include "details/chunck_view.hpp"
+#include "fill_policy.hpp"
+#include "relocation.hpp"
 
 namespace labwork7 {
 
 namespace details {
 
+struct ListSortAccess;
+struct ListIoAccess;
+
 
 template<typename UnrolledListType>
 class Iterator : std::bidirectional_iterator_tag {
@@ -38,10 +48,14 @@ class Iterator : std::bidirectional_iterator_tag {
 
   private:
     using node_t = typename UnrolledListType::node_t;
+    using node_ptr_t = typename UnrolledListType::node_ptr_t;
+
+  public:
+    using segment_pointer = node_ptr_t;
 
   public:
     Iterator() noexcept = default;
-    Iterator(node_t* node_ptr, size_t offest) noexcept
+    Iterator(node_ptr_t node_ptr, size_t offest) noexcept
         : chunck_ptr_m(node_ptr), chunck_offset_m(offest + 1) {  };
 
   public:
@@ -77,6 +91,64 @@ class Iterator : std::bidirectional_iterator_tag {
         return result_itr;
     };
 
+    Iterator& advance(difference_type count) noexcept {
+        if (!chunck_ptr_m) {
+            return *this;
+        }
+
+        difference_type offset = static_cast<difference_type>(chunck_offset_m - 1) + count;
+
+        while (offset >= static_cast<difference_type>(chunck_ptr_m->size_m) && chunck_ptr_m->next_chunck_ptr_m) {
+            offset -= chunck_ptr_m->size_m;
+            chunck_ptr_m = chunck_ptr_m->next_chunck_ptr_m;
+        }
+
+        while (offset < 0 && chunck_ptr_m->prev_chunck_ptr_m) {
+            chunck_ptr_m = chunck_ptr_m->prev_chunck_ptr_m;
+            offset += chunck_ptr_m->size_m;
+        }
+
+        chunck_offset_m = offset + 1;
+        return *this;
+    };
+
+    /*
+        Walks the chuncks forward, then backward from this one: O(N / ChunckSize).
+        Both iterators have to belong to the same list, otherwise the result is unspecified.
+    */
+    difference_type distance_to(const Iterator& value) const noexcept {
+        if (chunck_ptr_m == value.chunck_ptr_m) {
+            return static_cast<difference_type>(value.chunck_offset_m) - static_cast<difference_type>(chunck_offset_m);
+        }
+
+        difference_type result = static_cast<difference_type>(chunck_ptr_m->size_m) - (chunck_offset_m - 1);
+        for (node_ptr_t current = chunck_ptr_m->next_chunck_ptr_m; current; current = current->next_chunck_ptr_m) {
+            if (current == value.chunck_ptr_m) {
+                return result + (value.chunck_offset_m - 1);
+            }
+            result += current->size_m;
+        }
+
+        result = -static_cast<difference_type>(chunck_offset_m - 1);
+        for (node_ptr_t current = chunck_ptr_m->prev_chunck_ptr_m; current; current = current->prev_chunck_ptr_m) {
+            result -= current->size_m;
+            if (current == value.chunck_ptr_m) {
+                return result + (value.chunck_offset_m - 1);
+            }
+        }
+
+        return 0;
+    };
+
+    template<std::integral DistanceType>
+    friend void advance(Iterator& itr, DistanceType count) noexcept {
+        itr.advance(static_cast<difference_type>(count));
+    };
+
+    friend difference_type distance(const Iterator& first, const Iterator& last) noexcept {
+        return first.distance_to(last);
+    };
+
     bool operator==(const Iterator& value) const noexcept {
         return (chunck_offset_m == value.chunck_offset_m) && (chunck_ptr_m == value.chunck_ptr_m);
     };
@@ -93,28 +165,40 @@ class Iterator : std::bidirectional_iterator_tag {
         return chunck_ptr_m->data_m + chunck_offset_m - 1;
     };
 
-    explicit operator node_t*() const noexcept { return chunck_ptr_m; };
+    explicit operator node_ptr_t() const noexcept { return chunck_ptr_m; };
 
     operator pointer() noexcept { return chunck_ptr_m->data_m + chunck_offset_m - 1; };
     operator const_pointer() const noexcept { return chunck_ptr_m->data_m + chunck_offset_m - 1; };
 
     size_t get_chunck_offset() const noexcept { return chunck_offset_m - 1; };
 
+    segment_pointer segment() const noexcept { return chunck_ptr_m; };
+    pointer local() const noexcept { return chunck_ptr_m ? chunck_ptr_m->data_m + chunck_offset_m - 1 : nullptr; };
+
   private:
     size_t chunck_offset_m = 0;
-    node_t* chunck_ptr_m = nullptr;
+    node_ptr_t chunck_ptr_m = nullptr;
 };
 
 
 } // namespace details
 
 
-template<std::copy_constructible DataType, size_t ChunckSize = 10, typename AllocatorType = std::allocator<DataType>>
+/*
+    ChunckAlignment over-aligns every chunck, 0 keeps the natural alignment.
+    unrolled_list_for_bytes picks ChunckSize and ChunckAlignment from a byte budget of a chunck.
+*/
+template<std::copy_constructible DataType, size_t ChunckSize = 10, typename AllocatorType = std::allocator<DataType>,
+    chunck_fill_policy FillPolicyType = fill_policy::balanced, typename ChunckExtensionType = EmptyChunckExtension,
+    size_t ChunckAlignment = 0>
 class unrolled_list {
     friend class details::Iterator<unrolled_list>;
+    friend struct details::ListSortAccess;
+    friend struct details::ListIoAccess;
 
   protected:
-    using node_t = UnrolledListNodeChunck<DataType, ChunckSize>;
+    using node_t = UnrolledListNodeChunck<DataType, ChunckSize, ChunckExtensionType, ChunckAlignment,
+        typename std::allocator_traits<AllocatorType>::void_pointer>;
 
   public:
     using value_type = std::decay_t<DataType>;
@@ -132,8 +216,14 @@ class unrolled_list {
     using reverse_iterator = std::reverse_iterator<iterator>;
     using const_reverse_iterator = std::basic_const_iterator<std::reverse_iterator<const_iterator>>;
 
+    using chunck_range = details::chunck_view<node_t, std::span<value_type>>;
+    using const_chunck_range = details::chunck_view<node_t, std::span<const value_type>>;
+
   protected:
     using chunck_traits = chunck_traits<node_t, AllocatorType>;
+    using node_ptr_t = typename chunck_traits::node_ptr_t;
+    static constexpr size_type kDefaultSpareChuncks = 2;
+    using fill_traits = details::fill_policy_traits<FillPolicyType, ChunckSize>;
 
   public:
     using allocator_type = typename chunck_traits::allocator_type;
@@ -164,7 +254,7 @@ class unrolled_list {
 
 
     template<size_t kAnotherSize>
-    unrolled_list(const unrolled_list<DataType, kAnotherSize, AllocatorType>& value, const AllocatorType& alloc)
+    unrolled_list(const unrolled_list<DataType, kAnotherSize, AllocatorType, FillPolicyType, ChunckExtensionType, ChunckAlignment>& value, const AllocatorType& alloc)
         : unrolled_list(value.begin(), value.end()) {
         alloc_m = alloc;
         data_alloc_m = alloc_m; 
@@ -172,22 +262,22 @@ class unrolled_list {
 
 
     template<size_t kAnotherSize>
-    unrolled_list(const unrolled_list<DataType, kAnotherSize, AllocatorType>& value)
+    unrolled_list(const unrolled_list<DataType, kAnotherSize, AllocatorType, FillPolicyType, ChunckExtensionType, ChunckAlignment>& value)
         : unrolled_list(value, value.alloc_m) {  };
 
-    unrolled_list(const unrolled_list<DataType, ChunckSize, AllocatorType>& value, const AllocatorType& alloc)
+    unrolled_list(const unrolled_list<DataType, ChunckSize, AllocatorType, FillPolicyType, ChunckExtensionType, ChunckAlignment>& value, const AllocatorType& alloc)
         : unrolled_list(value.begin(), value.end()) {
         alloc_m = alloc;
         data_alloc_m = value.data_alloc_m;
     };
 
 
-    unrolled_list(const unrolled_list<DataType, ChunckSize, AllocatorType>& value)
+    unrolled_list(const unrolled_list<DataType, ChunckSize, AllocatorType, FillPolicyType, ChunckExtensionType, ChunckAlignment>& value)
         : unrolled_list(value, value.alloc_m) {  };
 
 
     template<size_t kAnotherSize>
-    unrolled_list(unrolled_list<DataType, kAnotherSize, AllocatorType>&& value, const AllocatorType& alloc)
+    unrolled_list(unrolled_list<DataType, kAnotherSize, AllocatorType, FillPolicyType, ChunckExtensionType, ChunckAlignment>&& value, const AllocatorType& alloc)
         : alloc_m(alloc), data_alloc_m(value.data_alloc_m) {
         auto current_itr = value.begin();
         auto end_itr = value.end();
@@ -199,12 +289,12 @@ class unrolled_list {
 
 
     template<size_t kAnotherSize>
-    unrolled_list(unrolled_list<DataType, kAnotherSize, AllocatorType>&& value)
+    unrolled_list(unrolled_list<DataType, kAnotherSize, AllocatorType, FillPolicyType, ChunckExtensionType, ChunckAlignment>&& value)
         : unrolled_list(std::move(value), value.alloc_m) {  };
 
 
     template<size_t kAnotherSize>
-    unrolled_list(unrolled_list<DataType, ChunckSize, AllocatorType>&& value, const AllocatorType& alloc) noexcept
+    unrolled_list(unrolled_list<DataType, ChunckSize, AllocatorType, FillPolicyType, ChunckExtensionType, ChunckAlignment>&& value, const AllocatorType& alloc) noexcept
             : begin_chunck_ptr_m(value.begin_chunck_ptr_m), end_chunck_ptr_m(value.end_chunck_ptr_m), size_m(value.size_m),
             alloc_m(alloc), data_alloc_m(std::move(alloc_m)) {
         value.begin_chunck_ptr_m = value.end_chunck_ptr_m = nullptr;
@@ -212,16 +302,16 @@ class unrolled_list {
     };
 
 
-    unrolled_list(unrolled_list<DataType, ChunckSize, AllocatorType>&& value, const AllocatorType& alloc)
+    unrolled_list(unrolled_list<DataType, ChunckSize, AllocatorType, FillPolicyType, ChunckExtensionType, ChunckAlignment>&& value, const AllocatorType& alloc)
         noexcept(std::is_nothrow_copy_constructible_v<allocator_type>)
             : begin_chunck_ptr_m(value.begin_chunck_ptr_m), end_chunck_ptr_m(value.end_chunck_ptr_m), size_m(value.size_m),
-            alloc_m(alloc_m), data_alloc_m(std::move(alloc_m)) {
+            alloc_m(alloc), data_alloc_m(alloc_m) {
         value.begin_chunck_ptr_m = value.end_chunck_ptr_m = nullptr;
         value.size_m = 0;
     };
 
 
-    unrolled_list(unrolled_list<DataType, ChunckSize, AllocatorType>&& value)
+    unrolled_list(unrolled_list<DataType, ChunckSize, AllocatorType, FillPolicyType, ChunckExtensionType, ChunckAlignment>&& value)
         noexcept(std::is_nothrow_copy_constructible_v<allocator_type>)
             : unrolled_list(std::move(value), std::move(value.alloc_m)) {  };
 
@@ -241,33 +331,25 @@ class unrolled_list {
             }
         } catch(...) {
             clear();
+            FreeSpareChuncks();
             throw;
         }
     };
 
 
-    virtual ~unrolled_list() noexcept(noexcept(clear())) { clear(); };
+    virtual ~unrolled_list() noexcept(noexcept(clear())) {
+        clear();
+        FreeSpareChuncks();
+    };
 
 
     unrolled_list& operator=(const unrolled_list& value) {
-        if (*this == value) {
+        if (this == &value) {
             return *this;
         }
 
-        unrolled_list current_copy;
-
-        auto current_itr = value.begin();
-        auto end_itr = value.end();
-
-        while (current_itr != end_itr) {
-            current_copy.emplace_back(*current_itr);
-        }
-
-        clear();
-
-        current_copy.alloc_m = value.alloc_m;
-        current_copy.data_alloc_m = value.data_alloc_m;
-        *this = std::move(current_copy);
+        unrolled_list current_copy(value);
+        swap(current_copy);
 
         return *this;
     };
@@ -280,32 +362,33 @@ class unrolled_list {
 
         clear();
 
-        std::swap(*this, value);
+        swap(value);
 
         return *this;
     };
 
-  private:
-
-    template<std::same_as<allocator_type> SameAllocatorType>
-    unrolled_list(node_t* data, SameAllocatorType alloc)
-      : alloc_m(std::forward<SameAllocatorType>(alloc)),
-        begin_chunck_ptr_m(data), end_chunck_ptr_m(data), size_m(data->size_m) {  };
-
   public:
 
     template<typename... ArgsTs>
     requires std::constructible_from<value_type, ArgsTs...>
     void emplace_back(ArgsTs&&... args) {
+        node_ptr_t added_chunck = nullptr;
+
         if (empty()) {
-            begin_chunck_ptr_m = end_chunck_ptr_m = chunck_traits::CreateChunck(alloc_m);
+            added_chunck = begin_chunck_ptr_m = end_chunck_ptr_m = AcquireChunck();
+        } else if (end_chunck_ptr_m->size_m == end_chunck_ptr_m->size_value) {
+            added_chunck = end_chunck_ptr_m = chunck_traits::IncludeChunckBack(end_chunck_ptr_m, AcquireChunck());
         }
 
-        if (end_chunck_ptr_m->size_m == end_chunck_ptr_m->size_value) {
-            end_chunck_ptr_m = chunck_traits::AddChunckBack(end_chunck_ptr_m, alloc_m);
+        try {
+            data_allocator_trait_t::construct(data_alloc_m, end_chunck_ptr_m->data_m + end_chunck_ptr_m->size_m, std::forward<ArgsTs>(args)...);
+        } catch(...) {
+            if (added_chunck) {
+                DropAddedChunck(added_chunck);
+            }
+            throw;
         }
 
-        data_allocator_trait_t::construct(data_alloc_m, end_chunck_ptr_m->data_m + end_chunck_ptr_m->size_m, std::forward<ArgsTs>(args)...);
         ++(end_chunck_ptr_m->size_m);
         ++size_m;
     };
@@ -314,15 +397,23 @@ class unrolled_list {
     template<typename... ArgsTs>
     requires std::constructible_from<value_type, ArgsTs...>
     void emplace_front(ArgsTs&&... args) {
+        node_ptr_t added_chunck = nullptr;
+
         if (empty()) {
-            begin_chunck_ptr_m = end_chunck_ptr_m = chunck_traits::CreateChunck(alloc_m);
+            added_chunck = begin_chunck_ptr_m = end_chunck_ptr_m = AcquireChunck();
+        } else if (begin_chunck_ptr_m->size_m == begin_chunck_ptr_m->size_value) {
+            added_chunck = begin_chunck_ptr_m = chunck_traits::IncludeChunckFront(begin_chunck_ptr_m, AcquireChunck());
         }
 
-        if (begin_chunck_ptr_m->size_m == begin_chunck_ptr_m->size_value) {
-            begin_chunck_ptr_m = chunck_traits::AddChunckFront(begin_chunck_ptr_m, alloc_m);
+        try {
+            ChunckPlace(begin_chunck_ptr_m, 0, std::forward<ArgsTs>(args)...);
+        } catch(...) {
+            if (added_chunck) {
+                DropAddedChunck(added_chunck);
+            }
+            throw;
         }
 
-        ChunckPlace(begin_chunck_ptr_m, 0, std::forward<ArgsTs>(args)...);
         ++size_m;
     };
 
@@ -330,38 +421,42 @@ class unrolled_list {
     template<typename... ArgsTs>
     requires std::constructible_from<value_type, ArgsTs...>
     iterator emplace(const_iterator pos_itr, ArgsTs&&... args) {
-        node_t* emplace_node = static_cast<node_t*>(pos_itr.base());
+        node_ptr_t emplace_node = static_cast<node_ptr_t>(pos_itr.base());
         size_type position = pos_itr.base().get_chunck_offset();
 
-        iterator return_itr;
-
-        if (emplace_node->size_m == emplace_node->size_value) {
-            node_t pos_copy = *emplace_node;
-
-            emplace_node = SplitNode(&pos_copy, emplace_node == end_chunck_ptr_m);
+        if (!emplace_node) {
+            emplace_back(std::forward<ArgsTs>(args)...);
+            return begin();
+        }
 
-            if (position < pos_copy.size_value - (pos_copy.size_value / 2)) {
-                ChunckPlace(&pos_copy, position, std::forward<ArgsTs>(args)...);
-                return_itr = {static_cast<node_t*>(pos_itr.base()), position};
+        iterator return_itr;
+        node_ptr_t prev_node = emplace_node->prev_chunck_ptr_m;
+
+        if (position == 0 && prev_node && prev_node->size_m != prev_node->size_value) {
+            ChunckPlace(prev_node, prev_node->size_m, std::forward<ArgsTs>(args)...);
+            return_itr = {prev_node, prev_node->size_m - 1};
+        } else if (emplace_node->size_m == emplace_node->size_value) {
+            if constexpr (!is_nothrow_relocatable_v<value_type>) {
+                /* the tail is copied into a fresh chunck, the originals are dropped only once it is built */
+                return_itr = InsertChain(pos_itr, [&](ChunckChain& chain) {
+                    chain.EmplaceBack(std::forward<ArgsTs>(args)...);
+                });
+                insert_tracker_m.Remember(static_cast<node_ptr_t>(return_itr), return_itr.get_chunck_offset());
+                return return_itr;
             } else {
-                position -= pos_copy.size_value - (pos_copy.size_value / 2);
-
-                ChunckPlace(emplace_node, position, std::forward<ArgsTs>(args)...);
-                return_itr = {emplace_node, position};
-            }
-
-            std::swap(*static_cast<node_t*>(pos_itr.base()), pos_copy);
-            chunck_traits::IncludeChunckBack(static_cast<node_t*>(pos_itr.base()), emplace_node);
+                size_t split_keep = fill_traits::split_keep;
+                if (insert_tracker_m.IsSequential(emplace_node, position)) {
+                    split_keep = std::clamp<size_t>(position, 1, ChunckSize - 1);
+                }
 
-            
-            if (static_cast<node_t*>(pos_itr.base()) == end_chunck_ptr_m) {
-                end_chunck_ptr_m = end_chunck_ptr_m->next_chunck_ptr_m;
+                return_itr = SplitPlace(emplace_node, position, split_keep, std::forward<ArgsTs>(args)...);
             }
         } else {
             ChunckPlace(emplace_node, position, std::forward<ArgsTs>(args)...);
-            return_itr = pos_itr;
+            return_itr = pos_itr.base();
         }
 
+        insert_tracker_m.Remember(static_cast<node_ptr_t>(return_itr), return_itr.get_chunck_offset());
         ++size_m;
         return return_itr;
     };
@@ -386,74 +481,46 @@ class unrolled_list {
 
 
     iterator insert(const_iterator pos_itr, size_type count, const value_type& value) {
-        unrolled_list values_cont(value, count);
-        return insert(values_cont.begin(), values_cont.end());
+        return InsertChain(pos_itr, [&](ChunckChain& chain) {
+            chain.Reserve(count);
+            for (size_type ind = 0; ind != count; ++ind) {
+                chain.EmplaceBack(value);
+            }
+        });
     }
 
 
+    /*
+        Builds the new elements in fresh fully packed chuncks first, so nothing in the list changes
+        until all of them are constructed, then splits the target chunck once and splices the chain in.
+    */
     template<std::input_iterator InItrType>
     iterator insert(const_iterator pos_itr, InItrType beg_itr, InItrType end_itr) {
-        node_t* pos_node{pos_itr.base()};
-        size_t offset = pos_itr.base().get_chunck_offset();
-
-        auto addition_node_deleter = [&alloc = this->alloc_m](node_t* node) mutable {  
-            chunck_traits::RemoveChunck(node, alloc);
-        };
-
-        std::unique_ptr<node_t, decltype(addition_node_deleter)> addition_pos_itr_node(
-            chunck_traits::CreateChunck(alloc_m), addition_node_deleter);
-
-        allocator_trait_t::construct(alloc_m, addition_pos_itr_node.get(), *pos_node);
-
-        iterator addition_pos_itr{addition_pos_itr_node.get(), offset};
-        addition_pos_itr_node->next_chunck_ptr_m = addition_pos_itr_node->prev_chunck_ptr_m = nullptr;
-
-        unrolled_list addition_list{addition_pos_itr_node.get(), alloc_m};
-
-        size_t addition_size = 0;
-        std::for_each(beg_itr, end_itr, [&](auto&& value) {
-            addition_pos_itr = ++addition_list.emplace(addition_pos_itr, std::forward<decltype(value)>(value));
-            ++addition_size;
-        });
-
-        if (addition_list.begin_chunck_ptr_m->next_chunck_ptr_m != nullptr) {
-            chunck_traits::IncludeChunckBack(pos_node, 
-                addition_list.begin_chunck_ptr_m->next_chunck_ptr_m, addition_list.end_chunck_ptr_m);
-
-            addition_list.begin_chunck_ptr_m->prev_chunck_ptr_m = pos_node->prev_chunck_ptr_m;
-            addition_list.begin_chunck_ptr_m->next_chunck_ptr_m = pos_node->next_chunck_ptr_m;
-
-            if (pos_node == end_chunck_ptr_m) {
-                end_chunck_ptr_m = addition_list.end_chunck_ptr_m;
+        return InsertChain(pos_itr, [&](ChunckChain& chain) {
+            if constexpr (std::forward_iterator<InItrType>) {
+                chain.Reserve(std::distance(beg_itr, end_itr));
             }
-
-            std::swap(*pos_node, *(addition_list.begin_chunck_ptr_m));
-        } else {
-            std::swap(*pos_node, *(addition_list.begin_chunck_ptr_m));
-        }
-
-        size_m += addition_size;
-
-        addition_list.begin_chunck_ptr_m = addition_list.end_chunck_ptr_m = nullptr;
-        addition_list.size_m = 0;
-
-        return pos_itr.base();
+            for (; beg_itr != end_itr; ++beg_itr) {
+                chain.EmplaceBack(*beg_itr);
+            }
+        });
     }
 
 
   public:
 
     void pop_back() noexcept(std::is_nothrow_destructible_v<value_type>) {
-        pointer destroyed_ptr = end_chunck_ptr_m->data_m + end_chunck_ptr_m->size_m;
+        pointer destroyed_ptr = end_chunck_ptr_m->data_m + end_chunck_ptr_m->size_m - 1;
 
         if (end_chunck_ptr_m->size_m == 1) {
             if (end_chunck_ptr_m == begin_chunck_ptr_m) {
-                chunck_traits::RemoveChunck(end_chunck_ptr_m, alloc_m);
+                data_allocator_trait_t::destroy(data_alloc_m, destroyed_ptr);
+                ReleaseChunck(end_chunck_ptr_m);
                 end_chunck_ptr_m = nullptr;
             } else {
                 end_chunck_ptr_m = end_chunck_ptr_m->prev_chunck_ptr_m;
                 data_allocator_trait_t::destroy(data_alloc_m, destroyed_ptr);
-                chunck_traits::RemoveChunckBack(end_chunck_ptr_m, alloc_m);
+                ReleaseChunck(chunck_traits::ExcludeChunckBack(end_chunck_ptr_m));
             }
 
         } else {
@@ -473,18 +540,18 @@ class unrolled_list {
 
         if (begin_chunck_ptr_m->size_m == 1) {
             if (begin_chunck_ptr_m == end_chunck_ptr_m) {
-                chunck_traits::RemoveChunck(begin_chunck_ptr_m, alloc_m);
+                data_allocator_trait_t::destroy(data_alloc_m, destroyed_ptr);
+                ReleaseChunck(begin_chunck_ptr_m);
                 begin_chunck_ptr_m = nullptr;
             } else {
                 begin_chunck_ptr_m = begin_chunck_ptr_m->next_chunck_ptr_m;
                 data_allocator_trait_t::destroy(data_alloc_m, destroyed_ptr);
-                chunck_traits::RemoveChunckFront(begin_chunck_ptr_m, alloc_m);
+                ReleaseChunck(chunck_traits::ExcludeChunckFront(begin_chunck_ptr_m));
             }
         } else {
-            data_allocator_trait_t::destroy(data_alloc_m, begin_chunck_ptr_m->data_m + 0);
+            data_allocator_trait_t::destroy(data_alloc_m, destroyed_ptr);
             shift_left(begin_chunck_ptr_m->data_m + 1, begin_chunck_ptr_m->data_m + begin_chunck_ptr_m->size_m, 1);
             --(begin_chunck_ptr_m->size_m);
-            data_allocator_trait_t::destroy(data_alloc_m, destroyed_ptr);
         }
 
 
@@ -494,111 +561,336 @@ class unrolled_list {
         --size_m;
     };
 
-    iterator erase(const_iterator pos_itr) {
-        node_t* current_node = static_cast<node_t*>(pos_itr.base());
-        size_t current_offset = pos_itr.base().get_chunck_offset();
+    iterator erase(const_iterator pos_itr)
+      noexcept(is_nothrow_relocatable_v<value_type>) {
+        return erase(pos_itr, std::next(pos_itr));
+    };
 
-        if (size_m == 1) {
-            data_allocator_trait_t::destroy(data_alloc_m, current_node->data_m + current_offset);
-            chunck_traits::RemoveChunck(begin_chunck_ptr_m, alloc_m);
-            begin_chunck_ptr_m = end_chunck_ptr_m = nullptr;
-            return end();
+    /*
+        Trims the boundary chuncks, frees the whole chuncks in between in one pass
+        and rebalances only the two chuncks meeting at the seam: O(M / ChunckSize + ChunckSize).
+
+        Nothing is allocated. When an element may throw on a move and does, the list stays consistent:
+        the erased elements are gone and the ones of that chunck not shifted yet are dropped.
+    */
+    iterator erase(const_iterator beg_pos_itr, const_iterator end_pos_itr)
+      noexcept(is_nothrow_relocatable_v<value_type>) {
+        if (beg_pos_itr == end_pos_itr) {
+            return end_pos_itr.base();
         }
 
-        auto addition_node_deleter = [&alloc = this->alloc_m](node_t* node) mutable {  
-            chunck_traits::RemoveChunck(node, alloc);
-        };
+        node_ptr_t first_chunck = static_cast<node_ptr_t>(beg_pos_itr.base());
+        node_ptr_t last_chunck = static_cast<node_ptr_t>(end_pos_itr.base());
+        size_t first_offset = beg_pos_itr.base().get_chunck_offset();
+        size_t last_offset = end_pos_itr.base().get_chunck_offset();
+
+        if (first_chunck == last_chunck) {
+            size_t count = last_offset - first_offset;
 
-        std::unique_ptr<node_t, decltype(addition_node_deleter)> copy_lifetime_manager(nullptr, addition_node_deleter);
-        if constexpr (std::is_nothrow_move_constructible_v<value_type>) {
-            copy_lifetime_manager.reset(chunck_traits::CreateChunck(alloc_m));
-            current_node = copy_lifetime_manager.get();
-            allocator_trait_t::construct(alloc_m, current_node, *static_cast<node_t*>(pos_itr.base()));
+            DestroyElements(first_chunck->data_m + first_offset, first_chunck->data_m + last_offset);
+            size_m -= count;
+            CloseChunckGap(first_chunck, last_offset, count);
+
+            node_ptr_t result_chunck = first_chunck;
+            size_t result_offset = first_offset;
+
+            if (!first_chunck->size_m) {
+                node_ptr_t left_chunck = first_chunck->prev_chunck_ptr_m;
+                node_ptr_t right_chunck = first_chunck->next_chunck_ptr_m;
+                UnlinkChunck(first_chunck);
+
+                result_chunck = right_chunck;
+                result_offset = 0;
+                if (left_chunck && right_chunck) {
+                    RebalanceSeam(left_chunck, right_chunck, result_chunck, result_offset);
+                }
+            } else if (first_chunck->next_chunck_ptr_m) {
+                RebalanceSeam(first_chunck, first_chunck->next_chunck_ptr_m, result_chunck, result_offset);
+            } else if (first_chunck->prev_chunck_ptr_m) {
+                RebalanceSeam(first_chunck->prev_chunck_ptr_m, first_chunck, result_chunck, result_offset);
+            }
+
+            return MakeCanonicalIterator(result_chunck, result_offset);
         }
 
-        data_allocator_trait_t::destroy(data_alloc_m, current_node->data_m + current_offset);
-        shift_left(current_node->data_m + current_offset + 1,
-            current_node->data_m + current_node->size_m, 1);
-        --(current_node->size_m);
+        size_t count = first_chunck->size_m - first_offset + last_offset;
+
+        DestroyElements(first_chunck->data_m + first_offset, first_chunck->data_m + first_chunck->size_m);
+        first_chunck->size_m = first_offset;
+
+        if (first_chunck->next_chunck_ptr_m != last_chunck) {
+            node_ptr_t interior_begin = first_chunck->next_chunck_ptr_m;
+            node_ptr_t interior_end = last_chunck->prev_chunck_ptr_m;
 
-        size_t half_size = (current_node->size_value % 2) + (current_node->size_value / 2);
-        if (current_node->size_m < half_size) {
-            if (current_node->next_chunck_ptr_m && current_node->next_chunck_ptr_m->size_m > half_size) {
-                node_t* credit_node = nullptr;
-                credit_node = current_node->next_chunck_ptr_m;
+            for (node_ptr_t current = interior_begin; current != last_chunck; current = current->next_chunck_ptr_m) {
+                DestroyElements(current->data_m, current->data_m + current->size_m);
+                count += current->size_m;
+            }
+
+            first_chunck->next_chunck_ptr_m = last_chunck;
+            last_chunck->prev_chunck_ptr_m = first_chunck;
+            interior_end->next_chunck_ptr_m = nullptr;
+            ReleaseChunckChain(interior_begin);
+        }
 
-                data_allocator_trait_t::construct(data_alloc_m, current_node->data_m + current_node->size_m,
-                    std::move(*(credit_node->data_m + 0)));
+        DestroyElements(last_chunck->data_m, last_chunck->data_m + last_offset);
+        size_m -= count;
 
-                data_allocator_trait_t::destroy(data_alloc_m, credit_node->data_m + 0);
-                current_offset = 0;
-                shift_left(credit_node->data_m + 1,
-                    credit_node->data_m + credit_node->size_m, 1);
+        if (!first_chunck->size_m) {
+            node_ptr_t left_chunck = first_chunck->prev_chunck_ptr_m;
+            UnlinkChunck(first_chunck);
+            first_chunck = left_chunck;
+        }
 
-                ++(current_node->size_m);
-                --(credit_node->size_m);
-            } else if (current_node->prev_chunck_ptr_m && current_node->prev_chunck_ptr_m->size_m > half_size) {
-                node_t* credit_node = nullptr;
-                credit_node = current_node->prev_chunck_ptr_m;
+        if (last_offset) {
+            CloseChunckGap(last_chunck, last_offset, last_offset);
+        }
 
-                data_allocator_trait_t::construct(data_alloc_m, current_node->data_m + current_node->size_m,
-                    std::move(*(credit_node->data_m + credit_node->size_m - 1)));
+        node_ptr_t result_chunck = last_chunck;
+        size_t result_offset = 0;
 
-                data_allocator_trait_t::destroy(data_alloc_m, credit_node->data_m + credit_node->size_m - 1);
+        if (!last_chunck->size_m) {
+            node_ptr_t right_chunck = last_chunck->next_chunck_ptr_m;
+            UnlinkChunck(last_chunck);
+            last_chunck = result_chunck = right_chunck;
+        }
 
-                ++(current_node->size_m);
-                --(credit_node->size_m);
-            } else {
-                if (current_node->next_chunck_ptr_m && current_node->next_chunck_ptr_m->size_m <= half_size) {
-                    current_node = MergeNode(current_node->next_chunck_ptr_m, current_node);
-                    chunck_traits::RemoveChunckBack(current_node, alloc_m);
-                } else if (current_node->prev_chunck_ptr_m && current_node->prev_chunck_ptr_m->size_m <= half_size) {
-                    current_node = MergeNode(current_node->prev_chunck_ptr_m, current_node);
-                    chunck_traits::RemoveChunckFront(current_node, alloc_m);
+        if (first_chunck && last_chunck) {
+            RebalanceSeam(first_chunck, last_chunck, result_chunck, result_offset);
+        }
+
+        return MakeCanonicalIterator(result_chunck, result_offset);
+    };
+
+
+    /*
+        Moves all the elements of other in front of pos_itr by relinking its chunck chain:
+        O(ChunckSize), only the chunck at pos_itr may be split and only the seams are rebalanced.
+        With allocators which are not equal the elements are moved one by one.
+    */
+    void splice(const_iterator pos_itr, unrolled_list& other) {
+        if (&other == this || other.empty()) {
+            return;
+        }
+
+        if (!IsSameStorage(other)) {
+            InsertChain(pos_itr, [&](ChunckChain& chain) {
+                chain.Reserve(other.size_m);
+                for (node_ptr_t current = other.begin_chunck_ptr_m; current; current = current->next_chunck_ptr_m) {
+                    for (pointer element = current->data_m; element != current->data_m + current->size_m; ++element) {
+                        chain.EmplaceBack(std::move(*element));
+                    }
+                }
+            });
+            other.clear();
+            return;
+        }
+
+        node_ptr_t pos_chunck = static_cast<node_ptr_t>(pos_itr.base());
+        size_t pos_offset = pos_itr.base().get_chunck_offset();
+
+        if (pos_chunck && pos_offset != 0 && pos_offset != pos_chunck->size_m) {
+            SplitChunck(pos_chunck, pos_offset);
+        }
+
+        node_ptr_t chain_begin = other.begin_chunck_ptr_m;
+        node_ptr_t chain_end = other.end_chunck_ptr_m;
+        size_m += other.size_m;
+
+        other.begin_chunck_ptr_m = other.end_chunck_ptr_m = nullptr;
+        other.size_m = 0;
+
+        LinkChain(pos_chunck, pos_offset, chain_begin, chain_end);
+    };
+
+
+    /*
+        Moves [first, last) of other in front of pos_itr: O(ChunckSize + chuncks of other from first on).
+        other has to be a different list.
+    */
+    void splice(const_iterator pos_itr, unrolled_list& other, const_iterator first, const_iterator last) {
+        if (first == last) {
+            return;
+        }
+
+        if (!IsSameStorage(other)) {
+            InsertChain(pos_itr, [&](ChunckChain& chain) {
+                for (iterator current = first.base(); current != last.base(); ++current) {
+                    chain.EmplaceBack(std::move(*static_cast<pointer>(current)));
                 }
-                copy_lifetime_manager.release();
-                copy_lifetime_manager.reset(current_node);
+            });
+            other.erase(first, last);
+            return;
+        }
+
+        node_ptr_t pos_chunck = static_cast<node_ptr_t>(pos_itr.base());
+        size_t pos_offset = pos_itr.base().get_chunck_offset();
+
+        if (pos_chunck && pos_offset != 0 && pos_offset != pos_chunck->size_m) {
+            SplitChunck(pos_chunck, pos_offset);
+        }
+
+        /* first has to survive the rebalance after the cut at last */
+        node_ptr_t first_chunck = static_cast<node_ptr_t>(first.base());
+        size_t first_offset = first.base().get_chunck_offset();
+
+        auto [suffix_begin, suffix_end, suffix_size] = other.DetachSuffix(last, first_chunck, first_offset);
+        auto reattach_suffix = [&, suffix_begin = suffix_begin, suffix_end = suffix_end, suffix_size = suffix_size] {
+            if (suffix_begin) {
+                other.size_m += suffix_size;
+                other.LinkChain(other.end_chunck_ptr_m, other.end_chunck_ptr_m ? other.end_chunck_ptr_m->size_m : 0,
+                    suffix_begin, suffix_end);
             }
+        };
+
+        std::tuple<node_ptr_t, node_ptr_t, size_type> middle;
+        try {
+            node_ptr_t tracked_chunck = nullptr;
+            size_t tracked_offset = 0;
+            middle = other.DetachSuffix(iterator{first_chunck, first_offset}, tracked_chunck, tracked_offset);
+        } catch(...) {
+            reattach_suffix();
+            throw;
         }
+        reattach_suffix();
 
+        auto [chain_begin, chain_end, chain_size] = middle;
+        size_m += chain_size;
 
-        if constexpr (std::is_nothrow_move_constructible_v<value_type>) {
-            current_node = static_cast<node_t*>(pos_itr.base());
-            node_t* swap_ptr_tmp = copy_lifetime_manager.release();
+        LinkChain(pos_chunck, pos_offset, chain_begin, chain_end);
+    };
 
-            std::swap(current_node, swap_ptr_tmp);
-            copy_lifetime_manager.reset(swap_ptr_tmp);
 
-            if (current_node->next_chunck_ptr_m)
-                current_node->next_chunck_ptr_m->prev_chunck_ptr_m = current_node;
+    /*
+        Cuts the list at pos_itr and returns [pos_itr, end()) as a new list with the same allocator:
+        O(ChunckSize + chuncks moved).
+    */
+    unrolled_list split_at(const_iterator pos_itr) {
+        unrolled_list suffix(alloc_m);
+        suffix.data_alloc_m = data_alloc_m;
 
-            if (current_node->prev_chunck_ptr_m)
-                current_node->prev_chunck_ptr_m->next_chunck_ptr_m = current_node;
+        node_ptr_t tracked_chunck = nullptr;
+        size_t tracked_offset = 0;
 
-            
+        auto [chain_begin, chain_end, chain_size] = DetachSuffix(pos_itr, tracked_chunck, tracked_offset);
+        if (!chain_begin) {
+            return suffix;
         }
 
-        if (static_cast<node_t*>(pos_itr.base()) == begin_chunck_ptr_m
-          && static_cast<node_t*>(pos_itr.base()) == end_chunck_ptr_m) {
-            begin_chunck_ptr_m = end_chunck_ptr_m = current_node;
-        } else if (static_cast<node_t*>(pos_itr.base()) == begin_chunck_ptr_m) {
-            begin_chunck_ptr_m = current_node;
-        } else if (static_cast<node_t*>(pos_itr.base()) == end_chunck_ptr_m) {
-            end_chunck_ptr_m = current_node;
+        suffix.begin_chunck_ptr_m = chain_begin;
+        suffix.end_chunck_ptr_m = chain_end;
+        suffix.size_m = chain_size;
+
+        if constexpr (is_nothrow_relocatable_v<value_type>) {
+            if (chain_begin->next_chunck_ptr_m) {
+                suffix.RebalanceSeam(chain_begin, chain_begin->next_chunck_ptr_m, tracked_chunck, tracked_offset);
+            }
         }
 
-        --size_m;
-        return {current_node, current_offset};
+        return suffix;
     };
 
-    iterator erase(const_iterator beg_pos_itr, const_iterator end_pos_itr) {
-        size_t count = std::distance(beg_pos_itr, end_pos_itr);
-        iterator current_itr = beg_pos_itr;
 
-        while (count--) {
-            current_itr = erase(current_itr);
+    /* Moves all the elements of other to the end of the list, see splice */
+    void append(unrolled_list&& other) {
+        splice(end(), other);
+    };
+
+
+    /*
+        Sorts every chunck in place, then merges the sorted stretches of the chunck chain pairwise,
+        pass after pass, bottom-up over the chain itself. Merging moves whole slices of chuncks and reuses
+        the drained chuncks for the output, so it needs only a few spare chuncks and no buffers. Types which are not nothrow relocatable are sorted
+        through a fresh copy instead and keep the list untouched on a throw.
+        If comp throws while merging, every element stays in the list; a throw from the sort of
+        a single chunck leaves that chunck like std::sort does. Invalidates all iterators.
+    */
+    void sort() {
+        sort(std::less<>{});
+    };
+
+
+    template<typename CompareType>
+    void sort(CompareType comp) {
+        SortChuncks(comp, false, SequentialSortTasks{});
+    };
+
+
+    void stable_sort() {
+        stable_sort(std::less<>{});
+    };
+
+
+    template<typename CompareType>
+    void stable_sort(CompareType comp) {
+        SortChuncks(comp, true, SequentialSortTasks{});
+    };
+
+
+    /*
+        Merges the sorted other into this sorted list, other becomes empty. Stable: equal elements
+        of this list go first. If comp throws, every element ends up in this list in an unspecified order.
+    */
+    void merge(unrolled_list& other) {
+        merge(other, std::less<>{});
+    };
+
+
+    template<typename CompareType>
+    void merge(unrolled_list& other, CompareType comp) {
+        if (&other == this || other.empty()) {
+            return;
+        }
+
+        if (!IsSameStorage(other)) {
+            unrolled_list moved(alloc_m);
+            moved.data_alloc_m = data_alloc_m;
+            moved.splice(moved.end(), other);
+            merge(moved, comp);
+            return;
+        }
+
+        if constexpr (!is_nothrow_relocatable_v<value_type>) {
+            ChunckChain chain(*this);
+            chain.Reserve(size_m + other.size_m);
+
+            iterator left_itr = begin();
+            iterator right_itr = other.begin();
+            while (left_itr != end() || right_itr != other.end()) {
+                if (left_itr == end() || (right_itr != other.end() && comp(*right_itr, *left_itr))) {
+                    chain.EmplaceBack(*right_itr++);
+                } else {
+                    chain.EmplaceBack(*left_itr++);
+                }
+            }
+
+            size_type merged_size = chain.Size();
+            clear();
+            other.clear();
+
+            std::tie(begin_chunck_ptr_m, end_chunck_ptr_m) = chain.Release();
+            size_m = merged_size;
+        } else {
+            SortRun merged;
+            SortRun left{begin_chunck_ptr_m, end_chunck_ptr_m};
+            SortRun right{other.begin_chunck_ptr_m, other.end_chunck_ptr_m};
+
+            size_m += other.size_m;
+            other.begin_chunck_ptr_m = other.end_chunck_ptr_m = nullptr;
+            other.size_m = 0;
+
+            NoSortLock lock;
+            try {
+                MergeRuns(merged, left, right, comp, lock);
+            } catch(...) {
+                begin_chunck_ptr_m = merged.begin_m;
+                end_chunck_ptr_m = merged.end_m;
+                throw;
+            }
+
+            begin_chunck_ptr_m = merged.begin_m;
+            end_chunck_ptr_m = merged.end_m;
         }
-        return current_itr;
     };
 
   public:
@@ -674,23 +966,120 @@ class unrolled_list {
     };
 
 
+    /*
+        Spans over the live elements of every chunck, in list order.
+        Use rbegin()/rend() of the range or std::views::reverse for the reverse order.
+    */
+    chunck_range chunks() noexcept {
+        return chunck_range{begin_chunck_ptr_m, end_chunck_ptr_m};
+    };
+
+
+    const_chunck_range chunks() const noexcept {
+        return const_chunck_range{begin_chunck_ptr_m, end_chunck_ptr_m};
+    };
+
+
   public:
-    void clear()
-        noexcept(noexcept(chunck_traits::RemoveChunck(static_cast<node_t*>(nullptr),
-            static_cast<node_t*>(nullptr), std::declval<allocator_type&>())) &&
-            std::is_nothrow_destructible_v<value_type>) {
-        auto current_itr = cbegin();    
-        auto end_itr = cend();
-        while (current_itr != end_itr) {
-            data_allocator_trait_t::destroy(data_alloc_m, static_cast<const_pointer>(current_itr));
-            ++current_itr;
+    void clear() noexcept(std::is_nothrow_destructible_v<value_type>) {
+        for (node_ptr_t current = begin_chunck_ptr_m; current; current = current->next_chunck_ptr_m) {
+            DestroyElements(current->data_m, current->data_m + current->size_m);
         }
 
-        if (!empty())
-            chunck_traits::RemoveChunck(begin_chunck_ptr_m, end_chunck_ptr_m, alloc_m);
+        ReleaseChunckChain(begin_chunck_ptr_m);
+        begin_chunck_ptr_m = end_chunck_ptr_m = nullptr;
+        size_m = 0;
+        insert_tracker_m.Reset();
     }
 
 
+    /*
+        Stocks the spare chunck cache, so that push_back/push_front of count - size() more elements
+        take their chuncks from it and never reach the allocator.
+    */
+    void reserve(size_type count) {
+        if (count <= size_m) {
+            return;
+        }
+
+        /* one more chunck for the partially filled one at the other end */
+        size_type needed_chuncks = (count - size_m + ChunckSize - 1) / ChunckSize + 1;
+        spare_limit_m = std::max(spare_limit_m, needed_chuncks);
+
+        while (spare_count_m < needed_chuncks) {
+            ReleaseChunck(chunck_traits::CreateChunck(alloc_m));
+        }
+    };
+
+
+    /*
+        Repacks the elements into completely filled chuncks in one pass and frees the emptied ones,
+        every element is moved at most twice. Invalidates all iterators.
+
+        Elements which may throw on a move are copied into a fresh chain instead, the list is left as it was
+        if a copy throws. The copy needs memory for the whole list once more.
+    */
+    void compact() noexcept(is_nothrow_relocatable_v<value_type>) {
+        if constexpr (!is_nothrow_relocatable_v<value_type>) {
+            ChunckChain chain(*this);
+            chain.Reserve(size_m);
+            for (node_ptr_t current = begin_chunck_ptr_m; current; current = current->next_chunck_ptr_m) {
+                for (pointer element = current->data_m; element != current->data_m + current->size_m; ++element) {
+                    chain.EmplaceBack(std::move_if_noexcept(*element));
+                }
+            }
+
+            size_type compacted_size = chain.Size();
+            clear();
+
+            std::tie(begin_chunck_ptr_m, end_chunck_ptr_m) = chain.Release();
+            size_m = compacted_size;
+            return;
+        }
+
+        node_ptr_t write_chunck = begin_chunck_ptr_m;
+
+        while (write_chunck && write_chunck->next_chunck_ptr_m) {
+            node_ptr_t read_chunck = write_chunck->next_chunck_ptr_m;
+            size_t moved = std::min(ChunckSize - write_chunck->size_m, read_chunck->size_m);
+
+            if (moved) {
+                MoveElements(read_chunck->data_m, read_chunck->data_m + moved, write_chunck->data_m + write_chunck->size_m);
+                shift_left(read_chunck->data_m + moved, read_chunck->data_m + read_chunck->size_m, moved);
+                write_chunck->size_m += moved;
+                read_chunck->size_m -= moved;
+            }
+
+            if (read_chunck->size_m == 0) {
+                UnlinkChunck(read_chunck);
+            } else {
+                write_chunck = read_chunck;
+            }
+        }
+    };
+
+
+    void shrink_to_fit() noexcept(is_nothrow_relocatable_v<value_type>) {
+        compact();
+        FreeSpareChuncks();
+        spare_limit_m = kDefaultSpareChuncks;
+    };
+
+
+    /* Part of the allocated element slots which is in use, 1 for an empty list. Walks the chain, O(N / K) */
+    double occupancy() const noexcept {
+        if (empty()) {
+            return 1.0;
+        }
+
+        size_type chunck_count = 0;
+        for (node_ptr_t current = begin_chunck_ptr_m; current; current = current->next_chunck_ptr_m) {
+            ++chunck_count;
+        }
+        return static_cast<double>(size_m) / static_cast<double>(chunck_count * ChunckSize);
+    };
+
+
   public:
     size_type max_size() const noexcept { return alloc_m.max_size(); };
     size_type size() const noexcept { return size_m; };
@@ -698,12 +1087,32 @@ class unrolled_list {
     allocator_type get_allocator() const { return alloc_m; };
 
   public:
-    reference front() { return *begin(); };  
-    reference back() { return *(--end()); };  
+    reference front() { return *static_cast<pointer>(begin()); };
+    reference back() { return *static_cast<pointer>(--end()); };
 
     const_reference front() const { return *begin(); };  
     const_reference back() const { return *(--end()); };  
 
+    reference operator[](size_type index) noexcept { return *static_cast<pointer>(nth(index)); };
+    const_reference operator[](size_type index) const noexcept { return *nth(index); };
+
+    reference at(size_type index) {
+        if (index >= size_m) {
+            throw std::out_of_range{"unrolled_list::at: index is out of range"};
+        }
+        return (*this)[index];
+    };
+
+    const_reference at(size_type index) const {
+        if (index >= size_m) {
+            throw std::out_of_range{"unrolled_list::at: index is out of range"};
+        }
+        return (*this)[index];
+    };
+
+    iterator nth(size_type index) noexcept { return LocateNth(index); };
+    const_iterator nth(size_type index) const noexcept { return LocateNth(index); };
+
 
   public:
     bool operator==(const unrolled_list& value) const noexcept {
@@ -732,145 +1141,1057 @@ class unrolled_list {
     };
 
 
-  private:
-    node_t* SplitNode(node_t* current_node, bool is_end)
-      noexcept(std::is_nothrow_move_constructible_v<value_type> && std::is_nothrow_destructible_v<value_type>) {
-        node_t* another_node = chunck_traits::CreateChunck(alloc_m);
-        
-        node_t* splited_node_ptr = current_node;
+  protected:
+    /* Swaps every member of the list, the derived lists swap their own members on top of it */
+    void swap(unrolled_list& value) noexcept {
+        std::swap(begin_chunck_ptr_m, value.begin_chunck_ptr_m);
+        std::swap(end_chunck_ptr_m, value.end_chunck_ptr_m);
+        std::swap(alloc_m, value.alloc_m);
+        std::swap(data_alloc_m, value.data_alloc_m);
+        std::swap(size_m, value.size_m);
+        std::swap(spare_chunck_ptr_m, value.spare_chunck_ptr_m);
+        std::swap(spare_count_m, value.spare_count_m);
+        std::swap(spare_limit_m, value.spare_limit_m);
+        std::swap(insert_tracker_m, value.insert_tracker_m);
+    };
 
-        auto addition_node_deleter = [&alloc = this->alloc_m](node_t* node) mutable {  
-            chunck_traits::RemoveChunck(node, alloc);
-        };
-        std::unique_ptr<node_t, decltype(addition_node_deleter)> sprited_node_smart_ptr(nullptr, addition_node_deleter);
-        if constexpr(!std::is_nothrow_move_constructible_v<value_type>) {
-    
-            sprited_node_smart_ptr.reset(chunck_traits::CreateChunck(alloc_m));
 
-            splited_node_ptr = sprited_node_smart_ptr.get();
-            allocator_trait_t::construct(alloc_m, splited_node_ptr, *current_node);
+  private:
+    iterator LocateNth(size_type index) const noexcept {
+        if (index <= size_m / 2) {
+            return iterator{begin_chunck_ptr_m, 0}.advance(index);
         }
 
-        int balance = is_end ? 0 : splited_node_ptr->size_m % 2;
-        for (size_t offset = 0; offset != balance + splited_node_ptr->size_m / 2; ++offset) {
-            data_allocator_trait_t::construct(data_alloc_m, another_node->data_m + (balance + splited_node_ptr->size_m / 2) - offset - 1,
-                std::move(*(splited_node_ptr->data_m + splited_node_ptr->size_m - offset - 1)));
+        if (!end_chunck_ptr_m) {
+            return iterator{nullptr, 0};
         }
 
-        for (size_t offset = 0; offset != balance + splited_node_ptr->size_m / 2; ++offset) {
-            data_allocator_trait_t::destroy(data_alloc_m, splited_node_ptr->data_m + splited_node_ptr->size_m - offset - 1);
-        }
+        return iterator{end_chunck_ptr_m, end_chunck_ptr_m->size_m}
+            .advance(-static_cast<difference_type>(size_m - index));
+    };
 
-        if constexpr(!std::is_nothrow_move_constructible_v<value_type>) {
-            node_t* swap_ptr_tmp = sprited_node_smart_ptr.release();
-            std::swap(splited_node_ptr, swap_ptr_tmp);
-            sprited_node_smart_ptr.reset(swap_ptr_tmp);
 
+    /*
+        Places an element into the full current_chunck: the elements from split_keep on are moved
+        into a new chunck linked right after it. On a throw the moved elements are returned back.
+    */
+    template<typename... ArgsTs>
+    requires is_nothrow_relocatable_v<value_type>
+    iterator SplitPlace(node_ptr_t current_chunck, size_t position, size_t split_keep, ArgsTs&&... args) {
+        node_ptr_t added_chunck = AcquireChunck();
+
+        MoveElements(current_chunck->data_m + split_keep, current_chunck->data_m + current_chunck->size_m, added_chunck->data_m);
+        added_chunck->size_m = current_chunck->size_m - split_keep;
+        current_chunck->size_m = split_keep;
+
+        node_ptr_t place_chunck = current_chunck;
+        if (position > split_keep) {
+            place_chunck = added_chunck;
+            position -= split_keep;
+        }
+
+        try {
+            ChunckPlace(place_chunck, position, std::forward<ArgsTs>(args)...);
+        } catch(...) {
+            MoveElements(added_chunck->data_m, added_chunck->data_m + added_chunck->size_m,
+                current_chunck->data_m + current_chunck->size_m);
+            current_chunck->size_m += added_chunck->size_m;
+            ReleaseChunck(added_chunck);
+            throw;
         }
 
-        another_node->size_m = balance + current_node->size_m / 2;
-        current_node->size_m -= another_node->size_m;
+        chunck_traits::IncludeChunckBack(current_chunck, added_chunck);
+        if (current_chunck == end_chunck_ptr_m) {
+            end_chunck_ptr_m = added_chunck;
+        }
 
-        return another_node;
+        return {place_chunck, position};
     };
 
 
-    node_t* MergeNode(node_t* from_node, node_t* to_node)
-      noexcept(std::is_nothrow_move_constructible_v<value_type> && std::is_nothrow_destructible_v<value_type>) {       
-        node_t* beg_chunck = begin_chunck_ptr_m;
-        node_t* end_chunck = end_chunck_ptr_m;
+    /* Detached chain of fresh chuncks filled to the brim, frees itself with the elements unless released */
+    class ChunckChain {
+      public:
+        explicit ChunckChain(unrolled_list& owner) noexcept : owner_m(owner) {  };
 
-        node_t* from_node_ptr = from_node;
-        node_t* to_node_ptr = to_node;
+        ChunckChain(const ChunckChain&) = delete;
+        ChunckChain& operator=(const ChunckChain&) = delete;
 
-        auto addition_node_deleter = [&alloc = this->alloc_m](node_t* node) mutable {  
-            chunck_traits::RemoveChunck(node, alloc);
-        };
+        ~ChunckChain() {
+            if (!begin_chunck_ptr_m) {
+                return;
+            }
 
-        std::unique_ptr<node_t, decltype(addition_node_deleter)> copy_livetime_controlled[2] = {{nullptr, addition_node_deleter}, {nullptr, addition_node_deleter}};
+            for (node_ptr_t current = begin_chunck_ptr_m; current; current = current->next_chunck_ptr_m) {
+                owner_m.DestroyElements(current->data_m, current->data_m + current->size_m);
+            }
+            owner_m.ReleaseChunckChain(begin_chunck_ptr_m);
+        };
 
-        if constexpr(std::is_nothrow_move_constructible_v<value_type>) {
-            copy_livetime_controlled[0].reset(chunck_traits::CreateChunck(alloc_m));
-            copy_livetime_controlled[1].reset(chunck_traits::CreateChunck(alloc_m));
+      public:
+        /* Allocates up front the chuncks for count more elements */
+        void Reserve(size_type count) {
+            size_type free_slots = 0;
+            for (node_ptr_t current = fill_chunck_ptr_m ? fill_chunck_ptr_m : begin_chunck_ptr_m; current;
+                current = current->next_chunck_ptr_m) {
+                free_slots += ChunckSize - current->size_m;
+            }
 
-            from_node_ptr = copy_livetime_controlled[0].get();
-            to_node_ptr = copy_livetime_controlled[1].get();
+            for (; free_slots < count; free_slots += ChunckSize) {
+                AddChunck();
+            }
+        };
 
-            allocator_trait_t::construct(alloc_m, from_node_ptr, *from_node);
-            allocator_trait_t::construct(alloc_m, to_node_ptr, *to_node);
-        }
 
-        for (size_t offset = 0; offset != from_node_ptr->size_m; ++offset) {
-            data_allocator_trait_t::construct(data_alloc_m, to_node_ptr->data_m + to_node_ptr->size_m + offset,
-                std::move(*(from_node_ptr->data_m + offset)));
-        }
+        template<typename... ArgsTs>
+        void EmplaceBack(ArgsTs&&... args) {
+            if (!fill_chunck_ptr_m || fill_chunck_ptr_m->size_m == ChunckSize) {
+                if (!(fill_chunck_ptr_m ? fill_chunck_ptr_m->next_chunck_ptr_m : begin_chunck_ptr_m)) {
+                    AddChunck();
+                }
+                fill_chunck_ptr_m = fill_chunck_ptr_m ? fill_chunck_ptr_m->next_chunck_ptr_m : begin_chunck_ptr_m;
+            }
 
-        for (size_t offset = 0; offset != from_node_ptr->size_m; ++offset) {
-            data_allocator_trait_t::destroy(data_alloc_m, from_node_ptr->data_m + offset);
+            data_allocator_trait_t::construct(owner_m.data_alloc_m, fill_chunck_ptr_m->data_m + fill_chunck_ptr_m->size_m,
+                std::forward<ArgsTs>(args)...);
+            ++(fill_chunck_ptr_m->size_m);
+            ++size_m;
+        };
+
+
+        /* Relocates [from, to) to the back of the chain, the chuncks for them have to be reserved */
+        void RelocateBack(pointer from, pointer to) noexcept {
+            while (from != to) {
+                if (!fill_chunck_ptr_m || fill_chunck_ptr_m->size_m == ChunckSize) {
+                    fill_chunck_ptr_m = fill_chunck_ptr_m ? fill_chunck_ptr_m->next_chunck_ptr_m : begin_chunck_ptr_m;
+                }
+
+                size_t count = std::min<size_t>(to - from, ChunckSize - fill_chunck_ptr_m->size_m);
+                details::RelocateBytes(fill_chunck_ptr_m->data_m + fill_chunck_ptr_m->size_m, from, count);
+                fill_chunck_ptr_m->size_m += count;
+                size_m += count;
+                from += count;
+            }
+        };
+
+
+        /*
+            Fills slots with spans over the free slots of the chuncks reserved for the next count elements,
+            at most max_slots of them, returns how many spans are filled
+        */
+        size_t FreeSlots(std::span<value_type>* slots, size_t max_slots, size_type count) noexcept {
+            node_ptr_t current = fill_chunck_ptr_m && fill_chunck_ptr_m->size_m != ChunckSize
+                ? fill_chunck_ptr_m
+                : (fill_chunck_ptr_m ? fill_chunck_ptr_m->next_chunck_ptr_m : begin_chunck_ptr_m);
+            size_t slot_count = 0;
+
+            for (; current && count && slot_count != max_slots; current = current->next_chunck_ptr_m) {
+                size_type free_count = std::min<size_type>(count, ChunckSize - current->size_m);
+                slots[slot_count++] = std::span<value_type>{static_cast<pointer>(current->data_m) + current->size_m, free_count};
+                count -= free_count;
+            }
+            return slot_count;
+        };
+
+
+        /* Takes over count elements written into the slots given by FreeSlots */
+        void Commit(size_type count) noexcept {
+            while (count) {
+                if (!fill_chunck_ptr_m || fill_chunck_ptr_m->size_m == ChunckSize) {
+                    fill_chunck_ptr_m = fill_chunck_ptr_m ? fill_chunck_ptr_m->next_chunck_ptr_m : begin_chunck_ptr_m;
+                }
+
+                size_type taken = std::min<size_type>(count, ChunckSize - fill_chunck_ptr_m->size_m);
+                fill_chunck_ptr_m->size_m += taken;
+                size_m += taken;
+                count -= taken;
+            }
+        };
+
+
+        size_type Size() const noexcept { return size_m; };
+
+
+        /* Hands the filled chuncks over to the caller, the unused reserved ones are freed */
+        std::pair<node_ptr_t, node_ptr_t> Release() noexcept {
+            if (fill_chunck_ptr_m && fill_chunck_ptr_m != end_chunck_ptr_m) {
+                node_ptr_t unused_begin = fill_chunck_ptr_m->next_chunck_ptr_m;
+                fill_chunck_ptr_m->next_chunck_ptr_m = nullptr;
+                owner_m.ReleaseChunckChain(unused_begin);
+            }
+
+            std::pair<node_ptr_t, node_ptr_t> result{begin_chunck_ptr_m, fill_chunck_ptr_m};
+            begin_chunck_ptr_m = end_chunck_ptr_m = fill_chunck_ptr_m = nullptr;
+            size_m = 0;
+            return result;
+        };
+
+      private:
+        void AddChunck() {
+            if (!begin_chunck_ptr_m) {
+                begin_chunck_ptr_m = end_chunck_ptr_m = owner_m.AcquireChunck();
+            } else {
+                end_chunck_ptr_m = chunck_traits::IncludeChunckBack(end_chunck_ptr_m, owner_m.AcquireChunck());
+            }
+        };
+
+      private:
+        unrolled_list& owner_m;
+        node_ptr_t begin_chunck_ptr_m = nullptr;
+        node_ptr_t end_chunck_ptr_m = nullptr;
+        node_ptr_t fill_chunck_ptr_m = nullptr;
+        size_type size_m = 0;
+    };
+
+
+    template<typename FillFuncType>
+    iterator InsertChain(const_iterator pos_itr, FillFuncType&& fill_func) {
+        node_ptr_t pos_chunck = static_cast<node_ptr_t>(pos_itr.base());
+        size_t pos_offset = pos_itr.base().get_chunck_offset();
+
+        ChunckChain chain(*this);
+        fill_func(chain);
+
+        size_type inserted = chain.Size();
+        if (!inserted) {
+            return pos_itr.base();
+        }
+
+        bool is_tail_moved = pos_chunck && pos_offset != 0 && pos_offset != pos_chunck->size_m;
+        if (is_tail_moved) {
+            if constexpr (is_trivially_relocatable_v<value_type>) {
+                chain.Reserve(pos_chunck->size_m - pos_offset);
+                chain.RelocateBack(pos_chunck->data_m + pos_offset, pos_chunck->data_m + pos_chunck->size_m);
+            } else {
+                chain.Reserve(pos_chunck->size_m - pos_offset);
+                for (size_t offset = pos_offset; offset != pos_chunck->size_m; ++offset) {
+                    chain.EmplaceBack(std::move_if_noexcept(*(pos_chunck->data_m + offset)));
+                }
+                DestroyElements(pos_chunck->data_m + pos_offset, pos_chunck->data_m + pos_chunck->size_m);
+            }
+            pos_chunck->size_m = pos_offset;
         }
 
-        if constexpr(std::is_nothrow_move_constructible_v<value_type>) {
-            from_node_ptr = from_node;
-            node_t* swap_ptr_tmp = copy_livetime_controlled[0].release();
-            std::swap(from_node_ptr, swap_ptr_tmp);
-            copy_livetime_controlled[0].reset(swap_ptr_tmp);
+        auto [chain_begin, chain_end] = chain.Release();
+        size_m += inserted;
 
-            to_node_ptr = to_node;
-            swap_ptr_tmp = copy_livetime_controlled[1].release();
-            std::swap(to_node_ptr, swap_ptr_tmp);
-            copy_livetime_controlled[1].reset(swap_ptr_tmp);
+        return LinkChain(pos_chunck, pos_offset, chain_begin, chain_end);
+    };
 
-            if (from_node->next_chunck_ptr_m == to_node || to_node->prev_chunck_ptr_m == from_node) {
-                if (from_node_ptr->prev_chunck_ptr_m)
-                    from_node_ptr->prev_chunck_ptr_m->next_chunck_ptr_m = from_node_ptr;
-                if (to_node_ptr->next_chunck_ptr_m)
-                    to_node_ptr->next_chunck_ptr_m->prev_chunck_ptr_m = to_node_ptr;
 
-                from_node_ptr->next_chunck_ptr_m = to_node_ptr;
-                to_node_ptr->prev_chunck_ptr_m = from_node_ptr;
+    /*
+        Links the detached chain [chain_begin, chain_end] at a chunck boundary: in front of pos_chunck
+        when pos_offset is 0, right after it otherwise. Only the two seams get rebalanced.
+        Returns the iterator to the first linked element.
+    */
+    iterator LinkChain(node_ptr_t pos_chunck, size_t pos_offset, node_ptr_t chain_begin, node_ptr_t chain_end)
+      noexcept(is_nothrow_relocatable_v<value_type>) {
+        if (!pos_chunck) {
+            begin_chunck_ptr_m = chain_begin;
+            end_chunck_ptr_m = chain_end;
+        } else if (pos_offset == 0) {
+            chunck_traits::IncludeChunckFront(pos_chunck, chain_begin, chain_end);
+            if (pos_chunck == begin_chunck_ptr_m) {
+                begin_chunck_ptr_m = chain_begin;
+            }
+        } else {
+            chunck_traits::IncludeChunckBack(pos_chunck, chain_begin, chain_end);
+            if (pos_chunck == end_chunck_ptr_m) {
+                end_chunck_ptr_m = chain_end;
+            }
+        }
 
-            } else if (from_node->prev_chunck_ptr_m == to_node || to_node->next_chunck_ptr_m == from_node) {
-                if (from_node_ptr->next_chunck_ptr_m)
-                    from_node_ptr->next_chunck_ptr_m->prev_chunck_ptr_m = from_node_ptr;
+        node_ptr_t result_chunck = chain_begin;
+        size_t result_offset = 0;
 
-                if (to_node_ptr->prev_chunck_ptr_m)
-                    to_node_ptr->prev_chunck_ptr_m->next_chunck_ptr_m = to_node_ptr;
+        if constexpr (is_nothrow_relocatable_v<value_type>) {
+            node_ptr_t right_chunck = chain_end->next_chunck_ptr_m;
 
-                from_node_ptr->prev_chunck_ptr_m = to_node_ptr;
-                to_node_ptr->next_chunck_ptr_m = from_node_ptr;
+            if (chain_begin->prev_chunck_ptr_m) {
+                RebalanceSeam(chain_begin->prev_chunck_ptr_m, chain_begin, result_chunck, result_offset);
+            }
+            if (right_chunck) {
+                RebalanceSeam(right_chunck->prev_chunck_ptr_m, right_chunck, result_chunck, result_offset);
+            }
+        }
+
+        return MakeCanonicalIterator(result_chunck, result_offset);
+    };
+
+
+    /*
+        Moves the elements of current_chunck from offset on into a fresh chunck linked right after it.
+        Nothing changes when it throws.
+    */
+    node_ptr_t SplitChunck(node_ptr_t current_chunck, size_t offset) {
+        node_ptr_t added_chunck = AcquireChunck();
+        pointer from = current_chunck->data_m + offset;
+        pointer to = current_chunck->data_m + current_chunck->size_m;
 
+        if constexpr (is_nothrow_relocatable_v<value_type>) {
+            MoveElements(from, to, added_chunck->data_m);
+        } else {
+            try {
+                for (; from + added_chunck->size_m != to; ++(added_chunck->size_m)) {
+                    data_allocator_trait_t::construct(data_alloc_m, added_chunck->data_m + added_chunck->size_m,
+                        std::move_if_noexcept(*(from + added_chunck->size_m)));
+                }
+            } catch(...) {
+                DestroyElements(added_chunck->data_m, added_chunck->data_m + added_chunck->size_m);
+                ReleaseChunck(added_chunck);
+                throw;
+            }
+            DestroyElements(from, to);
+        }
+
+        added_chunck->size_m = to - from;
+        current_chunck->size_m = offset;
+
+        chunck_traits::IncludeChunckBack(current_chunck, added_chunck);
+        if (current_chunck == end_chunck_ptr_m) {
+            end_chunck_ptr_m = added_chunck;
+        }
+        return added_chunck;
+    };
+
+
+    /*
+        Unlinks the chuncks holding [pos_itr, end()), splitting the chunck at pos_itr first,
+        and returns them as a detached chain with the count of its elements.
+        tracked_chunck/tracked_offset follow an element of the remaining prefix.
+    */
+    std::tuple<node_ptr_t, node_ptr_t, size_type> DetachSuffix(const_iterator pos_itr, node_ptr_t& tracked_chunck, size_t& tracked_offset) {
+        node_ptr_t pos_chunck = static_cast<node_ptr_t>(pos_itr.base());
+        size_t pos_offset = pos_itr.base().get_chunck_offset();
+
+        if (!pos_chunck || pos_offset == pos_chunck->size_m) {
+            return {nullptr, nullptr, 0};
+        }
+
+        if (pos_offset != 0) {
+            pos_chunck = SplitChunck(pos_chunck, pos_offset);
+        }
+
+        size_type chain_size = 0;
+        for (node_ptr_t current = pos_chunck; current; current = current->next_chunck_ptr_m) {
+            chain_size += current->size_m;
+        }
+
+        node_ptr_t chain_end = end_chunck_ptr_m;
+        end_chunck_ptr_m = pos_chunck->prev_chunck_ptr_m;
+        pos_chunck->prev_chunck_ptr_m = nullptr;
+        if (end_chunck_ptr_m) {
+            end_chunck_ptr_m->next_chunck_ptr_m = nullptr;
+        } else {
+            begin_chunck_ptr_m = nullptr;
+        }
+        size_m -= chain_size;
+
+        if constexpr (is_nothrow_relocatable_v<value_type>) {
+            if (end_chunck_ptr_m && end_chunck_ptr_m->prev_chunck_ptr_m) {
+                RebalanceSeam(end_chunck_ptr_m->prev_chunck_ptr_m, end_chunck_ptr_m, tracked_chunck, tracked_offset);
+            }
+        }
+
+        return {pos_chunck, chain_end, chain_size};
+    };
+
+
+    /* Chuncks of other can be linked into this list only when this allocator is able to free them */
+    bool IsSameStorage(const unrolled_list& other) const noexcept {
+        if constexpr (allocator_trait_t::is_always_equal::value) {
+            return true;
+        } else {
+            return alloc_m == other.alloc_m;
+        }
+    };
+
+
+    /* Chain of chuncks holding one sorted run, ends with nullptr on both sides */
+    struct SortRun {
+        node_ptr_t begin_m = nullptr;
+        node_ptr_t end_m = nullptr;
+    };
+
+
+    /* Lock of the spare cache when every merge runs on the calling thread */
+    struct NoSortLock {
+        void lock() noexcept {  };
+        void unlock() noexcept {  };
+    };
+
+
+    /*
+        Chuncks of a single merge: the drained input chuncks are kept here and reused for the output,
+        so the spare cache of the list behind lock is visited only a few times per merge.
+    */
+    template<typename LockType>
+    class SortChunckCache {
+      public:
+        SortChunckCache(unrolled_list& owner, LockType& lock) noexcept : owner_m(owner), lock_m(lock) {  };
+
+        SortChunckCache(const SortChunckCache&) = delete;
+        SortChunckCache& operator=(const SortChunckCache&) = delete;
+
+        ~SortChunckCache() {
+            lock_m.lock();
+            owner_m.ReleaseChunckChain(spare_chunck_ptr_m);
+            lock_m.unlock();
+        };
+
+
+        node_ptr_t Acquire() {
+            if (!spare_chunck_ptr_m) {
+                lock_m.lock();
+                try {
+                    node_ptr_t acquired_chunck = owner_m.AcquireChunck();
+                    lock_m.unlock();
+                    return acquired_chunck;
+                } catch(...) {
+                    lock_m.unlock();
+                    throw;
+                }
+            }
+
+            node_ptr_t acquired_chunck = spare_chunck_ptr_m;
+            spare_chunck_ptr_m = acquired_chunck->next_chunck_ptr_m;
+            acquired_chunck->next_chunck_ptr_m = nullptr;
+            return acquired_chunck;
+        };
+
+
+        void Release(node_ptr_t released_chunck) noexcept {
+            released_chunck->size_m = 0;
+            released_chunck->prev_chunck_ptr_m = nullptr;
+            released_chunck->next_chunck_ptr_m = spare_chunck_ptr_m;
+            spare_chunck_ptr_m = released_chunck;
+        };
+
+      private:
+        unrolled_list& owner_m;
+        LockType& lock_m;
+        node_ptr_t spare_chunck_ptr_m = nullptr;
+    };
+
+
+    /*
+        Tasks policy of sort/stable_sort which runs everything on the calling thread. A tasks policy gives
+            kMaxTasks          - the most tasks a level of the sort is split into
+            kMinTaskElements   - the least elements worth a task of their own
+            lock_type          - the lock of the spare cache shared by the tasks
+            operator()(count, task), which calls task(index) for every index of [0, count), maybe concurrently
+    */
+    struct SequentialSortTasks {
+        static constexpr size_t kMaxTasks = 1;
+        static constexpr size_t kMinTaskElements = 1;
+        using lock_type = NoSortLock;
+
+        template<typename TaskType>
+        void operator()(size_t count, TaskType&& task) const {
+            for (size_t ind = 0; ind != count; ++ind) {
+                task(ind);
+            }
+        };
+    };
+
+
+    /*
+        Body of sort/stable_sort. The chain is cut into segments of neighbour chuncks, a task per segment
+        sorts it with a bottom-up merge over its chuncks, then the segments are merged pairwise, level by level.
+        The segments are kept in arrays of SortTasksType::kMaxTasks on the stack.
+    */
+    template<typename CompareType, typename SortTasksType>
+    void SortChuncks(CompareType& comp, bool is_stable, const SortTasksType& run_tasks) {
+        if (!begin_chunck_ptr_m) {
+            return;
+        }
+
+        if constexpr (!is_nothrow_relocatable_v<value_type>) {
+            if (begin_chunck_ptr_m == end_chunck_ptr_m) {
+                SortEveryChunck(SortRun{begin_chunck_ptr_m, end_chunck_ptr_m}, comp, is_stable);
             } else {
-                if (to_node_ptr->next_chunck_ptr_m)
-                    to_node_ptr->next_chunck_ptr_m->prev_chunck_ptr_m = to_node_ptr;
+                SortByCopy(comp, is_stable);
+            }
+        } else {
+            size_t chunck_count = 0;
+            for (node_ptr_t current = begin_chunck_ptr_m; current; current = current->next_chunck_ptr_m) {
+                ++chunck_count;
+            }
+
+            size_t segment_count = std::min({SortTasksType::kMaxTasks, chunck_count,
+                std::max<size_t>(1, size_m / SortTasksType::kMinTaskElements)});
+            size_t segment_chuncks = (chunck_count + segment_count - 1) / segment_count;
+            segment_count = (chunck_count + segment_chuncks - 1) / segment_chuncks;
+
+            SortRun segments[SortTasksType::kMaxTasks];
+            SortRun merged[SortTasksType::kMaxTasks];
+            node_ptr_t current = begin_chunck_ptr_m;
+            for (size_t index = 0; index != segment_count; ++index) {
+                segments[index].begin_m = current;
+                for (size_t ind = 1; ind != segment_chuncks && current->next_chunck_ptr_m; ++ind) {
+                    current = current->next_chunck_ptr_m;
+                }
+                segments[index].end_m = current;
+
+                current = current->next_chunck_ptr_m;
+                segments[index].end_m->next_chunck_ptr_m = nullptr;
+                if (current) {
+                    current->prev_chunck_ptr_m = nullptr;
+                }
+            }
+            begin_chunck_ptr_m = end_chunck_ptr_m = nullptr;
+
+            typename SortTasksType::lock_type lock;
+            try {
+                run_tasks(segment_count, [&](size_t index) { SortSegment(segments[index], comp, is_stable, lock); });
+            } catch(...) {
+                for (size_t index = 0; index != segment_count; ++index) {
+                    LinkSortRun(segments[index]);
+                }
+                throw;
+            }
+
+            /* a single task never leaves more than one segment to merge */
+            if constexpr (SortTasksType::kMaxTasks > 1) {
+                while (segment_count > 1) {
+                    size_t pair_count = segment_count / 2;
+                    std::fill_n(merged, pair_count, SortRun{});
+
+                    try {
+                        run_tasks(pair_count, [&](size_t index) {
+                            MergeRuns(merged[index], segments[2 * index], segments[2 * index + 1], comp, lock);
+                        });
+                    } catch(...) {
+                        /* every element stays in the list, the finished merges keep their order */
+                        for (size_t index = 0; index != pair_count; ++index) {
+                            if (merged[index].begin_m) {
+                                LinkSortRun(merged[index]);
+                            } else {
+                                LinkSortRun(segments[2 * index]);
+                                LinkSortRun(segments[2 * index + 1]);
+                            }
+                        }
+                        if (segment_count % 2) {
+                            LinkSortRun(segments[segment_count - 1]);
+                        }
+                        throw;
+                    }
+
+                    std::copy_n(merged, pair_count, segments);
+                    if (segment_count % 2) {
+                        segments[pair_count] = segments[segment_count - 1];
+                    }
+                    segment_count = pair_count + segment_count % 2;
+                }
+            }
 
-                if (to_node_ptr->prev_chunck_ptr_m)
-                    to_node_ptr->prev_chunck_ptr_m->next_chunck_ptr_m = to_node_ptr;
+            begin_chunck_ptr_m = segments[0].begin_m;
+            end_chunck_ptr_m = segments[0].end_m;
+        }
+    };
 
-                if (from_node_ptr->next_chunck_ptr_m)
-                    from_node_ptr->next_chunck_ptr_m->prev_chunck_ptr_m = from_node_ptr;
 
-                if (from_node_ptr->prev_chunck_ptr_m)
-                    from_node_ptr->prev_chunck_ptr_m->next_chunck_ptr_m = from_node_ptr;
+    template<typename CompareType>
+    static void SortEveryChunck(SortRun run, CompareType& comp, bool is_stable) {
+        for (node_ptr_t current = run.begin_m; current; current = current->next_chunck_ptr_m) {
+            pointer first = current->data_m;
+            if (is_stable) {
+                std::stable_sort(first, first + current->size_m, comp);
+            } else {
+                std::sort(first, first + current->size_m, comp);
             }
         }
+    };
 
-        if (to_node == beg_chunck || from_node == beg_chunck)
-            begin_chunck_ptr_m = to_node_ptr;
 
-        if (to_node == end_chunck || from_node == end_chunck)
-            end_chunck_ptr_m = to_node_ptr;
+    /*
+        Sorts every chunck of a detached run in place, then merges the sorted stretches of its chain
+        pairwise, pass after pass, until a pass finds the run sorted. On a throw run keeps every chunck.
+    */
+    template<typename CompareType, typename LockType>
+    void SortSegment(SortRun& run, CompareType& comp, bool is_stable, LockType& lock) {
+        SortEveryChunck(run, comp, is_stable);
+
+        for (bool is_merged = true; is_merged;) {
+            is_merged = false;
+            SortRun sorted;
+            SortRun left;
+            SortRun right;
+            SortRun rest = run;
+
+            try {
+                while (rest.begin_m) {
+                    left = CutSortedRun(rest, comp);
+                    if (rest.begin_m) {
+                        right = CutSortedRun(rest, comp);
+
+                        SortRun merged_left = std::exchange(left, SortRun{});
+                        SortRun merged_right = std::exchange(right, SortRun{});
+                        MergeRuns(left, merged_left, merged_right, comp, lock);
+                        is_merged = true;
+                    }
+                    sorted = ConcatSortRuns(sorted, std::exchange(left, SortRun{}));
+                }
+            } catch(...) {
+                run = ConcatSortRuns(ConcatSortRuns(ConcatSortRuns(sorted, left), right), rest);
+                throw;
+            }
+            run = sorted;
+        }
+    };
 
 
-        to_node_ptr->size_m += from_node_ptr->size_m; 
-        from_node_ptr->size_m = 0;
+    /* Cuts off the front of rest which is already in order, nothing is cut when comp throws */
+    template<typename CompareType>
+    static SortRun CutSortedRun(SortRun& rest, CompareType& comp) {
+        node_ptr_t run_end = rest.begin_m;
+        while (run_end->next_chunck_ptr_m
+            && !comp(run_end->next_chunck_ptr_m->data_m[0], run_end->data_m[run_end->size_m - 1])) {
+            run_end = run_end->next_chunck_ptr_m;
+        }
 
-        return to_node_ptr;
+        SortRun run{rest.begin_m, run_end};
+        rest.begin_m = run_end->next_chunck_ptr_m;
+        if (rest.begin_m) {
+            rest.begin_m->prev_chunck_ptr_m = nullptr;
+        } else {
+            rest.end_m = nullptr;
+        }
+        run_end->next_chunck_ptr_m = nullptr;
+        return run;
     };
-    
+
+
+    /* Links a detached run to the end of the list */
+    void LinkSortRun(SortRun run) noexcept {
+        if (!end_chunck_ptr_m) {
+            begin_chunck_ptr_m = run.begin_m;
+        } else {
+            chunck_traits::IncludeChunckBack(end_chunck_ptr_m, run.begin_m, run.end_m);
+        }
+        end_chunck_ptr_m = run.end_m;
+    };
+
+
+    /*
+        Merges two detached sorted runs into result, equal elements of left go first.
+        Slices which go to the output without interleaving are moved at once. The drained input
+        chuncks return to cache and the tail of the run left over is relinked as is.
+        On a throw result gets the output followed by what is left of both runs.
+    */
+    template<typename CompareType, typename LockType>
+    void MergeRuns(SortRun& result, SortRun left, SortRun right, CompareType& comp, LockType& lock) {
+        SortChunckCache<LockType> cache(*this, lock);
+        SortRun output;
+        size_t left_offset = 0;
+        size_t right_offset = 0;
+
+        auto reserve_output = [&]() {
+            if (!output.end_m || output.end_m->size_m == ChunckSize) {
+                node_ptr_t added_chunck = cache.Acquire();
+                if (!output.end_m) {
+                    output.begin_m = output.end_m = added_chunck;
+                } else {
+                    output.end_m = chunck_traits::IncludeChunckBack(output.end_m, added_chunck);
+                }
+            }
+        };
+
+        auto release_drained = [&](SortRun& run, size_t& offset) {
+            node_ptr_t current_chunck = run.begin_m;
+            if (offset == current_chunck->size_m) {
+                run.begin_m = current_chunck->next_chunck_ptr_m;
+                if (run.begin_m) {
+                    run.begin_m->prev_chunck_ptr_m = nullptr;
+                } else {
+                    run.end_m = nullptr;
+                }
+                offset = 0;
+                cache.Release(current_chunck);
+            }
+        };
+
+        auto move_to_output = [&](SortRun& run, size_t& offset, size_t count) {
+            node_ptr_t current_chunck = run.begin_m;
+
+            while (count) {
+                reserve_output();
+
+                size_t moved = std::min(count, ChunckSize - output.end_m->size_m);
+                MoveElements(current_chunck->data_m + offset, current_chunck->data_m + offset + moved,
+                    output.end_m->data_m + output.end_m->size_m);
+                output.end_m->size_m += moved;
+                offset += moved;
+                count -= moved;
+            }
+            release_drained(run, offset);
+        };
+
+        try {
+            while (left.begin_m && right.begin_m) {
+                node_ptr_t left_chunck = left.begin_m;
+                node_ptr_t right_chunck = right.begin_m;
+                const value_type& left_head = left_chunck->data_m[left_offset];
+                const value_type& right_head = right_chunck->data_m[right_offset];
+
+                if (!comp(right_head, left_chunck->data_m[left_chunck->size_m - 1])) {
+                    move_to_output(left, left_offset, left_chunck->size_m - left_offset);
+                } else if (comp(right_chunck->data_m[right_chunck->size_m - 1], left_head)) {
+                    move_to_output(right, right_offset, right_chunck->size_m - right_offset);
+                } else {
+                    /* interleaved heads: element by element until one of the three chuncks runs out */
+                    reserve_output();
+                    node_ptr_t output_chunck = output.end_m;
+                    size_t steps = std::min({left_chunck->size_m - left_offset, right_chunck->size_m - right_offset,
+                        ChunckSize - output_chunck->size_m});
+
+                    for (; steps; --steps) {
+                        bool is_right = comp(right_chunck->data_m[right_offset], left_chunck->data_m[left_offset]);
+                        pointer from = is_right ? right_chunck->data_m + right_offset++ : left_chunck->data_m + left_offset++;
+
+                        MoveElements(from, from + 1, output_chunck->data_m + output_chunck->size_m);
+                        ++output_chunck->size_m;
+                    }
+
+                    release_drained(left, left_offset);
+                    release_drained(right, right_offset);
+                }
+            }
+
+            SortRun& rest = left.begin_m ? left : right;
+            size_t& rest_offset = left.begin_m ? left_offset : right_offset;
+
+            if (rest.begin_m && rest_offset) {
+                move_to_output(rest, rest_offset, rest.begin_m->size_m - rest_offset);
+            }
+        } catch(...) {
+            /* the output chunck reserved right before the throw may still be empty */
+            if (output.end_m && output.end_m->size_m == 0) {
+                node_ptr_t empty_chunck = output.end_m;
+                output.end_m = empty_chunck->prev_chunck_ptr_m;
+                if (output.end_m) {
+                    output.end_m->next_chunck_ptr_m = nullptr;
+                } else {
+                    output.begin_m = nullptr;
+                }
+                cache.Release(empty_chunck);
+            }
+
+            for (auto [run, offset] : {std::pair{&left, left_offset}, std::pair{&right, right_offset}}) {
+                if (run->begin_m && offset) {
+                    shift_left(run->begin_m->data_m + offset, run->begin_m->data_m + run->begin_m->size_m, offset);
+                    run->begin_m->size_m -= offset;
+                }
+            }
+
+            result = ConcatSortRuns(ConcatSortRuns(output, left), right);
+            throw;
+        }
+
+        result = ConcatSortRuns(ConcatSortRuns(output, left), right);
+    };
+
+
+    static SortRun ConcatSortRuns(SortRun first, SortRun second) noexcept {
+        if (!first.begin_m) {
+            return second;
+        }
+        if (!second.begin_m) {
+            return first;
+        }
+
+        chunck_traits::IncludeChunckBack(first.end_m, second.begin_m, second.end_m);
+        return SortRun{first.begin_m, second.end_m};
+    };
+
+
+    /*
+        Sort of types which may throw on a move: sorts a list of pointers to the elements,
+        then copies the elements into fresh chuncks in that order
+    */
+    template<typename CompareType>
+    void SortByCopy(CompareType& comp, bool is_stable) {
+        using order_allocator_type = typename std::allocator_traits<AllocatorType>::template rebind_alloc<const value_type*>;
+
+        unrolled_list<const value_type*, ChunckSize, order_allocator_type> order{order_allocator_type(alloc_m)};
+        for (node_ptr_t current = begin_chunck_ptr_m; current; current = current->next_chunck_ptr_m) {
+            for (size_t offset = 0; offset != current->size_m; ++offset) {
+                order.push_back(std::to_address(current->data_m + offset));
+            }
+        }
+
+        auto pointer_comp = [&](const value_type* lhs, const value_type* rhs) { return comp(*lhs, *rhs); };
+        if (is_stable) {
+            order.stable_sort(pointer_comp);
+        } else {
+            order.sort(pointer_comp);
+        }
+
+        ChunckChain chain(*this);
+        chain.Reserve(size_m);
+        for (const value_type* element : order) {
+            chain.EmplaceBack(*element);
+        }
+
+        size_type sorted_size = chain.Size();
+        clear();
+
+        std::tie(begin_chunck_ptr_m, end_chunck_ptr_m) = chain.Release();
+        size_m = sorted_size;
+    };
+
+
+    void DestroyElements(pointer from, pointer to) noexcept(std::is_nothrow_destructible_v<value_type>) {
+        if constexpr (!std::is_trivially_destructible_v<value_type>) {
+            for (; from != to; ++from) {
+                data_allocator_trait_t::destroy(data_alloc_m, from);
+            }
+        }
+    };
+
+
+    void UnlinkChunck(node_ptr_t current_chunck) noexcept {
+        if (current_chunck == begin_chunck_ptr_m) {
+            begin_chunck_ptr_m = current_chunck->next_chunck_ptr_m;
+        }
+        if (current_chunck == end_chunck_ptr_m) {
+            end_chunck_ptr_m = current_chunck->prev_chunck_ptr_m;
+        }
+
+        ReleaseChunck(chunck_traits::ExcludeChunck(current_chunck));
+    };
+
+
+    /*
+        Merges two neighbour chuncks when the result stays under the merge limit of the fill policy,
+        otherwise refills the one which got below the merge threshold from the other.
+        tracked_chunck/tracked_offset follow the element they point to.
+        Elements which may throw on a move are copied into the neighbour before the originals are dropped.
+    */
+    void RebalanceSeam(node_ptr_t left_chunck, node_ptr_t right_chunck, node_ptr_t& tracked_chunck, size_t& tracked_offset)
+      noexcept(is_nothrow_relocatable_v<value_type>) {
+        size_t left_size = left_chunck->size_m;
+        size_t right_size = right_chunck->size_m;
+
+        if (left_size + right_size <= fill_traits::merge_limit) {
+            MoveElements(right_chunck->data_m, right_chunck->data_m + right_size, left_chunck->data_m + left_size);
+            left_chunck->size_m += right_size;
+            right_chunck->size_m = 0;
+            UnlinkChunck(right_chunck);
+
+            if (tracked_chunck == right_chunck) {
+                tracked_chunck = left_chunck;
+                tracked_offset += left_size;
+            }
+        } else if (left_size < fill_traits::merge_threshold) {
+            size_t moved = std::min(fill_traits::borrow_count, right_size - fill_traits::merge_threshold);
+
+            MoveElements(right_chunck->data_m, right_chunck->data_m + moved, left_chunck->data_m + left_size);
+            left_chunck->size_m += moved;
+            CloseChunckGap(right_chunck, moved, moved);
+
+            if (tracked_chunck == right_chunck && tracked_offset < moved) {
+                tracked_chunck = left_chunck;
+                tracked_offset += left_size;
+            } else if (tracked_chunck == right_chunck) {
+                tracked_offset -= moved;
+            }
+        } else if (right_size < fill_traits::merge_threshold) {
+            size_t moved = std::min(fill_traits::borrow_count, left_size - fill_traits::merge_threshold);
+
+            OpenChunckGap(right_chunck, 0, moved);
+            try {
+                MoveElements(left_chunck->data_m + left_size - moved, left_chunck->data_m + left_size, right_chunck->data_m);
+            } catch(...) {
+                CloseChunckGap(right_chunck, moved, moved);
+                throw;
+            }
+            left_chunck->size_m -= moved;
+
+            if (tracked_chunck == left_chunck && tracked_offset >= left_size - moved) {
+                tracked_chunck = right_chunck;
+                tracked_offset -= left_size - moved;
+            } else if (tracked_chunck == right_chunck) {
+                tracked_offset += moved;
+            }
+        }
+    };
+
+
+    /*
+        Shifts the elements of current_chunck from offset on left by shift slots, over raw storage.
+        The chunck size counts the shift slots before and loses them after. When a move throws,
+        the elements not shifted yet are dropped, so the chunck stays dense, and it is unlinked once empty.
+    */
+    void CloseChunckGap(node_ptr_t current_chunck, size_t offset, size_t shift)
+      noexcept(is_nothrow_relocatable_v<value_type>) {
+        pointer from = current_chunck->data_m + offset;
+        pointer to = current_chunck->data_m + current_chunck->size_m;
+
+        if constexpr (is_nothrow_relocatable_v<value_type>) {
+            shift_left(from, to, shift);
+        } else {
+            try {
+                for (; from != to; ++from) {
+                    data_allocator_trait_t::construct(data_alloc_m, from - shift, std::move_if_noexcept(*from));
+                    data_allocator_trait_t::destroy(data_alloc_m, from);
+                }
+            } catch(...) {
+                DestroyElements(from, to);
+                size_m -= to - from;
+                current_chunck->size_m = from - shift - current_chunck->data_m;
+                if (!current_chunck->size_m) {
+                    UnlinkChunck(current_chunck);
+                }
+                throw;
+            }
+        }
+
+        current_chunck->size_m -= shift;
+    };
+
+
+    /*
+        Shifts the elements of current_chunck from offset on right by shift slots, leaving raw storage behind.
+        The chunck size counts the shift slots after. When a move throws, the elements already shifted
+        are dropped, so the chunck stays dense.
+    */
+    void OpenChunckGap(node_ptr_t current_chunck, size_t offset, size_t shift)
+      noexcept(is_nothrow_relocatable_v<value_type>) {
+        pointer from = current_chunck->data_m + offset;
+        pointer to = current_chunck->data_m + current_chunck->size_m;
+
+        if constexpr (is_nothrow_relocatable_v<value_type>) {
+            shift_right(from, to, shift);
+        } else {
+            pointer current = to;
+            try {
+                while (current != from) {
+                    --current;
+                    data_allocator_trait_t::construct(data_alloc_m, current + shift, std::move_if_noexcept(*current));
+                    data_allocator_trait_t::destroy(data_alloc_m, current);
+                }
+            } catch(...) {
+                DestroyElements(current + 1 + shift, to + shift);
+                size_m -= to - current - 1;
+                current_chunck->size_m = current + 1 - current_chunck->data_m;
+                throw;
+            }
+        }
+
+        current_chunck->size_m += shift;
+    };
+
+
+    /*
+        Moves [from, to) into raw storage at dest and destroys the sources. Elements which may throw
+        on a move are all constructed at dest before any source is destroyed, nothing changes if one throws.
+    */
+    void MoveElements(pointer from, pointer to, pointer dest)
+      noexcept(is_nothrow_relocatable_v<value_type>) {
+        if constexpr (is_trivially_relocatable_v<value_type>) {
+            details::RelocateBytes(dest, from, to - from);
+            return;
+        } else if constexpr (!is_nothrow_relocatable_v<value_type>) {
+            pointer constructed = dest;
+            try {
+                for (pointer current = from; current != to; ++current, ++constructed) {
+                    data_allocator_trait_t::construct(data_alloc_m, constructed, std::move_if_noexcept(*current));
+                }
+            } catch(...) {
+                DestroyElements(dest, constructed);
+                throw;
+            }
+            DestroyElements(from, to);
+            return;
+        }
+
+        for (; from != to; ++from, ++dest) {
+            data_allocator_trait_t::construct(data_alloc_m, dest, std::move(*from));
+            data_allocator_trait_t::destroy(data_alloc_m, from);
+        }
+    };
+
+
+    iterator MakeCanonicalIterator(node_ptr_t result_chunck, size_t result_offset) noexcept {
+        if (!result_chunck) {
+            return end();
+        }
+        if (result_offset == result_chunck->size_m && result_chunck->next_chunck_ptr_m) {
+            return {result_chunck->next_chunck_ptr_m, 0};
+        }
+        return {result_chunck, result_offset};
+    };
+
+
+    void DropAddedChunck(node_ptr_t added_chunck) noexcept {
+        if (begin_chunck_ptr_m == end_chunck_ptr_m) {
+            begin_chunck_ptr_m = end_chunck_ptr_m = nullptr;
+        } else if (added_chunck == end_chunck_ptr_m) {
+            end_chunck_ptr_m = added_chunck->prev_chunck_ptr_m;
+        } else {
+            begin_chunck_ptr_m = added_chunck->next_chunck_ptr_m;
+        }
+        ReleaseChunck(chunck_traits::ExcludeChunck(added_chunck));
+    };
+
+
+    /*
+        Takes an empty unlinked chunck from the spare cache, allocates one when the cache is empty.
+        A reused chunck gets a fresh extension, as an allocated one does
+    */
+    node_ptr_t AcquireChunck() {
+        if (!spare_chunck_ptr_m) {
+            return chunck_traits::CreateChunck(alloc_m);
+        }
+
+        node_ptr_t acquired_chunck = spare_chunck_ptr_m;
+        spare_chunck_ptr_m = acquired_chunck->next_chunck_ptr_m;
+        acquired_chunck->next_chunck_ptr_m = nullptr;
+        acquired_chunck->extension_m = {};
+        --spare_count_m;
+        return acquired_chunck;
+    };
+
+
+    /* Puts an emptied unlinked chunck into the spare cache, frees it once the cache is full */
+    void ReleaseChunck(node_ptr_t released_chunck) noexcept {
+        if (spare_count_m == spare_limit_m) {
+            chunck_traits::RemoveChunck(released_chunck, alloc_m);
+            return;
+        }
+
+        released_chunck->size_m = 0;
+        released_chunck->prev_chunck_ptr_m = nullptr;
+        released_chunck->next_chunck_ptr_m = spare_chunck_ptr_m;
+        spare_chunck_ptr_m = released_chunck;
+        ++spare_count_m;
+    };
+
+
+    /* Releases a detached chain of emptied chuncks ending with nullptr */
+    void ReleaseChunckChain(node_ptr_t chain_begin) noexcept {
+        while (chain_begin) {
+            node_ptr_t next_chunck = chain_begin->next_chunck_ptr_m;
+            ReleaseChunck(chain_begin);
+            chain_begin = next_chunck;
+        }
+    };
+
+
+    void FreeSpareChuncks() noexcept {
+        while (spare_chunck_ptr_m) {
+            node_ptr_t next_chunck = spare_chunck_ptr_m->next_chunck_ptr_m;
+            chunck_traits::RemoveChunck(spare_chunck_ptr_m, alloc_m);
+            spare_chunck_ptr_m = next_chunck;
+        }
+        spare_count_m = 0;
+    };
+
 
     template<typename... ArgsTs>
     requires std::constructible_from<value_type, ArgsTs...>
-    void ChunckPlace(node_t* current_chunck, size_t position, ArgsTs&&... args) {
+    void ChunckPlace(node_ptr_t current_chunck, size_t position, ArgsTs&&... args) {
         if (current_chunck->size_m) {
             shift_right(current_chunck->data_m + position, current_chunck->data_m + current_chunck->size_m, 1);
         }
@@ -892,6 +2213,11 @@ class unrolled_list {
 
 
     void shift_right(pointer from, pointer to, size_t shift) {
+        if constexpr (is_trivially_relocatable_v<value_type>) {
+            details::RelocateBytes(from + shift, from, to - from);
+            return;
+        }
+
         auto current = to;
 
         while (current != from) {
@@ -903,6 +2229,11 @@ class unrolled_list {
 
 
     void shift_left(pointer from, pointer to, size_t shift) {
+        if constexpr (is_trivially_relocatable_v<value_type>) {
+            details::RelocateBytes(from - shift, from, to - from);
+            return;
+        }
+
         auto current = from;
 
         while (current != to) {
@@ -943,8 +2274,8 @@ class unrolled_list {
 
 
   protected:
-    node_t* begin_chunck_ptr_m = nullptr;
-    node_t* end_chunck_ptr_m = nullptr;
+    node_ptr_t begin_chunck_ptr_m = nullptr;
+    node_ptr_t end_chunck_ptr_m = nullptr;
 
 protected:
 #if defined(_WIN32) || defined(_WIN64) 
@@ -955,13 +2286,44 @@ protected:
     [[no_unique_address]] data_allocator_type data_alloc_m;
 #endif
     size_t size_m = 0; 
+
+    /* emptied chuncks kept for reuse, linked through next_chunck_ptr_m */
+    node_ptr_t spare_chunck_ptr_m = nullptr;
+    size_type spare_count_m = 0;
+    size_type spare_limit_m = kDefaultSpareChuncks;
+
+    [[no_unique_address]] details::InsertPatternTracker<node_ptr_t, fill_traits::adaptive_split> insert_tracker_m;
 };
 
 
+
+/* unrolled_list which chuncks take kBytes, see chunck_byte_budget */
+template<std::copy_constructible DataType, size_t kBytes = 256, typename AllocatorType = std::allocator<DataType>,
+    chunck_fill_policy FillPolicyType = fill_policy::balanced>
+using unrolled_list_for_bytes = unrolled_list<DataType, chunck_byte_budget<DataType, kBytes>::chunck_size,
+    AllocatorType, FillPolicyType, EmptyChunckExtension, chunck_byte_budget<DataType, kBytes>::alignment>;
+
 }  // labwork7
 
 
-template<std::copy_constructible DataType, size_t ChunckSize = 10, typename AllocatorType = std::allocator<DataType>>
-using unrolled_list = labwork7::unrolled_list<DataType, ChunckSize, AllocatorType>;
+/* Iterator walks the chuncks to measure a distance, so it must not pass for a constant time sized sentinel */
+namespace std {
+
+template<typename UnrolledListType>
+inline constexpr bool disable_sized_sentinel_for<labwork7::details::Iterator<UnrolledListType>,
+    labwork7::details::Iterator<UnrolledListType>> = true;
+
+} // namespace std
+
+
+template<std::copy_constructible DataType, size_t ChunckSize = 10, typename AllocatorType = std::allocator<DataType>,
+    labwork7::chunck_fill_policy FillPolicyType = labwork7::fill_policy::balanced,
+    typename ChunckExtensionType = labwork7::EmptyChunckExtension, size_t ChunckAlignment = 0>
+using unrolled_list = labwork7::unrolled_list<DataType, ChunckSize, AllocatorType, FillPolicyType, ChunckExtensionType, ChunckAlignment>;
+
+
+template<std::copy_constructible DataType, size_t kBytes = 256, typename AllocatorType = std::allocator<DataType>,
+    labwork7::chunck_fill_policy FillPolicyType = labwork7::fill_policy::balanced>
+using unrolled_list_for_bytes = labwork7::unrolled_list_for_bytes<DataType, kBytes, AllocatorType, FillPolicyType>;
 
 #endif // _UNROLLED_LIST_HPP_
\ No newline at end of file
@@ -0,0 +1,322 @@
+#ifndef _UNROLLED_LIST_IO_HPP_
+#define _UNROLLED_LIST_IO_HPP_
+
+#include <algorithm>
+#include <cerrno>
+#include <concepts>
+#include <cstddef>
+#include <filesystem>
+#include <istream>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "unrolled_list.hpp"
+#include "details/binary_snapshot.hpp"
+
+/*
+    Binary snapshots and streaming bulk load of unrolled_list over POSIX file descriptors.
+    Kept out of unrolled_list.hpp, so the container itself needs neither POSIX nor <filesystem>.
+*/
+
+namespace labwork7 {
+
+/*
+    How append_from reads a stream: elements separated by whitespace or their raw bytes.
+    Every format is a tag of its own, so reading elements in a format they do not support does not compile.
+*/
+namespace stream_format {
+
+struct text_t {
+    explicit text_t() = default;
+};
+
+
+struct binary_t {
+    explicit binary_t() = default;
+};
+
+
+inline constexpr text_t text{};
+inline constexpr binary_t binary{};
+
+} // namespace stream_format
+
+
+namespace details {
+
+/* Gives the snapshot and stream functions access to the chuncks of unrolled_list */
+struct ListIoAccess {
+    template<typename ListType>
+    static void Save(const ListType& list, const std::filesystem::path& path) {
+        using value_type = typename ListType::value_type;
+
+        std::filesystem::path written_path = path;
+        written_path += ".tmp";
+
+        try {
+            FileDescriptor file(written_path, O_WRONLY | O_CREAT | O_TRUNC);
+            WriteSnapshot<value_type>(file.get(), list.chunks(), list.size_m);
+            if (::fsync(file.get()) == -1) {
+                throw std::system_error{errno, std::generic_category(), "unrolled_list snapshot: fsync"};
+            }
+        } catch(...) {
+            std::error_code error;
+            std::filesystem::remove(written_path, error);
+            throw;
+        }
+
+        std::filesystem::rename(written_path, path);
+        SyncParentDirectory(path);
+    };
+
+
+    template<typename ListType>
+    static void Load(ListType& list, const std::filesystem::path& path) {
+        using value_type = typename ListType::value_type;
+
+        FileDescriptor file(path, O_RDONLY);
+        SnapshotHeader header = ReadSnapshotHeader<value_type>(file);
+
+        ListType loaded(list.alloc_m);
+        loaded.data_alloc_m = list.data_alloc_m;
+        ReadChuncks(loaded, file.get(), header.element_count_m);
+
+        list.clear();
+        std::swap(list.begin_chunck_ptr_m, loaded.begin_chunck_ptr_m);
+        std::swap(list.end_chunck_ptr_m, loaded.end_chunck_ptr_m);
+        std::swap(list.size_m, loaded.size_m);
+    };
+
+
+    template<typename ListType>
+    static typename ListType::size_type AppendFromFd(ListType& list, int fd, typename ListType::size_type max_count) {
+        using value_type = typename ListType::value_type;
+        using size_type = typename ListType::size_type;
+        constexpr size_type kChunckSize = ListType::node_t::size_value;
+
+        size_type appended = 0;
+
+        list.InsertChain(list.end(), [&](typename ListType::ChunckChain& chain) {
+            std::span<value_type> slots[kSnapshotIoBatch];
+            iovec buffers[kSnapshotIoBatch];
+            size_type batch_chuncks = 1;
+
+            while (appended != max_count) {
+                size_type batch_count = std::min<size_type>(max_count - appended, batch_chuncks * kChunckSize);
+                chain.Reserve(batch_count);
+
+                size_t buffer_count = chain.FreeSlots(slots, kSnapshotIoBatch, batch_count);
+                for (size_t ind = 0; ind != buffer_count; ++ind) {
+                    buffers[ind] = iovec{slots[ind].data(), slots[ind].size_bytes()};
+                }
+
+                size_t read_bytes = ReadAvailable(fd, buffers, buffer_count);
+                if (read_bytes % sizeof(value_type)) {
+                    throw std::runtime_error{"unrolled_list: the input ends in the middle of an element"};
+                }
+
+                chain.Commit(read_bytes / sizeof(value_type));
+                appended += read_bytes / sizeof(value_type);
+                if (read_bytes != batch_count * sizeof(value_type)) {
+                    break;
+                }
+                batch_chuncks = std::min<size_type>(2 * batch_chuncks, kSnapshotIoBatch);
+            }
+        });
+
+        return appended;
+    };
+
+
+    template<typename ListType>
+    static typename ListType::size_type AppendBinary(ListType& list, std::istream& input) {
+        using value_type = typename ListType::value_type;
+        using size_type = typename ListType::size_type;
+        constexpr size_type kChunckSize = ListType::node_t::size_value;
+
+        size_type appended = 0;
+
+        list.InsertChain(list.end(), [&](typename ListType::ChunckChain& chain) {
+            std::span<value_type> slots;
+            while (input && !input.eof()) {
+                chain.Reserve(kChunckSize);
+                chain.FreeSlots(&slots, 1, kChunckSize);
+
+                /* read sets failbit on every short read, a clean end on an element boundary keeps eofbit alone */
+                input.read(reinterpret_cast<char*>(slots.data()), static_cast<std::streamsize>(slots.size_bytes()));
+                size_t read_bytes = static_cast<size_t>(input.gcount());
+                if (read_bytes % sizeof(value_type)) {
+                    input.setstate(std::ios_base::failbit);
+                } else if (input.eof() && !input.bad()) {
+                    input.clear(std::ios_base::eofbit);
+                }
+
+                chain.Commit(read_bytes / sizeof(value_type));
+                appended += read_bytes / sizeof(value_type);
+            }
+        });
+
+        return appended;
+    };
+
+
+    template<typename ListType>
+    static typename ListType::size_type AppendText(ListType& list, std::istream& input) {
+        using value_type = typename ListType::value_type;
+        using size_type = typename ListType::size_type;
+
+        size_type appended = 0;
+
+        list.InsertChain(list.end(), [&](typename ListType::ChunckChain& chain) {
+            value_type value;
+            while (input >> value) {
+                chain.EmplaceBack(std::move(value));
+            }
+            appended = chain.Size();
+        });
+
+        return appended;
+    };
+
+
+  private:
+    /* Appends count elements read from fd into fresh chuncks filled to the brim, one readv per batch of chuncks */
+    template<typename ListType>
+    static void ReadChuncks(ListType& list, int fd, typename ListType::size_type count) {
+        using node_ptr_t = typename ListType::node_ptr_t;
+        using pointer = typename ListType::pointer;
+        using value_type = typename ListType::value_type;
+        constexpr typename ListType::size_type kChunckSize = ListType::node_t::size_value;
+
+        node_ptr_t batch[kSnapshotIoBatch];
+        iovec buffers[kSnapshotIoBatch];
+
+        while (count) {
+            size_t batch_size = 0;
+
+            try {
+                for (; batch_size != kSnapshotIoBatch && count; ++batch_size) {
+                    node_ptr_t added_chunck = list.AcquireChunck();
+                    added_chunck->size_m = std::min(count, kChunckSize);
+                    count -= added_chunck->size_m;
+
+                    batch[batch_size] = added_chunck;
+                    buffers[batch_size] = iovec{static_cast<pointer>(added_chunck->data_m), added_chunck->size_m * sizeof(value_type)};
+                }
+
+                ReadFull(fd, buffers, batch_size);
+            } catch(...) {
+                for (size_t ind = 0; ind != batch_size; ++ind) {
+                    list.ReleaseChunck(batch[ind]);
+                }
+                throw;
+            }
+
+            for (size_t ind = 0; ind != batch_size; ++ind) {
+                if (list.end_chunck_ptr_m) {
+                    list.end_chunck_ptr_m = ListType::chunck_traits::IncludeChunckBack(list.end_chunck_ptr_m, batch[ind]);
+                } else {
+                    list.begin_chunck_ptr_m = list.end_chunck_ptr_m = batch[ind];
+                }
+                list.size_m += batch[ind]->size_m;
+            }
+        }
+    };
+};
+
+} // namespace details
+
+
+/*
+    Writes list into path as a binary snapshot, see details/binary_snapshot.hpp.
+    The payloads are gathered straight from the chuncks, no element is copied on the way.
+    The snapshot is written and synced next to path, then renamed over it, so path keeps either
+    the previous snapshot or the whole new one. Throws std::system_error on an I/O error.
+*/
+template<typename DataType, size_t ChunckSize, typename AllocatorType, typename FillPolicyType,
+    typename ChunckExtensionType, size_t ChunckAlignment>
+requires std::is_trivially_copyable_v<DataType>
+void save(const unrolled_list<DataType, ChunckSize, AllocatorType, FillPolicyType, ChunckExtensionType, ChunckAlignment>& list,
+    const std::filesystem::path& path) {
+    details::ListIoAccess::Save(list, path);
+}
+
+
+/*
+    Replaces the elements of list with a snapshot written by save() of a list with any ChunckSize.
+    The elements are read straight into chuncks filled to the brim.
+    Throws std::system_error on an I/O error and std::runtime_error on a foreign or truncated file,
+    or one whose chunck table does not add up, the list is left untouched then.
+*/
+template<typename DataType, size_t ChunckSize, typename AllocatorType, typename FillPolicyType,
+    typename ChunckExtensionType, size_t ChunckAlignment>
+requires std::is_trivially_copyable_v<DataType>
+void load(unrolled_list<DataType, ChunckSize, AllocatorType, FillPolicyType, ChunckExtensionType, ChunckAlignment>& list,
+    const std::filesystem::path& path) {
+    details::ListIoAccess::Load(list, path);
+}
+
+
+/*
+    Appends the raw elements read from fd until its end or max_count of them, returns how many.
+    The bytes are read straight into the free slots of fresh chuncks, so pipes and sockets work as files do.
+    A readv fills a batch of chuncks which grows from one chunck to kSnapshotIoBatch while the reads fill it,
+    so the chuncks reserved ahead of the input are never more than the ones it has filled. Throws std::system_error on an I/O error and std::runtime_error
+    when the input ends in the middle of an element, the list is left untouched then.
+*/
+template<typename DataType, size_t ChunckSize, typename AllocatorType, typename FillPolicyType,
+    typename ChunckExtensionType, size_t ChunckAlignment>
+requires std::is_trivially_copyable_v<DataType>
+size_t append_from_fd(unrolled_list<DataType, ChunckSize, AllocatorType, FillPolicyType, ChunckExtensionType, ChunckAlignment>& list,
+    int fd, size_t max_count = std::numeric_limits<size_t>::max()) {
+    return details::ListIoAccess::AppendFromFd(list, fd, max_count);
+}
+
+
+/*
+    Appends the elements of input parsed with operator>> until the first failed extraction, returns how many.
+    Elements parsed before an exception are dropped.
+*/
+template<typename DataType, size_t ChunckSize, typename AllocatorType, typename FillPolicyType,
+    typename ChunckExtensionType, size_t ChunckAlignment>
+requires std::default_initializable<std::decay_t<DataType>>
+    && requires (std::istream& in, std::decay_t<DataType>& value) { in >> value; }
+size_t append_from(unrolled_list<DataType, ChunckSize, AllocatorType, FillPolicyType, ChunckExtensionType, ChunckAlignment>& list,
+    std::istream& input, stream_format::text_t = stream_format::text) {
+    return details::ListIoAccess::AppendText(list, input);
+}
+
+
+/*
+    Appends the raw elements of input read straight into the free slots of fresh chuncks, returns how many.
+    An input which ends on an element boundary is left with eofbit only. One which ends in the middle
+    of an element also gets failbit, the piece is dropped.
+*/
+template<typename DataType, size_t ChunckSize, typename AllocatorType, typename FillPolicyType,
+    typename ChunckExtensionType, size_t ChunckAlignment>
+requires std::is_trivially_copyable_v<DataType>
+size_t append_from(unrolled_list<DataType, ChunckSize, AllocatorType, FillPolicyType, ChunckExtensionType, ChunckAlignment>& list,
+    std::istream& input, stream_format::binary_t) {
+    return details::ListIoAccess::AppendBinary(list, input);
+}
+
+
+/* Writes the raw elements of list into fd, gathered straight from the chuncks, a writev per kSnapshotIoBatch chuncks */
+template<typename DataType, size_t ChunckSize, typename AllocatorType, typename FillPolicyType,
+    typename ChunckExtensionType, size_t ChunckAlignment>
+requires std::is_trivially_copyable_v<DataType>
+void write_to(const unrolled_list<DataType, ChunckSize, AllocatorType, FillPolicyType, ChunckExtensionType, ChunckAlignment>& list, int fd) {
+    details::WritePayloads<DataType>(fd, list.chunks());
+}
+
+} // namespace labwork7
+
+#endif // _UNROLLED_LIST_IO_HPP_
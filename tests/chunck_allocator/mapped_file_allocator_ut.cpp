@@ -0,0 +1,114 @@
+#include <mapped_file_allocator.hpp>
+#include <unrolled_list.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+/*
+    В данном файле проверяется MappedFileAllocator:
+        - unrolled_list хранит чанки в отображённом файле и работает как обычно
+        - файл растёт по мере вставок, освобождённые чанки переиспользуются
+        - блоки многих размеров освобождаются без выделения памяти под списки свободных блоков
+        - аллокатор без файла не выделяет память, копии и rebind делят один файл
+*/
+
+namespace {
+
+using labwork7::chunck_allocator::MappedFileAllocator;
+using labwork7::chunck_allocator::access_pattern;
+
+using mapped_list_t = labwork7::unrolled_list<uint64_t, 64, MappedFileAllocator<uint64_t>>;
+
+} // namespace
+
+
+TEST(MappedFileAllocator, keepsChuncksInTheFile) {
+    MappedFileAllocator<uint64_t> alloc(std::filesystem::temp_directory_path());
+    ASSERT_EQ(alloc.mapped_bytes(), 0);
+
+    mapped_list_t list(alloc);
+    std::vector<uint64_t> values(1'000'000);
+    std::iota(values.begin(), values.end(), 0);
+    for (uint64_t value : values) {
+        list.push_back(value);
+    }
+
+    ASSERT_TRUE(alloc.owns(&list.front()));
+    ASSERT_TRUE(alloc.owns(&list.back()));
+    ASSERT_FALSE(alloc.owns(values.data()));
+    ASSERT_GE(alloc.mapped_bytes(), values.size() * sizeof(uint64_t));
+
+    alloc.advise(access_pattern::random);
+    list.insert(list.begin(), 7);
+    list.erase(list.begin());
+    alloc.advise(access_pattern::sequential);
+
+    ASSERT_THAT(std::vector<uint64_t>(list.begin(), list.end()), ::testing::ElementsAreArray(values));
+}
+
+
+TEST(MappedFileAllocator, reusesFreedChuncks) {
+    MappedFileAllocator<uint64_t> alloc(std::filesystem::temp_directory_path());
+
+    {
+        mapped_list_t list(alloc);
+        for (uint64_t value = 0; value < 64 * 1000; ++value) {
+            list.push_back(value);
+        }
+    }
+    size_t mapped_bytes = alloc.mapped_bytes();
+
+    for (int round = 0; round < 10; ++round) {
+        mapped_list_t list(alloc);
+        for (uint64_t value = 0; value < 64 * 1000; ++value) {
+            list.push_back(value);
+        }
+        ASSERT_EQ(list.size(), 64 * 1000);
+    }
+    ASSERT_EQ(alloc.mapped_bytes(), mapped_bytes);
+}
+
+
+TEST(MappedFileAllocator, freesBlocksOfManySizes) {
+    MappedFileAllocator<char> alloc(std::filesystem::temp_directory_path());
+
+    /* more sizes than free lists: the blocks of the extra sizes are dropped, the others come back */
+    std::vector<char*> blocks;
+    for (size_t bytes = 64; bytes <= 64 * 40; bytes += 64) {
+        blocks.push_back(alloc.allocate(bytes));
+    }
+    for (size_t ind = 0; ind != blocks.size(); ++ind) {
+        alloc.deallocate(blocks[ind], (ind + 1) * 64);
+    }
+
+    ASSERT_EQ(alloc.allocate(64), blocks[0]);
+    ASSERT_EQ(alloc.allocate(64 * 16), blocks[15]);
+    ASSERT_TRUE(alloc.owns(alloc.allocate(64 * 40)));
+}
+
+
+TEST(MappedFileAllocator, sharesTheFileBetweenCopies) {
+    MappedFileAllocator<uint64_t> alloc(std::filesystem::temp_directory_path());
+    MappedFileAllocator<uint64_t> other(std::filesystem::temp_directory_path());
+    MappedFileAllocator<char> rebound(alloc);
+
+    ASSERT_TRUE(alloc == rebound);
+    ASSERT_FALSE(alloc == other);
+
+    char* block = rebound.allocate(100);
+    ASSERT_TRUE(alloc.owns(block));
+    ASSERT_FALSE(other.owns(block));
+    rebound.deallocate(block, 100);
+
+    MappedFileAllocator<uint64_t> empty;
+    ASSERT_THROW(empty.allocate(1), std::logic_error);
+    empty.deallocate(nullptr, 0);
+    ASSERT_FALSE(empty.owns(block));
+    ASSERT_THROW(MappedFileAllocator<uint64_t>("/nonexistent/directory"), std::system_error);
+}
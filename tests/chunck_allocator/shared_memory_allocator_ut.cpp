@@ -0,0 +1,162 @@
+#include <shared_memory_allocator.hpp>
+#include <unrolled_list.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+/*
+    В данном файле проверяется SharedMemoryAllocator:
+        - offset_ptr остаётся верным после копирования в другое место и при отображении по другому адресу
+        - unrolled_list с SharedMemoryAllocator работает как обычный список
+        - список в сегменте читается через второе отображение и из другого процесса
+*/
+
+namespace {
+
+using labwork7::chunck_allocator::offset_ptr;
+using labwork7::chunck_allocator::SharedMemoryAllocator;
+using labwork7::chunck_allocator::SharedMemorySegment;
+
+using shared_list_t = labwork7::unrolled_list<uint64_t, 16, SharedMemoryAllocator<uint64_t>>;
+
+constexpr size_t kSegmentBytes = size_t{16} << 20;
+
+
+std::string SegmentName(const std::string& name) {
+    return "/unrolled_list_" + name + "_" + std::to_string(::getpid());
+}
+
+
+template<typename ListType>
+std::vector<uint64_t> ToVector(const ListType& list) {
+    return std::vector<uint64_t>(list.begin(), list.end());
+}
+
+} // namespace
+
+
+TEST(SharedMemoryAllocator, offsetPtrSurvivesCopies) {
+    std::vector<int> values{1, 2, 3, 4, 5};
+
+    auto first = std::make_unique<offset_ptr<int>>(values.data());
+    auto second = std::make_unique<offset_ptr<int>>(*first);
+    first.reset();
+
+    ASSERT_EQ(second->get(), values.data());
+    ASSERT_EQ((*second)[4], 5);
+    ASSERT_EQ(*(*second + 2), 3);
+    ASSERT_EQ((*second + 5) - *second, 5);
+    ASSERT_TRUE(*second < *second + 1);
+
+    offset_ptr<const void> erased = *second;
+    ASSERT_EQ(static_cast<offset_ptr<const int>>(erased).get(), values.data());
+
+    offset_ptr<int> empty;
+    ASSERT_FALSE(empty);
+    ASSERT_TRUE(empty == nullptr);
+    ASSERT_EQ(empty.get(), nullptr);
+}
+
+
+TEST(SharedMemoryAllocator, listLivesInTheSegment) {
+    std::string name = SegmentName("list");
+    SharedMemorySegment::remove(name);
+    SharedMemorySegment segment(name, kSegmentBytes);
+
+    shared_list_t& list = segment.construct<shared_list_t>(segment.get_allocator<uint64_t>());
+    std::vector<uint64_t> std_vector;
+
+    for (uint64_t value = 0; value < 5000; ++value) {
+        list.push_back(value * 7 % 1000);
+        std_vector.push_back(value * 7 % 1000);
+    }
+    list.insert(list.nth(100), 50, 1);
+    std_vector.insert(std_vector.begin() + 100, 50, 1);
+    list.erase(list.nth(1000), list.nth(3000));
+    std_vector.erase(std_vector.begin() + 1000, std_vector.begin() + 3000);
+    list.sort();
+    std::sort(std_vector.begin(), std_vector.end());
+
+    std::byte* segment_begin = static_cast<std::byte*>(segment.data());
+    ASSERT_GE(reinterpret_cast<std::byte*>(&list.front()), segment_begin);
+    ASSERT_LT(reinterpret_cast<std::byte*>(&list.back()), segment_begin + segment.size());
+    ASSERT_THAT(ToVector(list), ::testing::ElementsAreArray(std_vector));
+
+    /* the same memory at another address */
+    SharedMemorySegment other_mapping(name);
+    ASSERT_NE(other_mapping.data(), segment.data());
+    shared_list_t* mapped_list = other_mapping.find<shared_list_t>();
+    ASSERT_NE(mapped_list, nullptr);
+    ASSERT_THAT(ToVector(*mapped_list), ::testing::ElementsAreArray(std_vector));
+
+    mapped_list->push_front(12345);
+    ASSERT_EQ(list.front(), 12345);
+    ASSERT_EQ(list.size(), std_vector.size() + 1);
+
+    list.clear();
+    SharedMemorySegment::remove(name);
+}
+
+
+TEST(SharedMemoryAllocator, listIsSharedBetweenProcesses) {
+    std::string name = SegmentName("fork");
+    SharedMemorySegment::remove(name);
+    SharedMemorySegment segment(name, kSegmentBytes);
+
+    shared_list_t& list = segment.construct<shared_list_t>(segment.get_allocator<uint64_t>());
+    std::vector<uint64_t> values(10'000);
+    std::iota(values.begin(), values.end(), 0);
+    for (uint64_t value : values) {
+        list.push_back(value);
+    }
+
+    pid_t child = ::fork();
+    ASSERT_NE(child, -1);
+    if (child == 0) {
+        /* the child maps the segment once more, so its list is at another address than in the parent */
+        SharedMemorySegment child_segment(name);
+        shared_list_t* child_list = child_segment.find<shared_list_t>();
+        uint64_t sum = std::accumulate(child_list->begin(), child_list->end(), uint64_t{0});
+        child_list->push_back(sum);
+        ::_exit(0);
+    }
+
+    int status = 0;
+    ASSERT_EQ(::waitpid(child, &status, 0), child);
+    ASSERT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+
+    values.push_back(std::accumulate(values.begin(), values.end(), uint64_t{0}));
+    ASSERT_THAT(ToVector(list), ::testing::ElementsAreArray(values));
+
+    SharedMemorySegment::remove(name);
+}
+
+
+TEST(SharedMemoryAllocator, rejectsMissingSegments) {
+    std::string name = SegmentName("missing");
+    SharedMemorySegment::remove(name);
+    ASSERT_THROW(SharedMemorySegment{name}, std::system_error);
+
+    SharedMemoryAllocator<uint64_t> empty;
+    ASSERT_THROW(empty.allocate(1), std::logic_error);
+    empty.deallocate(nullptr, 0);
+
+    SharedMemorySegment segment(name, 4096);
+    ASSERT_THROW(segment.get_allocator<uint64_t>().allocate(1024), std::bad_alloc);
+    ASSERT_THROW(SharedMemorySegment(name, 4096), std::system_error);
+    SharedMemorySegment::remove(name);
+
+    /* a segment which cannot be mapped leaves no object behind */
+    ASSERT_THROW(SharedMemorySegment(name, 0), std::system_error);
+    ASSERT_THROW(SharedMemorySegment{name}, std::system_error);
+}
@@ -108,3 +108,115 @@ TEST_F(WorkWithAllocatorTest, simplePushBack) {
     ASSERT_EQ(SomeObj::ConstructorCalled, 11);
     ASSERT_EQ(SomeObj::DestructorCalled, 11);
 }
+
+/*
+    В тесте задаётся NodeMaxSize = 5 и добавляется 12 элементов (ноды заполнены на 5, 5 и 2).
+
+    Ожидается, что:
+        1. erase и emplace в ноду, где есть место, не аллоцируют Node
+        2. emplace в заполненную ноду аллоцирует ровно одну Node под разбиение
+*/
+TEST_F(WorkWithAllocatorTest, insertEraseWithoutSplitDoNotAllocate) {
+    TestAllocator<SomeObj> allocator;
+    unrolled_list<SomeObj, 5, TestAllocator<SomeObj>> list(allocator);
+    for (int i = 0; i < 12; ++i) {
+        list.push_back(SomeObj{});
+    }
+    ASSERT_EQ(TestAllocator<NodeTag>::AllocationCount, 3);
+
+    list.erase(std::next(list.begin(), 2));
+    list.emplace(std::next(list.begin(), 3));
+    list.erase(std::next(list.begin(), 10));
+    ASSERT_EQ(TestAllocator<NodeTag>::AllocationCount, 3);
+
+    list.emplace(std::next(list.begin(), 7));
+    ASSERT_EQ(TestAllocator<NodeTag>::AllocationCount, 4);
+    ASSERT_EQ(list.size(), 12);
+}
+
+/*
+    В тесте задаётся NodeMaxSize = 5, список колеблется вокруг границы нод через push_back/pop_back
+    и push_front/pop_front.
+
+    Ожидается, что освобождённые ноды переиспользуются и аллокаций больше не происходит
+*/
+TEST_F(WorkWithAllocatorTest, spareChunckIsReused) {
+    TestAllocator<SomeObj> allocator;
+    unrolled_list<SomeObj, 5, TestAllocator<SomeObj>> list(allocator);
+    for (int i = 0; i < 5; ++i) {
+        list.push_back(SomeObj{});
+    }
+
+    for (int i = 0; i < 100; ++i) {
+        list.push_back(SomeObj{});
+        list.pop_back();
+        list.push_front(SomeObj{});
+        list.pop_front();
+    }
+
+    ASSERT_EQ(TestAllocator<NodeTag>::AllocationCount, 2);
+    ASSERT_EQ(list.size(), 5);
+}
+
+/*
+    В тесте задаётся NodeMaxSize = 5 и вызывается reserve(100).
+
+    Ожидается, что:
+        1. reserve выделит ноды сразу
+        2. push_back и push_front в пределах зарезервированного не аллоцируют
+        3. после clear ноды снова остаются в запасе
+*/
+TEST_F(WorkWithAllocatorTest, pushWithinReserveDoesNotAllocate) {
+    TestAllocator<SomeObj> allocator;
+    unrolled_list<SomeObj, 5, TestAllocator<SomeObj>> list(allocator);
+
+    list.reserve(100);
+    int reserved_allocations = TestAllocator<NodeTag>::AllocationCount;
+    ASSERT_GE(reserved_allocations, 20);
+
+    for (int i = 0; i < 50; ++i) {
+        list.push_back(SomeObj{});
+        list.push_front(SomeObj{});
+    }
+    ASSERT_EQ(TestAllocator<NodeTag>::AllocationCount, reserved_allocations);
+
+    list.clear();
+    for (int i = 0; i < 100; ++i) {
+        list.push_back(SomeObj{});
+    }
+    ASSERT_EQ(TestAllocator<NodeTag>::AllocationCount, reserved_allocations);
+    ASSERT_EQ(list.size(), 100);
+}
+
+/*
+    В тесте задаётся NodeMaxSize = 5, у списка резервируются ноды, затем он перемещается присваиванием.
+
+    Ожидается, что:
+        1. запас нод переходит вместе со списком, push_back в пределах зарезервированного не аллоцирует
+        2. список, из которого переместили, пуст и остаётся рабочим
+        3. копирующее присваивание тоже работает
+*/
+TEST_F(WorkWithAllocatorTest, moveAssignmentKeepsSpareChuncks) {
+    TestAllocator<SomeObj> allocator;
+    unrolled_list<SomeObj, 5, TestAllocator<SomeObj>> list(allocator);
+    unrolled_list<SomeObj, 5, TestAllocator<SomeObj>> other(allocator);
+    other.push_back(SomeObj{});
+
+    list.reserve(100);
+    int reserved_allocations = TestAllocator<NodeTag>::AllocationCount;
+
+    other = std::move(list);
+    ASSERT_TRUE(other.empty());
+    for (int i = 0; i < 100; ++i) {
+        other.push_back(SomeObj{});
+    }
+    ASSERT_EQ(TestAllocator<NodeTag>::AllocationCount, reserved_allocations);
+
+    ASSERT_TRUE(list.empty());
+    list.push_back(SomeObj{});
+    ASSERT_EQ(list.size(), 1);
+
+    list = other;
+    ASSERT_EQ(list.size(), 100);
+    ASSERT_EQ(other.size(), 100);
+}
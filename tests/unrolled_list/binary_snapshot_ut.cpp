@@ -0,0 +1,239 @@
+#include <unrolled_list.hpp>
+#include <unrolled_list_io.hpp>
+#include <mapped_unrolled_list.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "test_utils.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <span>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <unistd.h>
+
+/*
+    В данном файле проверяется бинарный снимок unrolled_list:
+        - save/load сохраняют элементы, в том числе между списками с разным ChunckSize
+        - mapped_unrolled_list читает элементы и чанки прямо из отображённого файла
+        - чужой, обрезанный или записанный для другого типа файл не загружается, список не меняется
+        - файл, у которого таблица чанков не сходится с числом элементов или длиной, не загружается
+        - save заменяет файл целиком и не оставляет временных файлов
+*/
+
+namespace {
+
+using namespace labwork7::test;
+
+
+struct Record {
+    int32_t id_m;
+    double weight_m;
+
+    bool operator==(const Record&) const = default;
+};
+
+
+/* Inserts and erases at random positions, so the chuncks are filled unevenly */
+template<typename ListType>
+void FillUnevenly(ListType& list, size_t count) {
+    std::mt19937 generator(21);
+    for (size_t ind = 0; ind != count; ++ind) {
+        list.insert(list.nth(generator() % (list.size() + 1)), ind);
+        if (ind % 3 == 0) {
+            list.erase(list.nth(generator() % list.size()));
+        }
+    }
+}
+
+} // namespace
+
+
+TEST(BinarySnapshot, roundTripsAcrossChunckSizes) {
+    std::filesystem::path path = TempPath("round_trip");
+
+    unrolled_list<uint64_t, 7> list;
+    FillUnevenly(list, 5000);
+    labwork7::save(list, path);
+
+    unrolled_list<uint64_t, 7> same_size{1, 2, 3};
+    labwork7::load(same_size, path);
+    ASSERT_EQ(same_size.size(), list.size());
+    ASSERT_THAT(ToVector(same_size), ::testing::ElementsAreArray(ToVector(list)));
+
+    /* the chuncks of a loaded list are filled to the brim */
+    unrolled_list<uint64_t, 64> other_size;
+    labwork7::load(other_size, path);
+    ASSERT_THAT(ToVector(other_size), ::testing::ElementsAreArray(ToVector(list)));
+    ASSERT_EQ(std::ranges::distance(other_size.chunks()), (list.size() + 63) / 64);
+
+    other_size.push_front(-1);
+    other_size.insert(other_size.nth(1000), -2);
+    ASSERT_EQ(other_size[1000], uint64_t(-2));
+
+    unrolled_list<uint64_t, 7> empty;
+    labwork7::save(empty, path);
+    labwork7::load(other_size, path);
+    ASSERT_TRUE(other_size.empty());
+    ASSERT_EQ(other_size.begin(), other_size.end());
+
+    std::filesystem::remove(path);
+}
+
+
+TEST(BinarySnapshot, mappedViewReadsInPlace) {
+    std::filesystem::path path = TempPath("mapped");
+
+    unrolled_list<Record, 5> list;
+    for (int32_t i = 0; i < 1000; ++i) {
+        list.push_back(Record{i, i * 0.5});
+    }
+    list.erase(list.nth(17));
+    list.insert(list.nth(500), Record{-1, -1.0});
+    labwork7::save(list, path);
+
+    mapped_unrolled_list<Record> mapped(path);
+    ASSERT_EQ(mapped.size(), list.size());
+    ASSERT_THAT(ToVector(mapped), ::testing::ElementsAreArray(ToVector(list)));
+    ASSERT_EQ(mapped[500], (Record{-1, -1.0}));
+    ASSERT_EQ(mapped.back(), (Record{999, 499.5}));
+    ASSERT_THROW(mapped.at(mapped.size()), std::out_of_range);
+
+    std::vector<size_t> chunck_sizes;
+    for (std::span<const Record> chunck : list.chunks()) {
+        chunck_sizes.push_back(chunck.size());
+    }
+
+    std::vector<size_t> mapped_chunck_sizes;
+    const Record* expected_begin = mapped.begin();
+    mapped.for_each_chunck([&](std::span<const Record> chunck) {
+        ASSERT_EQ(chunck.data(), expected_begin);
+        expected_begin += chunck.size();
+        mapped_chunck_sizes.push_back(chunck.size());
+    });
+    ASSERT_EQ(mapped.chunck_count(), chunck_sizes.size());
+    ASSERT_THAT(mapped_chunck_sizes, ::testing::ElementsAreArray(chunck_sizes));
+
+    mapped_unrolled_list<Record> moved(std::move(mapped));
+    ASSERT_TRUE(mapped.empty());
+    ASSERT_EQ(moved.front(), (Record{0, 0.0}));
+
+    std::filesystem::remove(path);
+}
+
+
+TEST(BinarySnapshot, rejectsForeignFiles) {
+    std::filesystem::path path = TempPath("foreign");
+    std::vector<uint64_t> expected{4, 5, 6};
+
+    unrolled_list<uint64_t, 4> list(expected.begin(), expected.end());
+    ASSERT_THROW(labwork7::load(list, TempPath("missing")), std::system_error);
+    ASSERT_THROW(mapped_unrolled_list<uint64_t>{TempPath("missing")}, std::system_error);
+
+    {
+        std::ofstream text(path);
+        text << "1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 17 18 19 20 21 22 23 24 25 26 27 28 29 30\n";
+    }
+    ASSERT_THROW(labwork7::load(list, path), std::runtime_error);
+    ASSERT_THROW(mapped_unrolled_list<uint64_t>{path}, std::runtime_error);
+
+    unrolled_list<uint32_t, 4> narrow{1, 2, 3};
+    labwork7::save(narrow, path);
+    ASSERT_THROW(labwork7::load(list, path), std::runtime_error);
+    ASSERT_THROW(mapped_unrolled_list<uint64_t>{path}, std::runtime_error);
+
+    unrolled_list<uint64_t, 4> wide;
+    for (uint64_t i = 0; i < 100; ++i) {
+        wide.push_back(i);
+    }
+    labwork7::save(wide, path);
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - sizeof(uint64_t));
+    ASSERT_THROW(labwork7::load(list, path), std::runtime_error);
+    ASSERT_THROW(mapped_unrolled_list<uint64_t>{path}, std::runtime_error);
+
+    ASSERT_THAT(ToVector(list), ::testing::ElementsAreArray(expected));
+
+    std::filesystem::remove(path);
+}
+
+
+TEST(BinarySnapshot, rejectsInconsistentChunckTable) {
+    std::filesystem::path path = TempPath("inconsistent");
+    std::vector<uint64_t> expected{4, 5, 6};
+    unrolled_list<uint64_t, 4> list(expected.begin(), expected.end());
+
+    unrolled_list<uint64_t, 4> saved;
+    for (uint64_t i = 0; i < 100; ++i) {
+        saved.push_back(i);
+    }
+
+    /* the first entry of the chunck table claims one element more */
+    labwork7::save(saved, path);
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        uint64_t entry;
+        file.seekg(sizeof(labwork7::details::SnapshotHeader));
+        file.read(reinterpret_cast<char*>(&entry), sizeof(entry));
+        ++entry;
+        file.seekp(sizeof(labwork7::details::SnapshotHeader));
+        file.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
+    }
+    ASSERT_THROW(labwork7::load(list, path), std::runtime_error);
+    ASSERT_THROW(mapped_unrolled_list<uint64_t>{path}, std::runtime_error);
+
+    /* bytes past the last element */
+    labwork7::save(saved, path);
+    {
+        std::ofstream file(path, std::ios::app | std::ios::binary);
+        file << "tail";
+    }
+    ASSERT_THROW(labwork7::load(list, path), std::runtime_error);
+    ASSERT_THROW(mapped_unrolled_list<uint64_t>{path}, std::runtime_error);
+
+    /* a whole element of padding past the last element */
+    labwork7::save(saved, path);
+    {
+        std::ofstream file(path, std::ios::app | std::ios::binary);
+        uint64_t padding = 0;
+        file.write(reinterpret_cast<const char*>(&padding), sizeof(padding));
+    }
+    ASSERT_THROW(labwork7::load(list, path), std::runtime_error);
+    ASSERT_THROW(mapped_unrolled_list<uint64_t>{path}, std::runtime_error);
+    ASSERT_THAT(ToVector(list), ::testing::ElementsAreArray(expected));
+
+    std::filesystem::remove(path);
+}
+
+
+TEST(BinarySnapshot, saveReplacesTheWholeFile) {
+    std::filesystem::path path = TempPath("replaced");
+    std::filesystem::path written_path = path;
+    written_path += ".tmp";
+
+    unrolled_list<uint64_t, 8> large;
+    for (uint64_t i = 0; i < 1000; ++i) {
+        large.push_back(i);
+    }
+    labwork7::save(large, path);
+
+    unrolled_list<uint64_t, 8> small{7, 8, 9};
+    labwork7::save(small, path);
+    ASSERT_FALSE(std::filesystem::exists(written_path));
+
+    unrolled_list<uint64_t, 16> loaded;
+    labwork7::load(loaded, path);
+    ASSERT_THAT(ToVector(loaded), ::testing::ElementsAre(7, 8, 9));
+
+    /* a failed save leaves the previous snapshot in place */
+    ASSERT_THROW(labwork7::save(large, TempPath("missing_directory") / "snapshot"), std::system_error);
+    labwork7::load(loaded, path);
+    ASSERT_THAT(ToVector(loaded), ::testing::ElementsAre(7, 8, 9));
+
+    std::filesystem::remove(path);
+}
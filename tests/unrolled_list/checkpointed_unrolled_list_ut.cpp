@@ -0,0 +1,299 @@
+#include <checkpointed_unrolled_list.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "test_utils.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <numeric>
+#include <random>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+/*
+    В данном файле проверяется checkpointed_unrolled_list:
+        - recover восстанавливает состояние последнего checkpoint после любых изменений
+        - checkpoint пишет только изменённые чанки, а не весь список
+        - оборванная запись в конце журнала отбрасывается, журнал сжимается в одну запись
+        - запись с неверной контрольной суммой отбрасывается в конце журнала и не восстанавливается в середине
+        - чужой или начатый не с полного checkpoint журнал не восстанавливается
+*/
+
+namespace {
+
+using namespace labwork7::test;
+
+
+class AppendedLog {
+  public:
+    explicit AppendedLog(const std::filesystem::path& path)
+        : fd_m(::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644)) {  };
+
+    ~AppendedLog() { ::close(fd_m); };
+
+    int get() const { return fd_m; };
+
+  private:
+    int fd_m;
+};
+
+
+/* recover compacts the log it reads, so a copy is recovered to keep appending to the original */
+template<typename ListType>
+ListType RecoverCopy(const std::filesystem::path& path) {
+    std::filesystem::path copy_path = path;
+    copy_path += ".copy";
+    std::filesystem::copy_file(path, copy_path, std::filesystem::copy_options::overwrite_existing);
+
+    ListType recovered;
+    recovered.recover(copy_path);
+    std::filesystem::remove(copy_path);
+    return recovered;
+}
+
+} // namespace
+
+
+TEST(CheckpointedUnrolledList, recoversEveryCheckpoint) {
+    std::filesystem::path path = TempPath("checkpoint_random");
+    std::filesystem::remove(path);
+    AppendedLog log(path);
+
+    checkpointed_unrolled_list<uint32_t, 6> list;
+    std::vector<uint32_t> std_vector;
+    std::mt19937 generator(22);
+
+    for (uint32_t step = 0; step < 4000; ++step) {
+        size_t operation = generator() % 12;
+
+        if (operation < 4 || std_vector.empty()) {
+            size_t index = generator() % (std_vector.size() + 1);
+            list.insert_at(index, step);
+            std_vector.insert(std_vector.begin() + index, step);
+        } else if (operation < 7) {
+            size_t index = generator() % std_vector.size();
+            list.erase_at(index);
+            std_vector.erase(std_vector.begin() + index);
+        } else if (operation == 7) {
+            size_t index = generator() % std_vector.size();
+            list.set(index, step);
+            std_vector[index] = step;
+        } else if (operation == 8) {
+            list.push_back(step);
+            list.push_front(step + 1);
+            std_vector.push_back(step);
+            std_vector.insert(std_vector.begin(), step + 1);
+        } else if (operation == 9) {
+            list.pop_back();
+            std_vector.pop_back();
+            if (!std_vector.empty()) {
+                list.pop_front();
+                std_vector.erase(std_vector.begin());
+            }
+        } else if (operation == 10) {
+            size_t first = generator() % std_vector.size();
+            size_t last = first + generator() % std::min<size_t>(20, std_vector.size() - first + 1);
+            list.erase(list.nth(first), list.nth(last));
+            std_vector.erase(std_vector.begin() + first, std_vector.begin() + last);
+        } else {
+            size_t index = generator() % (std_vector.size() + 1);
+            list.insert(list.nth(index), 13, step);
+            std_vector.insert(std_vector.begin() + index, 13, step);
+        }
+
+        if (step == 2000) {
+            list.sort();
+            std::sort(std_vector.begin(), std_vector.end());
+        }
+
+        if (step % 97 == 0) {
+            list.checkpoint(log.get());
+        }
+        if (step % 485 == 0) {
+            auto recovered = RecoverCopy<checkpointed_unrolled_list<uint32_t, 6>>(path);
+            ASSERT_THAT(ToVector(recovered), ::testing::ElementsAreArray(std_vector));
+        }
+    }
+
+    list.checkpoint(log.get());
+    auto recovered = RecoverCopy<checkpointed_unrolled_list<uint32_t, 6>>(path);
+    ASSERT_EQ(recovered.size(), std_vector.size());
+    ASSERT_THAT(ToVector(recovered), ::testing::ElementsAreArray(std_vector));
+
+    std::filesystem::remove(path);
+}
+
+
+/*
+    В тесте после полного checkpoint большого списка меняются несколько элементов.
+
+    Ожидается, что следующий checkpoint пишет только их чанки, а журнал растёт на их размер.
+*/
+TEST(CheckpointedUnrolledList, checkpointScalesWithWrites) {
+    std::filesystem::path path = TempPath("checkpoint_scale");
+    std::filesystem::remove(path);
+    AppendedLog log(path);
+
+    std::vector<uint64_t> values(100'000);
+    std::iota(values.begin(), values.end(), 0);
+    checkpointed_unrolled_list<uint64_t, 64> list(values.begin(), values.end());
+
+    ASSERT_EQ(list.checkpoint(log.get()), (values.size() + 63) / 64);
+    ASSERT_EQ(list.checkpoint(log.get()), 0);
+    uintmax_t full_bytes = std::filesystem::file_size(path);
+
+    list.set(10, 1);
+    list.set(50'000, 2);
+    list.set(99'999, 3);
+    ASSERT_EQ(list.checkpoint(log.get()), 3);
+
+    /* a split or a merge dirties the chunck with its neighbours */
+    list.insert_at(70'000, 4);
+    list.erase_at(30'000);
+    ASSERT_LE(list.checkpoint(log.get()), 8);
+    ASSERT_LT(std::filesystem::file_size(path) - full_bytes, 20 * 64 * sizeof(uint64_t));
+
+    values[10] = 1;
+    values[50'000] = 2;
+    values[99'999] = 3;
+    values.insert(values.begin() + 70'000, 4);
+    values.erase(values.begin() + 30'000);
+
+    auto recovered = RecoverCopy<checkpointed_unrolled_list<uint64_t, 64>>(path);
+    ASSERT_THAT(ToVector(recovered), ::testing::ElementsAreArray(values));
+
+    std::filesystem::remove(path);
+}
+
+
+TEST(CheckpointedUnrolledList, recoverDropsTornTailAndCompacts) {
+    std::filesystem::path path = TempPath("checkpoint_torn");
+    std::filesystem::remove(path);
+
+    checkpointed_unrolled_list<int, 8> list{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    {
+        AppendedLog log(path);
+        list.checkpoint(log.get());
+        for (int i = 0; i < 50; ++i) {
+            list.set(i % 10, i);
+            list.push_back(i);
+            list.checkpoint(log.get());
+        }
+    }
+    std::vector<int> committed = ToVector(list);
+
+    {
+        AppendedLog log(path);
+        list.set(0, -1);
+        list.checkpoint(log.get());
+    }
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 3);
+    uintmax_t log_bytes = std::filesystem::file_size(path);
+
+    checkpointed_unrolled_list<int, 8> recovered;
+    recovered.recover(path);
+    ASSERT_THAT(ToVector(recovered), ::testing::ElementsAreArray(committed));
+    ASSERT_LT(std::filesystem::file_size(path), log_bytes);
+
+    /* checkpoints go on appending to the compacted log */
+    {
+        AppendedLog log(path);
+        recovered.push_front(100);
+        recovered.erase_at(5);
+        ASSERT_LE(recovered.checkpoint(log.get()), 4);
+    }
+    committed.insert(committed.begin(), 100);
+    committed.erase(committed.begin() + 5);
+
+    checkpointed_unrolled_list<int, 8> recovered_again;
+    recovered_again.recover(path);
+    ASSERT_THAT(ToVector(recovered_again), ::testing::ElementsAreArray(committed));
+
+    std::filesystem::remove(path);
+}
+
+
+/*
+    В тесте в журнале из трёх записей портится байт элементов: сначала в последней записи, затем в средней.
+
+    Ожидается, что испорченная последняя запись отбрасывается как оборванная,
+    а испорченная средняя запись делает журнал повреждённым.
+*/
+TEST(CheckpointedUnrolledList, checksumRejectsDamagedRecords) {
+    std::filesystem::path path = TempPath("checkpoint_checksum");
+    std::filesystem::remove(path);
+
+    checkpointed_unrolled_list<uint64_t, 8> list{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    uintmax_t record_ends[3];
+    std::vector<uint64_t> states[3];
+    {
+        AppendedLog log(path);
+        for (size_t ind = 0; ind != 3; ++ind) {
+            list.set(ind, 100 + ind);
+            list.checkpoint(log.get());
+            record_ends[ind] = std::filesystem::file_size(path);
+            states[ind] = ToVector(list);
+        }
+    }
+
+    /* the commit of a record is in place, its body is not */
+    auto damage_byte = [&](uintmax_t offset) {
+        int fd = ::open(path.c_str(), O_RDWR);
+        char byte;
+        ASSERT_EQ(::pread(fd, &byte, 1, offset), 1);
+        byte ^= 0x40;
+        ASSERT_EQ(::pwrite(fd, &byte, 1, offset), 1);
+        ::close(fd);
+    };
+
+    damage_byte(record_ends[2] - 40);
+    auto recovered = RecoverCopy<checkpointed_unrolled_list<uint64_t, 8>>(path);
+    ASSERT_THAT(ToVector(recovered), ::testing::ElementsAreArray(states[1]));
+
+    damage_byte(record_ends[1] - 40);
+    checkpointed_unrolled_list<uint64_t, 8> damaged{1, 2, 3};
+    ASSERT_THROW(damaged.recover(path), std::runtime_error);
+    ASSERT_THAT(ToVector(damaged), ::testing::ElementsAre(1, 2, 3));
+
+    std::filesystem::remove(path);
+}
+
+
+TEST(CheckpointedUnrolledList, rejectsForeignLogs) {
+    std::filesystem::path path = TempPath("checkpoint_foreign");
+    std::filesystem::remove(path);
+
+    checkpointed_unrolled_list<uint64_t, 8> list{1, 2, 3};
+    ASSERT_THROW(list.recover(TempPath("checkpoint_missing")), std::system_error);
+
+    {
+        AppendedLog log(path);
+        checkpointed_unrolled_list<uint32_t, 8> narrow{1, 2, 3};
+        narrow.checkpoint(log.get());
+    }
+    ASSERT_THROW(list.recover(path), std::runtime_error);
+
+    /* the log lacks its first, full checkpoint */
+    std::filesystem::remove(path);
+    {
+        checkpointed_unrolled_list<uint64_t, 8> other{4, 5, 6};
+        AppendedLog full_log(TempPath("checkpoint_skipped"));
+        other.checkpoint(full_log.get());
+        other.set(0, 7);
+
+        AppendedLog log(path);
+        other.checkpoint(log.get());
+    }
+    ASSERT_THROW(list.recover(path), std::runtime_error);
+    ASSERT_THAT(ToVector(list), ::testing::ElementsAre(1, 2, 3));
+
+    std::filesystem::remove(path);
+    std::filesystem::remove(TempPath("checkpoint_skipped"));
+}
@@ -0,0 +1,84 @@
+#include <unrolled_list.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+/*
+    В данном файле проверяется выбор размера ноды по бюджету в байтах:
+        - нода укладывается в бюджет и выровнена по кеш-линии или странице
+        - количество элементов в ноде зависит от размера элемента
+        - список с таким размером ноды работает как обычный
+*/
+
+namespace {
+
+struct BigValue {
+    char payload[200] = {};
+};
+
+
+template<typename ListType>
+struct ChunckOf;
+
+template<typename DataType, size_t kSize, typename AllocatorType, typename FillPolicyType, typename ExtensionType, size_t kAlignment>
+struct ChunckOf<labwork7::unrolled_list<DataType, kSize, AllocatorType, FillPolicyType, ExtensionType, kAlignment>> {
+    using type = labwork7::UnrolledListNodeChunck<DataType, kSize, ExtensionType, kAlignment>;
+};
+
+
+template<typename DataType, size_t kBytes>
+constexpr bool FitsBudget() {
+    using chunck_t = typename ChunckOf<unrolled_list_for_bytes<DataType, kBytes>>::type;
+    return sizeof(chunck_t) <= kBytes && alignof(chunck_t) == labwork7::chunck_byte_budget<DataType, kBytes>::alignment;
+}
+
+} // namespace
+
+
+static_assert(FitsBudget<char, 256>());
+static_assert(FitsBudget<int, 256>());
+static_assert(FitsBudget<double, 4096>());
+static_assert(FitsBudget<BigValue, 4096>());
+
+static_assert(labwork7::chunck_byte_budget<char, 256>::chunck_size == 232);
+static_assert(labwork7::chunck_byte_budget<int, 256>::chunck_size == 58);
+static_assert(labwork7::chunck_byte_budget<BigValue, 256>::chunck_size == 2);
+static_assert(labwork7::chunck_byte_budget<int, 4096>::alignment == labwork7::kPageSize);
+
+
+TEST(ChunckSizing, chuncksAreAligned) {
+    unrolled_list_for_bytes<int, 256> int_list;
+    unrolled_list_for_bytes<char, 4096> char_list;
+    for (int i = 0; i < 10000; ++i) {
+        int_list.push_back(i);
+        char_list.push_back(static_cast<char>(i));
+    }
+
+    for (auto itr = int_list.begin(); itr != int_list.end(); ++itr) {
+        ASSERT_EQ(reinterpret_cast<std::uintptr_t>(itr.segment()) % labwork7::kCacheLineSize, 0);
+    }
+    for (auto itr = char_list.begin(); itr != char_list.end(); ++itr) {
+        ASSERT_EQ(reinterpret_cast<std::uintptr_t>(itr.segment()) % labwork7::kPageSize, 0);
+    }
+}
+
+TEST(ChunckSizing, worksAsUsualList) {
+    unrolled_list_for_bytes<int, 128> unrolled_list;
+    std::vector<int> std_vector(500);
+    std::iota(std_vector.begin(), std_vector.end(), 0);
+
+    unrolled_list.insert(unrolled_list.end(), std_vector.begin(), std_vector.end());
+    unrolled_list.erase(unrolled_list.nth(100), unrolled_list.nth(300));
+    std_vector.erase(std_vector.begin() + 100, std_vector.begin() + 300);
+    unrolled_list.insert(unrolled_list.nth(50), -1);
+    std_vector.insert(std_vector.begin() + 50, -1);
+
+    ASSERT_THAT(unrolled_list, ::testing::ElementsAreArray(std_vector));
+
+    unrolled_list_for_bytes<int, 128> copy_list = unrolled_list;
+    ASSERT_EQ(copy_list, unrolled_list);
+}
@@ -0,0 +1,80 @@
+#include <unrolled_list.hpp>
+#include <indexed_unrolled_list.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <cstring>
+#include <ranges>
+#include <span>
+#include <vector>
+
+/*
+    В данном файле проверяется chunks():
+        - спаны по нодам покрывают все элементы в прямом и обратном порядке
+        - через спаны можно писать в элементы и копировать ноды целиком
+*/
+
+TEST(ChunckView, spansCoverAllElements) {
+    unrolled_list<int, 5> unrolled_list;
+    std::vector<int> std_vector;
+    for (int i = 0; i < 103; ++i) {
+        unrolled_list.push_back(i);
+        std_vector.push_back(i);
+    }
+    unrolled_list.erase(unrolled_list.nth(40));
+    std_vector.erase(std_vector.begin() + 40);
+
+    std::vector<int> forward_result;
+    size_t total_size = 0;
+    for (std::span<const int> chunck : std::as_const(unrolled_list).chunks()) {
+        ASSERT_FALSE(chunck.empty());
+        ASSERT_LE(chunck.size(), 5);
+        forward_result.insert(forward_result.end(), chunck.begin(), chunck.end());
+        total_size += chunck.size();
+    }
+    ASSERT_EQ(total_size, unrolled_list.size());
+    ASSERT_THAT(forward_result, ::testing::ElementsAreArray(std_vector));
+
+    std::vector<int> reverse_result;
+    for (std::span<int> chunck : unrolled_list.chunks() | std::views::reverse) {
+        reverse_result.insert(reverse_result.begin(), chunck.begin(), chunck.end());
+    }
+    ASSERT_THAT(reverse_result, ::testing::ElementsAreArray(std_vector));
+
+    auto chunck_range = unrolled_list.chunks();
+    ASSERT_EQ(std::ranges::distance(chunck_range.begin(), chunck_range.end()),
+        std::ranges::distance(chunck_range.rbegin(), chunck_range.rend()));
+}
+
+TEST(ChunckView, spansAreWritableAndCopyable) {
+    unrolled_list<int, 8> unrolled_list(1, 50);
+
+    for (std::span<int> chunck : unrolled_list.chunks()) {
+        for (int& value : chunck) {
+            value *= 3;
+        }
+    }
+    ASSERT_THAT(unrolled_list, ::testing::Each(3));
+
+    std::vector<int> raw_copy(unrolled_list.size());
+    size_t offset = 0;
+    for (std::span<const int> chunck : std::as_const(unrolled_list).chunks()) {
+        std::memcpy(raw_copy.data() + offset, chunck.data(), chunck.size_bytes());
+        offset += chunck.size();
+    }
+    ASSERT_THAT(raw_copy, ::testing::Each(3));
+}
+
+TEST(ChunckView, emptyAndIndexedLists) {
+    unrolled_list<int, 4> empty_list;
+    ASSERT_TRUE(empty_list.chunks().empty());
+    ASSERT_EQ(empty_list.chunks().rbegin(), empty_list.chunks().rend());
+
+    indexed_unrolled_list<int, 4> indexed_list{1, 2, 3, 4, 5, 6};
+    std::vector<int> result;
+    for (auto chunck : indexed_list.chunks()) {
+        result.insert(result.end(), chunck.begin(), chunck.end());
+    }
+    ASSERT_THAT(result, ::testing::ElementsAre(1, 2, 3, 4, 5, 6));
+}
@@ -0,0 +1,166 @@
+#include <unrolled_list.hpp>
+#include <indexed_unrolled_list.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+/*
+    В данном файле проверяется compact/shrink_to_fit/occupancy:
+        - после compact все ноды, кроме последней, заполнены полностью, порядок элементов не меняется
+        - occupancy считает долю занятых ячеек в выделенных нодах
+        - индекс indexed_unrolled_list остаётся корректным после compact
+        - элементы, перемещение которых может бросить исключение, копируются ровно в столько нод, сколько нужно
+*/
+
+namespace {
+
+/* std::string, перемещение которой может бросить исключение: compact копирует такие элементы в новые ноды */
+struct ThrowingMoveString {
+    ThrowingMoveString(std::string value)
+        : Value(std::move(value)) {}
+
+    ThrowingMoveString(const ThrowingMoveString&) = default;
+
+    ThrowingMoveString(ThrowingMoveString&& other) noexcept(false)
+        : Value(std::move(other.Value)) {}
+
+    ThrowingMoveString& operator=(const ThrowingMoveString&) = default;
+    ThrowingMoveString& operator=(ThrowingMoveString&&) = default;
+
+    bool operator==(const ThrowingMoveString&) const = default;
+
+    std::string Value;
+};
+
+
+struct AllocationCounter {
+    static inline int Count = 0;
+};
+
+template<typename DataType>
+struct CountingAllocator : std::allocator<DataType> {
+    template<typename AnotherDataType>
+    struct rebind {
+        using other = CountingAllocator<AnotherDataType>;
+    };
+
+    CountingAllocator() = default;
+
+    template<typename AnotherDataType>
+    CountingAllocator(const CountingAllocator<AnotherDataType>&) noexcept {  };
+
+    DataType* allocate(size_t n) {
+        ++AllocationCounter::Count;
+        return std::allocator<DataType>::allocate(n);
+    }
+};
+
+template<typename ListType>
+void EraseEveryOther(ListType& list, std::vector<std::string>& std_vector, std::mt19937& generator) {
+    for (size_t step = 0; step < std_vector.size() / 2; ++step) {
+        size_t index = generator() % std_vector.size();
+        list.erase(list.nth(index));
+        std_vector.erase(std_vector.begin() + index);
+    }
+}
+
+} // namespace
+
+
+TEST(Compact, repacksIntoFullChuncks) {
+    unrolled_list<std::string, 8> unrolled_list;
+    std::vector<std::string> std_vector;
+    std::mt19937 generator(5);
+
+    for (int i = 0; i < 2000; ++i) {
+        std::string value = "value_" + std::to_string(i) + "_which_does_not_fit_into_sso";
+        unrolled_list.insert(unrolled_list.nth(generator() % (unrolled_list.size() + 1)), value);
+    }
+    std_vector.assign(unrolled_list.begin(), unrolled_list.end());
+    EraseEveryOther(unrolled_list, std_vector, generator);
+
+    ASSERT_LT(unrolled_list.occupancy(), 0.9);
+
+    unrolled_list.compact();
+
+    ASSERT_THAT(unrolled_list, ::testing::ElementsAreArray(std_vector));
+    ASSERT_EQ(std::ranges::distance(unrolled_list.chunks()), (std_vector.size() + 7) / 8);
+    for (auto chunck : unrolled_list.chunks() | std::views::take((std_vector.size() - 1) / 8)) {
+        ASSERT_EQ(chunck.size(), 8);
+    }
+    ASSERT_GT(unrolled_list.occupancy(), 0.99);
+
+    unrolled_list.push_back("tail");
+    unrolled_list.insert(unrolled_list.nth(3), "middle");
+    ASSERT_EQ(unrolled_list[3], "middle");
+    ASSERT_EQ(unrolled_list.back(), "tail");
+}
+
+TEST(Compact, copiesThrowingMoveTypeIntoReservedChuncks) {
+    using unrolled_list_type = unrolled_list<ThrowingMoveString, 8, CountingAllocator<ThrowingMoveString>>;
+
+    AllocationCounter::Count = 0;
+    {
+        unrolled_list_type single_chunck;
+        single_chunck.push_back(ThrowingMoveString{"value"});
+    }
+    int chunck_allocations = AllocationCounter::Count;
+
+    unrolled_list_type unrolled_list;
+    std::vector<ThrowingMoveString> std_vector;
+    std::mt19937 generator(7);
+    for (int i = 0; i < 1000; ++i) {
+        ThrowingMoveString value{"value_" + std::to_string(i) + "_which_does_not_fit_into_sso"};
+        size_t index = generator() % (std_vector.size() + 1);
+        unrolled_list.insert(unrolled_list.nth(index), value);
+        std_vector.insert(std_vector.begin() + index, value);
+    }
+    ASSERT_LT(unrolled_list.occupancy(), 0.9);
+
+    AllocationCounter::Count = 0;
+    unrolled_list.compact();
+
+    size_t chunck_count = (std_vector.size() + 7) / 8;
+    ASSERT_EQ(AllocationCounter::Count, static_cast<int>(chunck_count) * chunck_allocations);
+    ASSERT_EQ(std::ranges::distance(unrolled_list.chunks()), chunck_count);
+    ASSERT_THAT(unrolled_list, ::testing::ElementsAreArray(std_vector));
+}
+
+TEST(Compact, emptyAndSingleChunck) {
+    unrolled_list<int, 4> unrolled_list;
+    unrolled_list.shrink_to_fit();
+    ASSERT_TRUE(unrolled_list.empty());
+    ASSERT_EQ(unrolled_list.occupancy(), 1.0);
+
+    unrolled_list.push_back(1);
+    unrolled_list.push_back(2);
+    unrolled_list.shrink_to_fit();
+    ASSERT_THAT(unrolled_list, ::testing::ElementsAre(1, 2));
+    ASSERT_EQ(unrolled_list.occupancy(), 0.5);
+}
+
+TEST(Compact, keepsIndex) {
+    indexed_unrolled_list<std::string, 6> indexed_list;
+    std::vector<std::string> std_vector;
+    std::mt19937 generator(9);
+
+    for (int i = 0; i < 600; ++i) {
+        std::string value = "value_" + std::to_string(i) + "_which_does_not_fit_into_sso";
+        indexed_list.push_back(value);
+        std_vector.push_back(value);
+    }
+    EraseEveryOther(indexed_list, std_vector, generator);
+
+    indexed_list.compact();
+
+    ASSERT_GT(indexed_list.occupancy(), 0.99);
+    for (size_t ind = 0; ind < std_vector.size(); ++ind) {
+        ASSERT_EQ(indexed_list[ind], std_vector[ind]);
+        ASSERT_EQ(indexed_list.index_of(indexed_list.nth(ind)), ind);
+    }
+}
@@ -0,0 +1,221 @@
+#include <concurrent_unrolled_list.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "test_utils.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+    В данном файле проверяется concurrent_unrolled_list:
+        - в одном потоке insert/erase/update/get совпадают с std::vector
+        - параллельные update не теряют ни одного изменения
+        - параллельные insert/erase сохраняют размер и не дублируют элементы
+        - оптимистичные читатели не видят наполовину записанных элементов
+*/
+
+namespace {
+
+using namespace labwork7::test;
+
+
+struct Balance {
+    uint64_t left_m;
+    uint64_t right_m;
+};
+
+} // namespace
+
+
+TEST(ConcurrentUnrolledList, singleThreadMatchesVector) {
+    std::mt19937 generator(18);
+    concurrent_unrolled_list<int, 4> list;
+    concurrent_unrolled_list<std::string, 3> strings;
+    std::vector<int> std_vector;
+
+    ASSERT_FALSE(list.erase(0));
+    ASSERT_FALSE(list.insert(1, 5));
+    ASSERT_FALSE(list.get(0).has_value());
+
+    for (int step = 0; step < 5000; ++step) {
+        int operation = generator() % 5;
+        size_t index = generator() % (std_vector.size() + 1);
+        int value = generator() % 1000;
+
+        if (operation <= 1 || std_vector.empty()) {
+            ASSERT_TRUE(list.insert(index, value));
+            ASSERT_TRUE(strings.insert(index, std::to_string(value)));
+            std_vector.insert(std_vector.begin() + index, value);
+        } else if (operation == 2 && index < std_vector.size()) {
+            ASSERT_TRUE(list.erase(index));
+            ASSERT_TRUE(strings.erase(index));
+            std_vector.erase(std_vector.begin() + index);
+        } else if (operation == 3 && index < std_vector.size()) {
+            ASSERT_TRUE(list.update(index, [](int& element) { element += 7; }));
+            ASSERT_TRUE(strings.update(index, [](std::string& element) { element = std::to_string(std::stoi(element) + 7); }));
+            std_vector[index] += 7;
+        } else if (index < std_vector.size()) {
+            ASSERT_EQ(list.get(index), std_vector[index]);
+            ASSERT_EQ(strings.get(index), std::to_string(std_vector[index]));
+        } else {
+            list.push_back(value);
+            strings.push_back(std::to_string(value));
+            std_vector.push_back(value);
+        }
+
+        ASSERT_EQ(list.size(), std_vector.size());
+        ASSERT_FALSE(list.erase(std_vector.size()));
+    }
+
+    ASSERT_THAT(ToVector(list), ::testing::ElementsAreArray(std_vector));
+    for (size_t ind = 0; ind < std_vector.size(); ++ind) {
+        ASSERT_EQ(strings.get(ind), std::to_string(std_vector[ind]));
+    }
+
+    while (!std_vector.empty()) {
+        ASSERT_TRUE(list.erase(0));
+        std_vector.erase(std_vector.begin());
+    }
+    ASSERT_TRUE(list.empty());
+    list.push_front(3);
+    ASSERT_THAT(ToVector(list), ::testing::ElementsAre(3));
+}
+
+TEST(ConcurrentUnrolledList, concurrentUpdatesAreNotLost) {
+    constexpr int kThreads = 4;
+    constexpr int kUpdates = 20'000;
+    constexpr size_t kSize = 3000;
+
+    concurrent_unrolled_list<uint64_t, 16> list;
+    for (size_t ind = 0; ind < kSize; ++ind) {
+        list.push_back(0);
+    }
+
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < kThreads; ++thread) {
+        threads.emplace_back([&, thread] {
+            std::mt19937 generator(thread);
+            for (int ind = 0; ind < kUpdates; ++ind) {
+                ASSERT_TRUE(list.update(generator() % kSize, [](uint64_t& value) { ++value; }));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    uint64_t sum = 0;
+    list.for_each([&](uint64_t value) { sum += value; });
+    ASSERT_EQ(sum, kThreads * kUpdates);
+}
+
+/*
+    В тесте 4 потока вставляют уникальные значения и удаляют элементы в случайных позициях.
+
+    Ожидается, что итоговый размер равен начальному плюс вставки минус удачные удаления,
+    обход видит столько же элементов, и ни одно значение не встречается дважды.
+*/
+TEST(ConcurrentUnrolledList, concurrentInsertsAndErasesKeepElements) {
+    constexpr int kThreads = 4;
+    constexpr int kOperations = 5000;
+
+    concurrent_unrolled_list<int, 8> list;
+    for (int ind = 0; ind < 1000; ++ind) {
+        list.push_back(-1 - ind);
+    }
+
+    std::atomic<int> inserted = 0;
+    std::atomic<int> erased = 0;
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < kThreads; ++thread) {
+        threads.emplace_back([&, thread] {
+            std::mt19937 generator(100 + thread);
+            for (int ind = 0; ind < kOperations; ++ind) {
+                size_t index = generator() % (list.size() + 1);
+                if (generator() % 2) {
+                    if (list.insert(index, thread * kOperations + ind)) {
+                        ++inserted;
+                    }
+                } else if (list.erase(index)) {
+                    ++erased;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::vector<int> elements = ToVector(list);
+    ASSERT_EQ(list.size(), 1000 + inserted.load() - erased.load());
+    ASSERT_EQ(elements.size(), list.size());
+
+    std::sort(elements.begin(), elements.end());
+    ASSERT_EQ(std::adjacent_find(elements.begin(), elements.end()), elements.end());
+}
+
+/*
+    В тесте писатели переводят единицы между полями элементов под блокировкой ноды,
+    вставляют и удаляют элементы, а читатели без блокировок читают элементы по индексу.
+
+    Ожидается, что каждый прочитанный элемент сохраняет сумму полей.
+*/
+TEST(ConcurrentUnrolledList, optimisticReadersSeeWholeElements) {
+    constexpr uint64_t kTotal = 1'000'000;
+
+    concurrent_unrolled_list<Balance, 8> list;
+    for (int ind = 0; ind < 2000; ++ind) {
+        list.push_back(Balance{kTotal, 0});
+    }
+
+    std::atomic<bool> is_stopped = false;
+    std::atomic<int> torn_reads = 0;
+    std::atomic<int> reads = 0;
+
+    std::vector<std::thread> threads;
+    for (int writer = 0; writer < 2; ++writer) {
+        threads.emplace_back([&, writer] {
+            std::mt19937 generator(200 + writer);
+            for (int ind = 0; ind < 20'000; ++ind) {
+                size_t index = generator() % list.size();
+                list.update(index, [&](Balance& value) {
+                    uint64_t moved = value.left_m > 0 ? generator() % (value.left_m + 1) : 0;
+                    value.left_m -= moved;
+                    value.right_m += moved;
+                });
+                if (ind % 8 == 0) {
+                    list.insert(index, Balance{kTotal / 2, kTotal / 2});
+                    list.erase(generator() % list.size());
+                }
+            }
+        });
+    }
+    for (int reader = 0; reader < 2; ++reader) {
+        threads.emplace_back([&, reader] {
+            std::mt19937 generator(300 + reader);
+            while (!is_stopped.load(std::memory_order_relaxed)) {
+                auto value = list.get(generator() % 2000);
+                if (value && value->left_m + value->right_m != kTotal) {
+                    ++torn_reads;
+                }
+                ++reads;
+            }
+        });
+    }
+
+    threads[0].join();
+    threads[1].join();
+    is_stopped = true;
+    threads[2].join();
+    threads[3].join();
+
+    ASSERT_GT(reads.load(), 0);
+    ASSERT_EQ(torn_reads.load(), 0);
+}
@@ -0,0 +1,154 @@
+#include <concurrent_unrolled_queue.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+    В данном файле проверяется concurrent_unrolled_queue:
+        - в одном потоке порядок совпадает с FIFO, в том числе через много нод
+        - под нагрузкой из нескольких производителей и потребителей каждый элемент
+          извлекается ровно один раз, а элементы одного производителя идут по порядку
+        - деструктор уничтожает не извлеченные элементы
+*/
+
+namespace {
+
+struct LiveCounter {
+    static inline std::atomic<int> Alive = 0;
+
+    LiveCounter(int value) : value_m(value) { ++Alive; };
+    LiveCounter(const LiveCounter& other) : value_m(other.value_m) { ++Alive; };
+    LiveCounter(LiveCounter&& other) noexcept : value_m(other.value_m) { ++Alive; };
+    LiveCounter& operator=(const LiveCounter&) = default;
+    LiveCounter& operator=(LiveCounter&&) noexcept = default;
+    ~LiveCounter() { --Alive; };
+
+    int value_m;
+};
+
+} // namespace
+
+
+TEST(ConcurrentUnrolledQueue, singleThreadIsFifo) {
+    concurrent_unrolled_queue<std::string, 4> queue;
+    std::string value;
+
+    ASSERT_TRUE(queue.empty());
+    ASSERT_FALSE(queue.try_pop(value));
+
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 0; i < 1000; ++i) {
+            queue.push("value_" + std::to_string(i) + "_which_does_not_fit_into_sso");
+        }
+        ASSERT_FALSE(queue.empty());
+
+        for (int i = 0; i < 1000; ++i) {
+            ASSERT_TRUE(queue.try_pop(value));
+            ASSERT_EQ(value, "value_" + std::to_string(i) + "_which_does_not_fit_into_sso");
+        }
+        ASSERT_FALSE(queue.try_pop(value));
+        ASSERT_TRUE(queue.empty());
+    }
+
+    concurrent_unrolled_queue<std::unique_ptr<int>, 1> single_slot_queue;
+    single_slot_queue.emplace(new int(5));
+    single_slot_queue.push(std::make_unique<int>(6));
+
+    std::unique_ptr<int> pointer;
+    ASSERT_TRUE(single_slot_queue.try_pop(pointer));
+    ASSERT_EQ(*pointer, 5);
+    ASSERT_TRUE(single_slot_queue.try_pop(pointer));
+    ASSERT_EQ(*pointer, 6);
+    ASSERT_FALSE(single_slot_queue.try_pop(pointer));
+}
+
+/*
+    В тесте 4 производителя кладут по 100000 элементов (номер производителя, порядковый номер),
+    а 4 потребителя забирают их, пока не будут извлечены все элементы.
+
+    Ожидается, что каждый элемент извлечен ровно один раз, а каждый потребитель видит
+    элементы одного производителя в порядке возрастания.
+*/
+TEST(ConcurrentUnrolledQueue, manyProducersAndConsumers) {
+    constexpr int kProducers = 4;
+    constexpr int kConsumers = 4;
+    constexpr int kPerProducer = 100'000;
+
+    concurrent_unrolled_queue<uint64_t, 16> queue;
+    std::vector<std::atomic<uint8_t>> seen(kProducers * kPerProducer);
+    std::atomic<int> popped = 0;
+    std::atomic<bool> is_ordered = true;
+
+    std::vector<std::thread> threads;
+    for (int producer = 0; producer < kProducers; ++producer) {
+        threads.emplace_back([&, producer] {
+            for (uint64_t sequence = 0; sequence < kPerProducer; ++sequence) {
+                queue.push((static_cast<uint64_t>(producer) << 32) | sequence);
+            }
+        });
+    }
+    for (int consumer = 0; consumer < kConsumers; ++consumer) {
+        threads.emplace_back([&] {
+            std::vector<int64_t> last_sequence(kProducers, -1);
+            uint64_t value = 0;
+
+            while (popped.load(std::memory_order_relaxed) != kProducers * kPerProducer) {
+                if (!queue.try_pop(value)) {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                int producer = static_cast<int>(value >> 32);
+                int64_t sequence = static_cast<int64_t>(value & 0xffff'ffff);
+                if (sequence <= last_sequence[producer]) {
+                    is_ordered = false;
+                }
+                last_sequence[producer] = sequence;
+
+                seen[producer * kPerProducer + sequence].fetch_add(1, std::memory_order_relaxed);
+                popped.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_TRUE(is_ordered.load());
+    for (const auto& count : seen) {
+        ASSERT_EQ(count.load(), 1);
+    }
+    uint64_t value = 0;
+    ASSERT_FALSE(queue.try_pop(value));
+}
+
+TEST(ConcurrentUnrolledQueue, destructorDestroysLeftElements) {
+    {
+        concurrent_unrolled_queue<LiveCounter, 8> queue;
+        std::vector<std::thread> producers;
+        for (int producer = 0; producer < 3; ++producer) {
+            producers.emplace_back([&] {
+                for (int i = 0; i < 5000; ++i) {
+                    queue.emplace(i);
+                }
+            });
+        }
+        for (auto& thread : producers) {
+            thread.join();
+        }
+
+        LiveCounter value(0);
+        for (int i = 0; i < 7001; ++i) {
+            ASSERT_TRUE(queue.try_pop(value));
+        }
+        ASSERT_EQ(LiveCounter::Alive.load(), 15000 - 7001 + 1);
+    }
+    ASSERT_EQ(LiveCounter::Alive.load(), 0);
+}
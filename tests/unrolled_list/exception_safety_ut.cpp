@@ -3,7 +3,18 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include "test_utils.hpp"
+
+#include <algorithm>
+#include <iterator>
 #include <list>
+#include <new>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace labwork7::test;
 
 class NodeTag {};
 
@@ -185,3 +196,335 @@ TEST_F(ExceptionSafetyTest, failesAtPushBack) {
     ASSERT_EQ(unrolled_list.begin()->Name, std::string("first"));
     ASSERT_EQ((++unrolled_list.begin())->Name, std::string("second"));
 }
+
+/*
+    В тесте в середину unrolled_list вставляется диапазон из 5 инстансов SomeObjExSafe,
+    третье копирование выбрасывает исключение.
+
+    Тест проверяет:
+        1. insert выбросит исключение
+        2. Для двух успешно скопированных объектов будет вызван деструктор, сам список не изменится
+        3. Все ноды, выделенные под вставку, будут освобождены
+*/
+TEST_F(ExceptionSafetyTest, failesAtInsertRange) {
+    std::list<SomeObjExSafe> std_list;
+    for (int i = 0; i < 5; ++i) {
+        std_list.push_back(SomeObjExSafe{});
+    }
+
+    {
+        using unrolled_list_type = unrolled_list<SomeObjExSafe, 4, TestAllocator<SomeObjExSafe>>;
+        unrolled_list_type unrolled_list;
+        for (int i = 0; i < 10; ++i) {
+            unrolled_list.emplace_back();
+        }
+
+        SomeObjExSafe::DestructorCalled = 0;
+        ASSERT_ANY_THROW(unrolled_list.insert(std::next(unrolled_list.begin(), 5), std_list.begin(), std_list.end()));
+
+        ASSERT_EQ(SomeObjExSafe::DestructorCalled, 2);
+        ASSERT_EQ(unrolled_list.size(), 10);
+        ASSERT_EQ(std::distance(unrolled_list.begin(), unrolled_list.end()), 10);
+    }
+
+    ASSERT_EQ(TestAllocator<NodeTag>::AllocationCount, TestAllocator<NodeTag>::DeallocationCount);
+    ASSERT_EQ(TestAllocator<NodeTag>::ElementsAllocated, TestAllocator<NodeTag>::ElementsDeallocated);
+}
+
+/*
+    В тесте используются объекты классов BadOrGood, Good, Bad.
+    Элемент от Bad вставляется в середину заполненной ноды, то есть вставка требует разбиения ноды.
+
+    Тест проверяет:
+        1. emplace от Bad выбросит исключение
+        2. Список не изменится: элементы, перенесённые в новую ноду, вернутся обратно
+*/
+TEST_F(ExceptionSafetyTest, failesAtEmplaceIntoFullChunck) {
+    unrolled_list<BadOrGood, 4> unrolled_list;
+    for (int i = 0; i < 8; ++i) {
+        unrolled_list.push_back(Good{.Name = std::to_string(i)});
+    }
+
+    ASSERT_ANY_THROW(unrolled_list.emplace(std::next(unrolled_list.begin(), 5), Bad{}));
+
+    ASSERT_EQ(unrolled_list.size(), 8);
+    int expected = 0;
+    for (const auto& value : unrolled_list) {
+        ASSERT_EQ(value.Name, std::to_string(expected++));
+    }
+}
+
+/*
+    В тесте в середину заполненной ноды вставляется инстанс SomeObjExSafe,
+    конструктор перемещения которого может бросать, поэтому хвост ноды копируется.
+    Третье копирование выбрасывает исключение.
+
+    Тест проверяет:
+        1. emplace выбросит исключение
+        2. Для двух успешно скопированных объектов будет вызван деструктор, сам список не изменится
+        3. Нода, выделенная под вставку, будет освобождена
+*/
+TEST_F(ExceptionSafetyTest, failesAtEmplaceCopyingTail) {
+    {
+        using unrolled_list_type = unrolled_list<SomeObjExSafe, 4, TestAllocator<SomeObjExSafe>>;
+        unrolled_list_type unrolled_list;
+        for (int i = 0; i < 8; ++i) {
+            unrolled_list.emplace_back();
+        }
+
+        SomeObjExSafe value;
+        SomeObjExSafe::CopiesCount = 0;
+        SomeObjExSafe::DestructorCalled = 0;
+        ASSERT_ANY_THROW(unrolled_list.emplace(std::next(unrolled_list.begin(), 1), value));
+
+        ASSERT_EQ(SomeObjExSafe::DestructorCalled, 2);
+        ASSERT_EQ(unrolled_list.size(), 8);
+        ASSERT_EQ(std::distance(unrolled_list.begin(), unrolled_list.end()), 8);
+    }
+
+    ASSERT_EQ(TestAllocator<NodeTag>::AllocationCount, TestAllocator<NodeTag>::DeallocationCount);
+    ASSERT_EQ(TestAllocator<NodeTag>::ElementsAllocated, TestAllocator<NodeTag>::ElementsDeallocated);
+}
+
+
+/*
+    В тесте из списка инстансов SomeObjExSafe удаляется часть элементов, затем вызывается compact.
+    Конструктор перемещения SomeObjExSafe может бросать, поэтому compact копирует элементы в новые ноды.
+    Третье копирование выбрасывает исключение.
+
+    Тест проверяет:
+        1. compact выбросит исключение
+        2. Для двух успешно скопированных объектов будет вызван деструктор, сам список не изменится
+        3. Ноды, выделенные под копию, будут освобождены
+*/
+TEST_F(ExceptionSafetyTest, failesAtCompact) {
+    {
+        using unrolled_list_type = unrolled_list<SomeObjExSafe, 4, TestAllocator<SomeObjExSafe>>;
+        unrolled_list_type unrolled_list;
+        for (int i = 0; i < 12; ++i) {
+            unrolled_list.emplace_back();
+        }
+        /* erasing the last element of a chunck copies nothing */
+        unrolled_list.erase(std::next(unrolled_list.begin(), 3));
+        unrolled_list.erase(std::next(unrolled_list.begin(), 6));
+
+        SomeObjExSafe::CopiesCount = 0;
+        SomeObjExSafe::DestructorCalled = 0;
+        ASSERT_ANY_THROW(unrolled_list.compact());
+
+        ASSERT_EQ(SomeObjExSafe::DestructorCalled, 2);
+        ASSERT_EQ(unrolled_list.size(), 10);
+        ASSERT_EQ(std::distance(unrolled_list.begin(), unrolled_list.end()), 10);
+
+        SomeObjExSafe::CopiesCount = 3;
+        unrolled_list.compact();
+        ASSERT_EQ(unrolled_list.size(), 10);
+        ASSERT_EQ(std::ranges::distance(unrolled_list.chunks()), 3);
+    }
+
+    ASSERT_EQ(TestAllocator<NodeTag>::AllocationCount, TestAllocator<NodeTag>::DeallocationCount);
+    ASSERT_EQ(TestAllocator<NodeTag>::ElementsAllocated, TestAllocator<NodeTag>::ElementsDeallocated);
+}
+
+
+class RelocationThrowsAt {
+public:
+    static inline int RelocationsCount = 0;
+    static inline int ThrowAt = 0;
+    static inline int Alive = 0;
+
+    RelocationThrowsAt(int value)
+        : Value(value) {
+        ++Alive;
+    }
+
+    RelocationThrowsAt(const RelocationThrowsAt& other)
+        : Value(other.Value) {
+        if (++RelocationsCount == ThrowAt) {
+            throw std::runtime_error("");
+        }
+        ++Alive;
+    }
+
+    RelocationThrowsAt(RelocationThrowsAt&& other)
+        : Value(other.Value) {
+        if (++RelocationsCount == ThrowAt) {
+            throw std::runtime_error("");
+        }
+        ++Alive;
+    }
+
+    ~RelocationThrowsAt() {
+        --Alive;
+    }
+
+    int Value;
+};
+
+/*
+    В тесте из списка в 20 элементов с ChunckSize = 4 удаляется диапазон [3, 9).
+    Конструктор перемещения или копирования бросает исключение на N-ом вызове, N перебирается.
+
+    Тест проверяет:
+        1. Если erase выбросил исключение, элементы диапазона удалены, остальные идут в прежнем порядке
+        2. Иначе из списка удалены ровно элементы диапазона
+        3. size() совпадает с числом элементов при обходе, ни один объект не уничтожен дважды и не потерян
+*/
+TEST_F(ExceptionSafetyTest, failesAtEraseRangeMove) {
+    std::vector<int> initial(20);
+    std::iota(initial.begin(), initial.end(), 0);
+    std::vector<int> erased = initial;
+    erased.erase(erased.begin() + 3, erased.begin() + 9);
+
+    for (int throw_at = 1; throw_at <= 8; ++throw_at) {
+        {
+            unrolled_list<RelocationThrowsAt, 4> unrolled_list;
+            for (int value : initial) {
+                unrolled_list.emplace_back(value);
+            }
+
+            RelocationThrowsAt::RelocationsCount = 0;
+            RelocationThrowsAt::ThrowAt = throw_at;
+
+            bool thrown = false;
+            try {
+                unrolled_list.erase(std::next(unrolled_list.begin(), 3), std::next(unrolled_list.begin(), 9));
+            } catch (const std::runtime_error&) {
+                thrown = true;
+            }
+            RelocationThrowsAt::ThrowAt = 0;
+
+            std::vector<int> values;
+            for (const RelocationThrowsAt& element : unrolled_list) {
+                values.push_back(element.Value);
+            }
+
+            if (thrown) {
+                ASSERT_TRUE(std::ranges::includes(erased, values));
+            } else {
+                ASSERT_EQ(values, erased);
+            }
+            ExpectChunckChain(unrolled_list);
+            ASSERT_EQ(unrolled_list.size(), values.size());
+            ASSERT_EQ(RelocationThrowsAt::Alive, static_cast<int>(values.size()));
+        }
+
+        ASSERT_EQ(RelocationThrowsAt::Alive, 0);
+    }
+}
+
+/*
+    В тесте из списка в 16000 элементов, перемещение которых может бросить исключение, удаляется каждый второй.
+
+    Тест проверяет, что erase не оставляет почти пустых нод: соседние ноды сливаются и занимают элементы друг у друга,
+    как и для элементов, перемещение которых не бросает исключений
+*/
+TEST_F(ExceptionSafetyTest, eraseKeepsOccupancyOfThrowingMoveType) {
+    {
+        unrolled_list<RelocationThrowsAt, 16> unrolled_list;
+        for (int i = 0; i < 16000; ++i) {
+            unrolled_list.emplace_back(i);
+        }
+
+        for (auto itr = unrolled_list.begin(); itr != unrolled_list.end(); ++itr) {
+            itr = unrolled_list.erase(itr);
+        }
+
+        ASSERT_EQ(unrolled_list.size(), 8000);
+        ASSERT_EQ(RelocationThrowsAt::Alive, 8000);
+        ASSERT_GE(unrolled_list.occupancy(), 0.5);
+        ExpectChunckChain(unrolled_list);
+    }
+
+    ASSERT_EQ(RelocationThrowsAt::Alive, 0);
+}
+
+
+struct FailingBudget {
+    static inline int Left = -1;
+    static inline int Allocations = 0;
+};
+
+template<typename T>
+class FailingAllocator {
+public:
+    using value_type = T;
+    using is_always_equal = std::true_type;
+
+    FailingAllocator() = default;
+
+    template<typename U>
+    FailingAllocator(const FailingAllocator<U>&) noexcept {
+    }
+
+    T* allocate(size_t n) {
+        if (FailingBudget::Left == 0) {
+            throw std::bad_alloc();
+        }
+        if (FailingBudget::Left > 0) {
+            --FailingBudget::Left;
+        }
+        ++FailingBudget::Allocations;
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, size_t n) noexcept {
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    template<typename U>
+    bool operator==(const FailingAllocator<U>&) const noexcept {
+        return true;
+    }
+};
+
+/*
+    В тесте в середину заполненной ноды из 4 строк вставляются 3 строки через input итератор.
+    Новых нод хватает на вставляемые строки, но не на перенос хвоста ноды.
+
+    Тест проверяет:
+        1. insert выбросит std::bad_alloc
+        2. Список не изменится: ни одна строка хвоста не останется перемещённой
+*/
+TEST_F(ExceptionSafetyTest, failesAtInsertAllocatingTail) {
+    std::vector<std::string> initial{"aaaa", "bbbb", "cccc", "dddd"};
+    unrolled_list<std::string, 4, FailingAllocator<std::string>> unrolled_list(initial.begin(), initial.end());
+
+    std::istringstream input("xxxx yyyy zzzz");
+    FailingBudget::Left = 1;
+    ASSERT_THROW(unrolled_list.insert(std::next(unrolled_list.begin(), 2),
+        std::istream_iterator<std::string>(input), std::istream_iterator<std::string>()), std::bad_alloc);
+    FailingBudget::Left = -1;
+
+    ASSERT_THAT(std::vector<std::string>(unrolled_list.begin(), unrolled_list.end()), ::testing::ElementsAreArray(initial));
+}
+
+/*
+    Тест проверяет, что вставка с заранее известным числом элементов выделяет ровно те ноды,
+    в которые они помещаются, столько же, сколько и поэлементная вставка
+*/
+TEST_F(ExceptionSafetyTest, reservedInsertAllocatesOnlyReservedChuncks) {
+    using unrolled_list_type = unrolled_list<std::string, 4, FailingAllocator<std::string>>;
+
+    FailingBudget::Allocations = 0;
+    {
+        unrolled_list_type unrolled_list;
+        unrolled_list.push_back("aaaa");
+    }
+    int chunck_allocations = FailingBudget::Allocations;
+
+    std::vector<std::string> inserted(8, "bbbb");
+    FailingBudget::Allocations = 0;
+    {
+        unrolled_list_type unrolled_list;
+        unrolled_list.insert(unrolled_list.end(), inserted.begin(), inserted.end());
+    }
+    ASSERT_EQ(FailingBudget::Allocations, 2 * chunck_allocations);
+
+    FailingBudget::Allocations = 0;
+    {
+        unrolled_list_type unrolled_list;
+        unrolled_list.insert(unrolled_list.end(), 8, std::string("cccc"));
+    }
+    ASSERT_EQ(FailingBudget::Allocations, 2 * chunck_allocations);
+}
@@ -0,0 +1,127 @@
+#include <unrolled_list.hpp>
+#include <indexed_unrolled_list.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+/*
+    В данном файле проверяются политики заполнения нод:
+        - список с каждой из политик совпадает с std::vector после случайных вставок и удалений
+        - чередование вставки и удаления на границе нод не приводит к постоянным разбиениям и слияниям
+        - последовательные вставки в середину оставляют ноды заполненными
+*/
+
+namespace {
+
+struct ChunckCounter {
+    static inline int Allocated = 0;
+    static inline int Deallocated = 0;
+};
+
+
+template<typename T>
+class CountingAllocator {
+public:
+    using value_type = T;
+    using is_always_equal = std::true_type;
+
+    CountingAllocator() = default;
+
+    template<typename U>
+    CountingAllocator(const CountingAllocator<U>&) {
+    }
+
+    T* allocate(size_t count) {
+        ++ChunckCounter::Allocated;
+        return std::allocator<T>{}.allocate(count);
+    }
+
+    void deallocate(T* ptr, size_t count) {
+        ++ChunckCounter::Deallocated;
+        std::allocator<T>{}.deallocate(ptr, count);
+    }
+
+    template<typename U>
+    bool operator==(const CountingAllocator<U>&) const {
+        return true;
+    }
+};
+
+
+template<typename ListType>
+void RandomInsertErase(ListType& list, unsigned seed) {
+    std::vector<std::string> std_vector;
+    std::mt19937 generator(seed);
+
+    for (int step = 0; step < 2000; ++step) {
+        if (std_vector.empty() || generator() % 5 < 3) {
+            size_t index = generator() % (std_vector.size() + 1);
+            std::string value = "value_" + std::to_string(step) + "_which_does_not_fit_into_sso";
+
+            list.insert(list.nth(index), value);
+            std_vector.insert(std_vector.begin() + index, value);
+        } else {
+            size_t index = generator() % std_vector.size();
+
+            auto result_itr = list.erase(list.nth(index));
+            std_vector.erase(std_vector.begin() + index);
+
+            ASSERT_TRUE(result_itr == list.nth(index));
+        }
+    }
+
+    ASSERT_THAT(list, ::testing::ElementsAreArray(std_vector));
+    for (auto chunck : list.chunks()) {
+        ASSERT_FALSE(chunck.empty());
+    }
+}
+
+} // namespace
+
+
+TEST(FillPolicy, everyPresetMatchesVector) {
+    labwork7::unrolled_list<std::string, 8, std::allocator<std::string>, labwork7::fill_policy::dense> dense_list;
+    labwork7::unrolled_list<std::string, 8, std::allocator<std::string>, labwork7::fill_policy::balanced> balanced_list;
+    labwork7::unrolled_list<std::string, 8, std::allocator<std::string>, labwork7::fill_policy::write_heavy> write_heavy_list;
+    labwork7::indexed_unrolled_list<std::string, 5, std::allocator<std::string>, labwork7::fill_policy::dense> indexed_list;
+
+    RandomInsertErase(dense_list, 1);
+    RandomInsertErase(balanced_list, 2);
+    RandomInsertErase(write_heavy_list, 3);
+    RandomInsertErase(indexed_list, 4);
+}
+
+TEST(FillPolicy, boundaryInsertEraseDoesNotThrash) {
+    labwork7::unrolled_list<int, 16, CountingAllocator<int>, labwork7::fill_policy::balanced> unrolled_list(1, 160);
+
+    ChunckCounter::Allocated = ChunckCounter::Deallocated = 0;
+    for (int i = 0; i < 1000; ++i) {
+        auto pos_itr = unrolled_list.emplace(unrolled_list.nth(80), 7);
+        unrolled_list.erase(pos_itr);
+    }
+
+    ASSERT_LE(ChunckCounter::Allocated, 1);
+    ASSERT_EQ(ChunckCounter::Deallocated, 0);
+    ASSERT_EQ(unrolled_list.size(), 160);
+}
+
+TEST(FillPolicy, sequentialInsertsKeepChuncksFull) {
+    unrolled_list<int, 8> unrolled_list(0, 64);
+
+    auto pos_itr = unrolled_list.nth(20);
+    for (int i = 0; i < 800; ++i) {
+        pos_itr = ++unrolled_list.emplace(pos_itr, i + 1);
+    }
+
+    ASSERT_EQ(unrolled_list.size(), 864);
+    ASSERT_EQ(unrolled_list[20], 1);
+    ASSERT_EQ(unrolled_list[819], 800);
+
+    size_t chunck_count = std::ranges::distance(unrolled_list.chunks());
+    ASSERT_LE(chunck_count, unrolled_list.size() / 8 + 2);
+}
@@ -0,0 +1,132 @@
+#include <indexed_unrolled_list.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+/*
+    В данном файле проверяется indexed_unrolled_list:
+        - insert_at/erase_at/nth/index_of совпадают с std::vector
+        - индекс остаётся корректным после разбиения, слияния и заимствования между нодами
+*/
+
+TEST(IndexedUnrolledList, pushAndIndex) {
+    indexed_unrolled_list<int, 5> indexed_list;
+    std::vector<int> std_vector;
+
+    for (int i = 0; i < 1000; ++i) {
+        if (i % 3 == 0) {
+            indexed_list.push_front(i);
+            std_vector.insert(std_vector.begin(), i);
+        } else {
+            indexed_list.push_back(i);
+            std_vector.push_back(i);
+        }
+    }
+
+    ASSERT_THAT(indexed_list, ::testing::ElementsAreArray(std_vector));
+    for (size_t ind = 0; ind < std_vector.size(); ++ind) {
+        ASSERT_EQ(indexed_list[ind], std_vector[ind]);
+        ASSERT_EQ(indexed_list.index_of(indexed_list.nth(ind)), ind);
+    }
+    ASSERT_EQ(indexed_list.index_of(indexed_list.end()), indexed_list.size());
+}
+
+TEST(IndexedUnrolledList, randomInsertEraseByIndex) {
+    indexed_unrolled_list<std::string, 4> indexed_list;
+    std::vector<std::string> std_vector;
+    std::mt19937 generator(7);
+
+    for (int step = 0; step < 3000; ++step) {
+        if (std_vector.empty() || generator() % 3 != 0) {
+            size_t index = generator() % (std_vector.size() + 1);
+            std::string value = "value_" + std::to_string(step) + "_which_does_not_fit_into_sso";
+
+            indexed_list.insert_at(index, value);
+            std_vector.insert(std_vector.begin() + index, value);
+        } else {
+            size_t index = generator() % std_vector.size();
+
+            auto result_itr = indexed_list.erase_at(index);
+            std_vector.erase(std_vector.begin() + index);
+
+            ASSERT_EQ(indexed_list.index_of(result_itr), index);
+        }
+
+        ASSERT_EQ(indexed_list.size(), std_vector.size());
+    }
+
+    ASSERT_THAT(indexed_list, ::testing::ElementsAreArray(std_vector));
+    for (size_t ind = 0; ind < std_vector.size(); ++ind) {
+        ASSERT_EQ(indexed_list.at(ind), std_vector[ind]);
+    }
+}
+
+TEST(IndexedUnrolledList, rangeEraseAndPop) {
+    indexed_unrolled_list<int, 6> indexed_list;
+    std::vector<int> std_vector;
+    for (int i = 0; i < 300; ++i) {
+        indexed_list.push_back(i);
+        std_vector.push_back(i);
+    }
+
+    indexed_list.erase(indexed_list.nth(20), indexed_list.nth(170));
+    std_vector.erase(std_vector.begin() + 20, std_vector.begin() + 170);
+
+    for (int i = 0; i < 40; ++i) {
+        indexed_list.pop_back();
+        indexed_list.pop_front();
+        std_vector.pop_back();
+        std_vector.erase(std_vector.begin());
+    }
+
+    ASSERT_THAT(indexed_list, ::testing::ElementsAreArray(std_vector));
+    for (size_t ind = 0; ind < std_vector.size(); ++ind) {
+        ASSERT_EQ(indexed_list[ind], std_vector[ind]);
+    }
+}
+
+TEST(IndexedUnrolledList, randomRangeErase) {
+    indexed_unrolled_list<int, 5> indexed_list;
+    std::vector<int> std_vector;
+    std::mt19937 generator(17);
+    for (int i = 0; i < 3000; ++i) {
+        indexed_list.push_back(i);
+        std_vector.push_back(i);
+    }
+
+    while (std_vector.size() > 10) {
+        size_t first = generator() % std_vector.size();
+        size_t last = first + generator() % std::min<size_t>(std_vector.size() - first, 400);
+
+        auto result_itr = indexed_list.erase(indexed_list.nth(first), indexed_list.nth(last));
+        std_vector.erase(std_vector.begin() + first, std_vector.begin() + last);
+        ASSERT_EQ(indexed_list.index_of(result_itr), first);
+
+        for (size_t ind = 0; ind < std_vector.size(); ind += 7) {
+            ASSERT_EQ(indexed_list[ind], std_vector[ind]);
+        }
+    }
+    ASSERT_THAT(indexed_list, ::testing::ElementsAreArray(std_vector));
+}
+
+TEST(IndexedUnrolledList, copyAndMoveKeepIndex) {
+    indexed_unrolled_list<int, 3> indexed_list{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+    indexed_unrolled_list<int, 3> copy_list = indexed_list;
+    ASSERT_EQ(copy_list, indexed_list);
+    ASSERT_EQ(copy_list[7], 8);
+
+    indexed_unrolled_list<int, 3> moved_list = std::move(copy_list);
+    ASSERT_EQ(moved_list[9], 10);
+    ASSERT_EQ(moved_list.index_of(moved_list.nth(4)), 4);
+
+    moved_list.clear();
+    ASSERT_TRUE(moved_list.empty());
+    moved_list.insert_at(0, 42);
+    ASSERT_EQ(moved_list[0], 42);
+}
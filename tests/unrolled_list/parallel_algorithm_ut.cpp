@@ -0,0 +1,178 @@
+#include <unrolled_list.hpp>
+#include <parallel_algorithm.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <cstdint>
+#include <execution>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/*
+    В данном файле проверяются алгоритмы с политиками исполнения:
+        - for_each, transform, reduce, count_if, find_if, all_of, any_of с std::execution::par
+          совпадают с последовательными алгоритмами над std::vector
+        - find_if возвращает первый подходящий элемент, а не любой
+        - исключение из задачи пула доходит до вызывающего потока
+        - задачи, не поместившиеся в очереди пула, выполняет вызывающий поток
+        - работ не больше kParallelTaskBlocks, соседние работы сливаются, покрывая весь диапазон
+*/
+
+class ParallelAlgorithmTest : public testing::Test {
+public:
+    void SetUp() override {
+        for (int i = 0; i < 200'000; ++i) {
+            unrolled_list.push_back(i % 1009);
+            std_vector.push_back(i % 1009);
+        }
+    }
+
+    ::unrolled_list<int, 64> unrolled_list;
+    std::vector<int> std_vector;
+};
+
+TEST_F(ParallelAlgorithmTest, forEachAndTransform) {
+    std::atomic<long long> sum = 0;
+    labwork7::for_each(std::execution::par, unrolled_list.begin(), unrolled_list.end(), [&](int value) {
+        sum.fetch_add(value, std::memory_order_relaxed);
+    });
+    ASSERT_EQ(sum.load(), std::accumulate(std_vector.begin(), std_vector.end(), 0ll));
+
+    labwork7::transform(std::execution::par, unrolled_list.begin(), unrolled_list.end(), unrolled_list.begin(),
+        [](int value) { return value * 3 + 1; });
+    std::transform(std_vector.begin(), std_vector.end(), std_vector.begin(), [](int value) { return value * 3 + 1; });
+    ASSERT_THAT(unrolled_list, ::testing::ElementsAreArray(std_vector));
+
+    std::vector<long long> out(std_vector.size() + 1, -1);
+    auto out_itr = labwork7::transform(std::execution::par_unseq, unrolled_list.cbegin(), unrolled_list.cend(), out.begin(),
+        [](int value) { return value * 2ll; });
+    ASSERT_EQ(out_itr, out.begin() + std_vector.size());
+    for (size_t ind = 0; ind < std_vector.size(); ++ind) {
+        ASSERT_EQ(out[ind], std_vector[ind] * 2ll);
+    }
+    ASSERT_EQ(out.back(), -1);
+}
+
+TEST_F(ParallelAlgorithmTest, reduceAndCountIf) {
+    ASSERT_EQ(labwork7::reduce(std::execution::par, unrolled_list.begin(), unrolled_list.end(), 0ll),
+        std::accumulate(std_vector.begin(), std_vector.end(), 0ll));
+    ASSERT_EQ(labwork7::reduce(std::execution::seq, unrolled_list.nth(17), unrolled_list.nth(150'000), 5ll),
+        std::accumulate(std_vector.begin() + 17, std_vector.begin() + 150'000, 5ll));
+
+    /* string concatenation is associative but not commutative */
+    ::unrolled_list<std::string, 16> strings;
+    std::string expected;
+    for (int i = 0; i < 30'000; ++i) {
+        strings.push_back(std::string(1, static_cast<char>('a' + i % 26)));
+        expected += static_cast<char>('a' + i % 26);
+    }
+    ASSERT_EQ(labwork7::reduce(std::execution::par, strings.begin(), strings.end(), std::string{">"}), ">" + expected);
+
+    auto is_odd = [](int value) { return value % 2 == 1; };
+    ASSERT_EQ(labwork7::count_if(std::execution::par, unrolled_list.cbegin(), unrolled_list.cend(), is_odd),
+        std::count_if(std_vector.begin(), std_vector.end(), is_odd));
+}
+
+TEST_F(ParallelAlgorithmTest, findIfReturnsTheFirstMatch) {
+    unrolled_list.back() = -1;
+    unrolled_list[120'000] = -1;
+    unrolled_list[150'000] = -1;
+
+    auto is_negative = [](int value) { return value < 0; };
+    auto found_itr = labwork7::find_if(std::execution::par, unrolled_list.begin(), unrolled_list.end(), is_negative);
+    ASSERT_EQ(found_itr, unrolled_list.nth(120'000));
+
+    ASSERT_EQ(labwork7::find_if(std::execution::par, unrolled_list.begin(), unrolled_list.nth(120'000), is_negative),
+        unrolled_list.nth(120'000));
+    ASSERT_EQ(labwork7::find_if(std::execution::seq, unrolled_list.nth(120'001), unrolled_list.end(), is_negative),
+        unrolled_list.nth(150'000));
+
+    ASSERT_TRUE(labwork7::any_of(std::execution::par, unrolled_list.begin(), unrolled_list.end(), is_negative));
+    ASSERT_FALSE(labwork7::all_of(std::execution::par, unrolled_list.begin(), unrolled_list.end(), is_negative));
+    ASSERT_TRUE(labwork7::all_of(std::execution::par, unrolled_list.begin(), unrolled_list.nth(1000),
+        [](int value) { return value >= 0; }));
+
+    ::unrolled_list<int, 64> empty_list;
+    ASSERT_EQ(labwork7::find_if(std::execution::par, empty_list.begin(), empty_list.end(), is_negative), empty_list.end());
+    ASSERT_TRUE(labwork7::all_of(std::execution::par, empty_list.begin(), empty_list.end(), is_negative));
+}
+
+TEST_F(ParallelAlgorithmTest, exceptionReachesTheCaller) {
+    ASSERT_THROW(
+        labwork7::for_each(std::execution::par, unrolled_list.begin(), unrolled_list.end(), [](int value) {
+            if (value == 1000) {
+                throw std::runtime_error{"for_each failed"};
+            }
+        }),
+        std::runtime_error);
+}
+
+TEST(WorkStealingPool, runsEveryTaskOnceWithNestedRuns) {
+    labwork7::details::WorkStealingPool pool(3);
+    std::vector<std::atomic<int>> visited(64 * 64);
+
+    pool.Run(64, [&](size_t outer) {
+        pool.Run(64, [&](size_t inner) {
+            visited[outer * 64 + inner].fetch_add(1, std::memory_order_relaxed);
+        });
+    });
+
+    for (const auto& value : visited) {
+        ASSERT_EQ(value.load(), 1);
+    }
+}
+
+
+/*
+    В тесте задач больше, чем помещается во все очереди пула, затем пул много раз запускает по две задачи.
+
+    Ожидается, что каждая задача выполняется ровно один раз.
+*/
+TEST(WorkStealingPool, overflowRunsOnTheCaller) {
+    labwork7::details::WorkStealingPool pool(2);
+    std::vector<std::atomic<int>> visited(5000);
+
+    pool.Run(visited.size(), [&](size_t index) {
+        visited[index].fetch_add(1, std::memory_order_relaxed);
+    });
+    for (const auto& value : visited) {
+        ASSERT_EQ(value.load(), 1);
+    }
+
+    std::atomic<int> total = 0;
+    for (int run = 0; run != 10'000; ++run) {
+        pool.Run(2, [&](size_t) { total.fetch_add(1, std::memory_order_relaxed); });
+    }
+    ASSERT_EQ(total.load(), 20'000);
+}
+
+
+/*
+    В тесте список длиннее, чем kParallelTaskBlocks работ по kParallelUnitElements элементов.
+
+    Ожидается, что работы сливаются, идут подряд, покрывают весь список, а reduce совпадает с последовательным.
+*/
+TEST(WorkUnits, neighbourUnitsAreJoined) {
+    constexpr size_t kElements = labwork7::details::kParallelTaskBlocks * labwork7::details::kParallelUnitElements * 3 / 2;
+    ::unrolled_list<uint8_t, 1000> list(uint8_t{1}, kElements);
+
+    auto units = labwork7::details::PartitionUnits(list.begin(), list.end());
+    ASSERT_LE(units.size(), labwork7::details::kParallelTaskBlocks);
+    ASSERT_GT(units.size(), labwork7::details::kParallelTaskBlocks / 2);
+
+    auto expected_first = list.begin();
+    size_t covered = 0;
+    for (const auto& unit : units) {
+        ASSERT_EQ(unit.first_m, expected_first);
+        expected_first = unit.last_m;
+        covered += unit.size_m;
+    }
+    ASSERT_EQ(expected_first, list.end());
+    ASSERT_EQ(covered, kElements);
+
+    ASSERT_EQ(labwork7::reduce(std::execution::par, list.begin(), list.end(), size_t{0}), kElements);
+}
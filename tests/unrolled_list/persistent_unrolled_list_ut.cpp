@@ -0,0 +1,232 @@
+#include <persistent_unrolled_list.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "test_utils.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+    В данном файле проверяется persistent_unrolled_list:
+        - insert/erase/set совпадают с std::vector, старые версии не меняются
+        - изменение после snapshot копирует только путь до затронутой ноды
+        - ноды старых версий освобождаются вместе с последней ссылкой на них
+        - версии читаются в других потоках, пока писатель меняет свою
+*/
+
+namespace {
+
+using namespace labwork7::test;
+
+
+struct LiveCounter {
+    static inline int Alive = 0;
+
+    LiveCounter(int value) : value_m(value) { ++Alive; };
+    LiveCounter(const LiveCounter& other) : value_m(other.value_m) { ++Alive; };
+    LiveCounter(LiveCounter&& other) noexcept : value_m(other.value_m) { ++Alive; };
+    LiveCounter& operator=(const LiveCounter&) = default;
+    ~LiveCounter() { --Alive; };
+
+    int value_m;
+};
+
+
+template<typename DataType>
+class CountingAllocator {
+  public:
+    using value_type = DataType;
+    using is_always_equal = std::true_type;
+
+    static inline int AllocationCount = 0;
+
+    CountingAllocator() = default;
+
+    template<typename AnotherType>
+    CountingAllocator(const CountingAllocator<AnotherType>&) noexcept {  };
+
+    DataType* allocate(size_t count) {
+        ++CountingAllocator<void>::AllocationCount;
+        return std::allocator<DataType>{}.allocate(count);
+    };
+
+    void deallocate(DataType* ptr, size_t count) noexcept {
+        std::allocator<DataType>{}.deallocate(ptr, count);
+    };
+
+    bool operator==(const CountingAllocator&) const noexcept { return true; };
+};
+
+} // namespace
+
+
+TEST(PersistentUnrolledList, matchesVectorAndKeepsSnapshots) {
+    persistent_unrolled_list<std::string, 6> list;
+    std::vector<std::string> std_vector;
+
+    std::vector<persistent_unrolled_list<std::string, 6>> snapshots;
+    std::vector<std::vector<std::string>> snapshot_contents;
+
+    std::mt19937 generator(17);
+    for (int step = 0; step < 6000; ++step) {
+        std::string value = "value_" + std::to_string(step) + "_which_does_not_fit_into_sso";
+        size_t operation = generator() % 10;
+
+        if (operation < 5 || std_vector.empty()) {
+            size_t index = generator() % (std_vector.size() + 1);
+            list.insert(index, value);
+            std_vector.insert(std_vector.begin() + index, value);
+        } else if (operation < 8) {
+            size_t index = generator() % std_vector.size();
+            list.erase(index);
+            std_vector.erase(std_vector.begin() + index);
+        } else {
+            size_t index = generator() % std_vector.size();
+            list.set(index, value);
+            std_vector[index] = value;
+        }
+
+        if (step % 500 == 0) {
+            snapshots.push_back(list.snapshot());
+            snapshot_contents.push_back(std_vector);
+        }
+    }
+
+    ASSERT_EQ(list.size(), std_vector.size());
+    ASSERT_THAT(ToVector(list), ::testing::ElementsAreArray(std_vector));
+    for (size_t index = 0; index < std_vector.size(); index += 97) {
+        ASSERT_EQ(list[index], std_vector[index]);
+    }
+    ASSERT_THROW(list.at(std_vector.size()), std::out_of_range);
+
+    for (size_t ind = 0; ind != snapshots.size(); ++ind) {
+        ASSERT_THAT(ToVector(snapshots[ind]), ::testing::ElementsAreArray(snapshot_contents[ind]));
+    }
+
+    while (!list.empty()) {
+        list.pop_front();
+    }
+    ASSERT_EQ(list.begin(), list.end());
+    ASSERT_THAT(ToVector(snapshots.back()), ::testing::ElementsAreArray(snapshot_contents.back()));
+}
+
+
+/*
+    В тесте после snapshot большого списка меняется один элемент.
+
+    Ожидается, что snapshot ничего не выделяет, а изменение выделяет по одной копии
+    на каждый уровень дерева и на ноду с элементом, а не копирует весь список.
+*/
+TEST(PersistentUnrolledList, snapshotSharesUntouchedChuncks) {
+    using list_t = persistent_unrolled_list<int, 16, CountingAllocator<int>>;
+
+    list_t list;
+    for (int i = 0; i < 100'000; ++i) {
+        list.push_back(i);
+    }
+
+    int allocations = CountingAllocator<void>::AllocationCount;
+    list_t snapshot = list.snapshot();
+    ASSERT_EQ(CountingAllocator<void>::AllocationCount, allocations);
+
+    list.set(50'000, -1);
+    ASSERT_LE(CountingAllocator<void>::AllocationCount - allocations, 8);
+
+    ASSERT_EQ(list[50'000], -1);
+    ASSERT_EQ(snapshot[50'000], 50'000);
+    ASSERT_FALSE(list == snapshot);
+
+    list.set(50'000, 50'000);
+    ASSERT_TRUE(list == snapshot);
+
+    /* the path is owned by the list already, so the next change copies nothing */
+    allocations = CountingAllocator<void>::AllocationCount;
+    list.set(50'001, -1);
+    ASSERT_EQ(CountingAllocator<void>::AllocationCount, allocations);
+}
+
+
+TEST(PersistentUnrolledList, freesVersionsWithLastReference) {
+    {
+        persistent_unrolled_list<LiveCounter, 4> list;
+        for (int i = 0; i < 100; ++i) {
+            list.push_back(LiveCounter(i));
+        }
+        ASSERT_EQ(LiveCounter::Alive, 100);
+
+        {
+            auto snapshot = list.snapshot();
+            list.set(0, LiveCounter(-1));
+            list.erase(99);
+            ASSERT_GT(LiveCounter::Alive, 100);
+        }
+        ASSERT_EQ(LiveCounter::Alive, 99);
+
+        auto snapshot = list.snapshot();
+        list.clear();
+        ASSERT_EQ(LiveCounter::Alive, 99);
+        ASSERT_EQ(snapshot.front().value_m, -1);
+    }
+    ASSERT_EQ(LiveCounter::Alive, 0);
+}
+
+
+TEST(PersistentUnrolledList, readersOfSnapshotsAndWriter) {
+    constexpr size_t kSize = 2000;
+    constexpr uint64_t kVersions = 300;
+
+    std::vector<uint64_t> zeros(kSize, 0);
+    persistent_unrolled_list<uint64_t, 32> list(zeros.begin(), zeros.end());
+
+    std::mutex published_mutex;
+    auto published = list.snapshot();
+    std::atomic<bool> is_done = false;
+    std::atomic<bool> is_consistent = true;
+
+    auto reader = [&] {
+        while (!is_done.load()) {
+            persistent_unrolled_list<uint64_t, 32> version;
+            {
+                std::lock_guard lock(published_mutex);
+                version = published;
+            }
+
+            uint64_t first = version.front();
+            size_t count = 0;
+            for (uint64_t value : version) {
+                is_consistent = is_consistent && value == first;
+                ++count;
+            }
+            is_consistent = is_consistent && count == kSize;
+        }
+    };
+
+    std::thread first_reader(reader);
+    std::thread second_reader(reader);
+
+    for (uint64_t version = 1; version <= kVersions; ++version) {
+        for (size_t index = 0; index != kSize; ++index) {
+            list.set(index, version);
+        }
+        list.insert(kSize / 2, version);
+        list.erase(kSize / 2);
+
+        std::lock_guard lock(published_mutex);
+        published = list.snapshot();
+    }
+
+    is_done = true;
+    first_reader.join();
+    second_reader.join();
+
+    ASSERT_TRUE(is_consistent);
+    ASSERT_EQ(published.back(), kVersions);
+}
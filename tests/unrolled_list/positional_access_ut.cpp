@@ -0,0 +1,158 @@
+#include <unrolled_list.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/*
+    В данном файле проверяется доступ к элементам по позиции:
+        - operator[], at, nth
+        - advance, distance и operator- у итератора, которые пропускают ноды целиком
+        - erase диапазона, который освобождает внутренние ноды целиком
+        - вставка диапазона в середину списка
+*/
+
+TEST(PositionalAccess, subscriptMatchesIteration) {
+    unrolled_list<int, 7> unrolled_list;
+    std::vector<int> std_vector;
+
+    for (int i = 0; i < 1000; ++i) {
+        if (i % 2 == 0) {
+            unrolled_list.push_back(i);
+            std_vector.push_back(i);
+        } else {
+            unrolled_list.push_front(i);
+            std_vector.insert(std_vector.begin(), i);
+        }
+    }
+
+    for (size_t ind = 0; ind < std_vector.size(); ++ind) {
+        ASSERT_EQ(unrolled_list[ind], std_vector[ind]);
+        ASSERT_EQ(*unrolled_list.nth(ind), std_vector[ind]);
+    }
+
+    ASSERT_EQ(unrolled_list.nth(unrolled_list.size()), unrolled_list.end());
+}
+
+TEST(PositionalAccess, subscriptIsWritable) {
+    unrolled_list<int, 4> unrolled_list{1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    unrolled_list[6] = 42;
+
+    ASSERT_THAT(unrolled_list, ::testing::ElementsAre(1, 2, 3, 4, 5, 6, 42, 8, 9));
+}
+
+TEST(PositionalAccess, atChecksBounds) {
+    unrolled_list<int, 4> unrolled_list{1, 2, 3};
+    const auto& const_list = unrolled_list;
+
+    ASSERT_EQ(unrolled_list.at(2), 3);
+    ASSERT_EQ(const_list.at(0), 1);
+    ASSERT_THROW(unrolled_list.at(3), std::out_of_range);
+    ASSERT_THROW(const_list.at(100), std::out_of_range);
+}
+
+TEST(PositionalAccess, advanceAndDistance) {
+    unrolled_list<int, 5> unrolled_list;
+    for (int i = 0; i < 103; ++i) {
+        unrolled_list.push_back(i);
+    }
+
+    auto itr = unrolled_list.begin();
+    advance(itr, 57);
+    ASSERT_EQ(*itr, 57);
+
+    advance(itr, -50);
+    ASSERT_EQ(*itr, 7);
+
+    advance(itr, 96);
+    ASSERT_EQ(itr, unrolled_list.end());
+
+    ASSERT_EQ(distance(unrolled_list.begin(), unrolled_list.end()), 103);
+    ASSERT_EQ(distance(unrolled_list.end(), unrolled_list.begin()), -103);
+    ASSERT_EQ(distance(unrolled_list.nth(64), unrolled_list.nth(12)), -52);
+    ASSERT_FALSE((std::sized_sentinel_for<decltype(unrolled_list.end()), decltype(unrolled_list.begin())>));
+    ASSERT_EQ(std::ranges::distance(unrolled_list.nth(10), unrolled_list.nth(90)), 80);
+}
+
+TEST(PositionalAccess, rangeEraseByPosition) {
+    unrolled_list<int, 6> unrolled_list;
+    std::vector<int> std_vector;
+    for (int i = 0; i < 200; ++i) {
+        unrolled_list.push_back(i);
+        std_vector.push_back(i);
+    }
+
+    unrolled_list.erase(unrolled_list.nth(13), unrolled_list.nth(150));
+    std_vector.erase(std_vector.begin() + 13, std_vector.begin() + 150);
+
+    ASSERT_THAT(unrolled_list, ::testing::ElementsAreArray(std_vector));
+}
+
+TEST(PositionalAccess, rangeEraseKeepsChunckChain) {
+    for (size_t first = 0; first <= 40; first += 3) {
+        for (size_t last = first; last <= 40; last += 5) {
+            unrolled_list<std::string, 4> unrolled_list;
+            std::vector<std::string> std_vector;
+            for (int i = 0; i < 40; ++i) {
+                std::string value = "value_" + std::to_string(i) + "_which_does_not_fit_into_sso";
+                unrolled_list.push_back(value);
+                std_vector.push_back(value);
+            }
+
+            auto result_itr = unrolled_list.erase(unrolled_list.nth(first), unrolled_list.nth(last));
+            std_vector.erase(std_vector.begin() + first, std_vector.begin() + last);
+
+            ASSERT_THAT(unrolled_list, ::testing::ElementsAreArray(std_vector));
+            ASSERT_EQ(result_itr, unrolled_list.nth(first));
+            ASSERT_EQ(unrolled_list.size(), std_vector.size());
+
+            size_t chunck_count = 0;
+            for (auto chunck : unrolled_list.chunks()) {
+                ASSERT_FALSE(chunck.empty());
+                ++chunck_count;
+            }
+            ASSERT_EQ(std::ranges::distance(unrolled_list.chunks().rbegin(), unrolled_list.chunks().rend()), chunck_count);
+        }
+    }
+
+    unrolled_list<int, 8> unrolled_list(7, 1000);
+    auto result_itr = unrolled_list.erase(unrolled_list.begin(), unrolled_list.end());
+    ASSERT_TRUE(result_itr == unrolled_list.end());
+    ASSERT_TRUE(unrolled_list.empty());
+    unrolled_list.push_back(1);
+    ASSERT_THAT(unrolled_list, ::testing::ElementsAre(1));
+}
+
+TEST(PositionalAccess, bulkInsertInTheMiddle) {
+    unrolled_list<int, 8> unrolled_list{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+    std::vector<int> std_vector{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+
+    std::vector<int> values(100);
+    std::iota(values.begin(), values.end(), 100);
+
+    auto result_itr = unrolled_list.insert(unrolled_list.nth(5), values.begin(), values.end());
+    std_vector.insert(std_vector.begin() + 5, values.begin(), values.end());
+    ASSERT_THAT(unrolled_list, ::testing::ElementsAreArray(std_vector));
+    ASSERT_EQ(result_itr, unrolled_list.nth(5));
+
+    result_itr = unrolled_list.insert(unrolled_list.nth(8), 20, -1);
+    std_vector.insert(std_vector.begin() + 8, 20, -1);
+    ASSERT_THAT(unrolled_list, ::testing::ElementsAreArray(std_vector));
+    ASSERT_EQ(result_itr, unrolled_list.nth(8));
+
+    unrolled_list.insert(unrolled_list.end(), values.begin(), values.begin() + 3);
+    unrolled_list.insert(unrolled_list.begin(), values.begin() + 3, values.begin() + 20);
+    std_vector.insert(std_vector.end(), values.begin(), values.begin() + 3);
+    std_vector.insert(std_vector.begin(), values.begin() + 3, values.begin() + 20);
+    ASSERT_THAT(unrolled_list, ::testing::ElementsAreArray(std_vector));
+
+    for (auto chunck : unrolled_list.chunks()) {
+        ASSERT_FALSE(chunck.empty());
+    }
+}
@@ -0,0 +1,105 @@
+#include <unrolled_list.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+/*
+    В данном файле проверяется перемещение элементов побайтово (relocation):
+        - тривиально копируемые типы считаются relocatable без специализаций
+        - тип, который явно объявил себя relocatable, не вызывает конструктор перемещения
+          при сдвигах внутри ноды, разбиении, слиянии и вставке диапазона
+*/
+
+namespace {
+
+class HeapHandle {
+public:
+    static inline int MovesCount = 0;
+
+    explicit HeapHandle(int value) : value_ptr(std::make_unique<int>(value)) {
+    }
+
+    HeapHandle(const HeapHandle& other) : value_ptr(std::make_unique<int>(*other.value_ptr)) {
+    }
+
+    HeapHandle(HeapHandle&& other) noexcept : value_ptr(std::move(other.value_ptr)) {
+        ++MovesCount;
+    }
+
+    HeapHandle& operator=(HeapHandle other) noexcept {
+        value_ptr = std::move(other.value_ptr);
+        return *this;
+    }
+
+    int Value() const {
+        return *value_ptr;
+    }
+
+private:
+    std::unique_ptr<int> value_ptr;
+};
+
+
+struct NotRelocatable {
+    NotRelocatable(NotRelocatable&&) {}
+};
+
+} // namespace
+
+
+template<>
+struct labwork7::is_trivially_relocatable<HeapHandle> : std::true_type {};
+
+
+static_assert(labwork7::is_trivially_relocatable_v<int>);
+static_assert(labwork7::is_trivially_relocatable_v<double*>);
+static_assert(labwork7::is_trivially_relocatable_v<HeapHandle>);
+static_assert(!labwork7::is_trivially_relocatable_v<NotRelocatable>);
+static_assert(labwork7::is_nothrow_relocatable_v<HeapHandle>);
+
+
+TEST(Relocation, optedInTypeIsNeverMoveConstructed) {
+    unrolled_list<HeapHandle, 8> unrolled_list;
+    std::vector<int> std_vector;
+    std::mt19937 generator(11);
+
+    std::vector<HeapHandle> values;
+    values.reserve(30);
+    for (int i = 0; i < 30; ++i) {
+        values.emplace_back(-i);
+    }
+
+    HeapHandle::MovesCount = 0;
+    for (int step = 0; step < 3000; ++step) {
+        if (std_vector.empty() || generator() % 3 != 0) {
+            size_t index = generator() % (std_vector.size() + 1);
+
+            unrolled_list.emplace(unrolled_list.nth(index), step);
+            std_vector.insert(std_vector.begin() + index, step);
+        } else {
+            size_t index = generator() % std_vector.size();
+            size_t count = std::min<size_t>(generator() % 12 + 1, std_vector.size() - index);
+
+            unrolled_list.erase(unrolled_list.nth(index), unrolled_list.nth(index + count));
+            std_vector.erase(std_vector.begin() + index, std_vector.begin() + index + count);
+        }
+    }
+
+    size_t middle = std_vector.size() / 2;
+    unrolled_list.insert(unrolled_list.nth(middle), values.begin(), values.end());
+    for (int i = 0; i < 30; ++i) {
+        std_vector.insert(std_vector.begin() + middle + i, -i);
+    }
+
+    ASSERT_EQ(HeapHandle::MovesCount, 0);
+    ASSERT_EQ(unrolled_list.size(), std_vector.size());
+
+    size_t ind = 0;
+    for (const auto& value : unrolled_list) {
+        ASSERT_EQ(value.Value(), std_vector[ind++]);
+    }
+}
@@ -0,0 +1,84 @@
+#include <unrolled_list.hpp>
+#include <algorithm.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <vector>
+
+/*
+    В данном файле проверяются алгоритмы, которые обходят unrolled_list по нодам:
+        - for_each, find, count, accumulate, copy, fill, transform, inclusive_scan
+    Результат сравнивается со стандартными алгоритмами над std::vector.
+*/
+
+class SegmentedAlgorithmTest : public testing::Test {
+public:
+    void SetUp() override {
+        for (int i = 0; i < 1000; ++i) {
+            unrolled_list.push_back(i % 37);
+            std_vector.push_back(i % 37);
+        }
+    }
+
+    ::unrolled_list<int, 7> unrolled_list;
+    std::vector<int> std_vector;
+};
+
+TEST_F(SegmentedAlgorithmTest, forEachAndAccumulate) {
+    long long sum = 0;
+    for_each(unrolled_list.begin(), unrolled_list.end(), [&](int value) { sum += value; });
+
+    ASSERT_EQ(sum, std::accumulate(std_vector.begin(), std_vector.end(), 0ll));
+    ASSERT_EQ(accumulate(unrolled_list.cbegin(), unrolled_list.cend(), 0ll), sum);
+    ASSERT_EQ(labwork7::accumulate(unrolled_list.nth(100), unrolled_list.nth(900), 0, std::plus<>{}),
+        std::accumulate(std_vector.begin() + 100, std_vector.begin() + 900, 0));
+}
+
+TEST_F(SegmentedAlgorithmTest, findAndCount) {
+    auto found_itr = find(unrolled_list.nth(40), unrolled_list.end(), 5);
+    ASSERT_EQ(found_itr, unrolled_list.nth(42));
+    ASSERT_EQ(*found_itr, 5);
+
+    ASSERT_EQ(find(unrolled_list.begin(), unrolled_list.end(), 100), unrolled_list.end());
+    ASSERT_EQ(count(unrolled_list.cbegin(), unrolled_list.cend(), 3),
+        std::count(std_vector.begin(), std_vector.end(), 3));
+}
+
+TEST_F(SegmentedAlgorithmTest, copyAndTransform) {
+    std::vector<int> copied;
+    copy(unrolled_list.begin(), unrolled_list.end(), std::back_inserter(copied));
+    ASSERT_EQ(copied, std_vector);
+
+    transform(unrolled_list.begin(), unrolled_list.end(), unrolled_list.begin(), [](int value) { return value * 2; });
+    std::transform(std_vector.begin(), std_vector.end(), std_vector.begin(), [](int value) { return value * 2; });
+    ASSERT_THAT(unrolled_list, ::testing::ElementsAreArray(std_vector));
+
+    ::unrolled_list<int, 3> another_list(0, 1000);
+    auto out_itr = copy(unrolled_list.begin(), unrolled_list.end(), another_list.begin());
+    ASSERT_EQ(out_itr, another_list.end());
+    ASSERT_THAT(another_list, ::testing::ElementsAreArray(std_vector));
+}
+
+TEST_F(SegmentedAlgorithmTest, fill) {
+    fill(unrolled_list.nth(10), unrolled_list.nth(500), -1);
+    std::fill(std_vector.begin() + 10, std_vector.begin() + 500, -1);
+
+    ASSERT_THAT(unrolled_list, ::testing::ElementsAreArray(std_vector));
+}
+
+TEST_F(SegmentedAlgorithmTest, inclusiveScan) {
+    std::vector<int> expected(std_vector.size());
+    std::inclusive_scan(std_vector.begin(), std_vector.end(), expected.begin());
+
+    inclusive_scan(unrolled_list.begin(), unrolled_list.end(), unrolled_list.begin());
+    ASSERT_THAT(unrolled_list, ::testing::ElementsAreArray(expected));
+
+    std::vector<std::string> words;
+    ::unrolled_list<std::string, 2> words_list{"a", "b", "c", "d", "e"};
+    inclusive_scan(words_list.cbegin(), words_list.cend(), std::back_inserter(words), std::plus<>{}, std::string{">"});
+    ASSERT_THAT(words, ::testing::ElementsAre(">a", ">ab", ">abc", ">abcd", ">abcde"));
+}
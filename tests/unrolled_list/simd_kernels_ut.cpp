@@ -0,0 +1,121 @@
+#include <unrolled_list.hpp>
+#include <algorithm.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+/*
+    В данном файле проверяются векторные ядра поиска и свёртки:
+        - ядра каждого доступного набора инструкций совпадают со скалярной версией на всех длинах и хвостах
+        - find/count/accumulate/min_element/max_element у unrolled_list совпадают с std
+*/
+
+namespace {
+
+using labwork7::details::simd::isa_level;
+
+std::vector<isa_level> AvailableLevels() {
+    std::vector<isa_level> result{isa_level::kScalar};
+    if (labwork7::details::simd::DetectIsaLevel() >= isa_level::kSse2) {
+        result.push_back(isa_level::kSse2);
+    }
+    if (labwork7::details::simd::DetectIsaLevel() >= isa_level::kAvx2) {
+        result.push_back(isa_level::kAvx2);
+    }
+    return result;
+}
+
+
+template<typename DataType>
+void CheckKernels() {
+    std::mt19937 generator(17);
+    std::vector<DataType> data(67);
+    for (auto& value : data) {
+        value = static_cast<DataType>(static_cast<int>(generator() % 9) - 4);
+    }
+
+    for (isa_level level : AvailableLevels()) {
+        auto kernels = labwork7::details::simd::MakeKernels<DataType>(level);
+
+        for (size_t first = 0; first < 9; ++first) {
+            for (size_t last = first; last <= data.size(); ++last) {
+                const DataType* first_ptr = data.data() + first;
+                const DataType* last_ptr = data.data() + last;
+
+                for (int value = -5; value <= 5; ++value) {
+                    ASSERT_EQ(kernels.find(first_ptr, last_ptr, static_cast<DataType>(value)),
+                        std::find(first_ptr, last_ptr, static_cast<DataType>(value)));
+                    ASSERT_EQ(kernels.count(first_ptr, last_ptr, static_cast<DataType>(value)),
+                        std::count(first_ptr, last_ptr, static_cast<DataType>(value)));
+                }
+
+                if constexpr (std::is_integral_v<DataType>) {
+                    ASSERT_EQ(kernels.sum(first_ptr, last_ptr), std::accumulate(first_ptr, last_ptr, DataType{0}));
+                    ASSERT_EQ(kernels.sum_wide(first_ptr, last_ptr), std::accumulate(first_ptr, last_ptr, int64_t{0}));
+                    if (first != last) {
+                        ASSERT_EQ(kernels.min_element(first_ptr, last_ptr), std::min_element(first_ptr, last_ptr));
+                        ASSERT_EQ(kernels.max_element(first_ptr, last_ptr), std::max_element(first_ptr, last_ptr));
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // namespace
+
+
+TEST(SimdKernels, int32KernelsMatchScalar) {
+    CheckKernels<int32_t>();
+}
+
+TEST(SimdKernels, int64KernelsMatchScalar) {
+    CheckKernels<int64_t>();
+}
+
+TEST(SimdKernels, floatingKernelsMatchScalar) {
+    CheckKernels<float>();
+    CheckKernels<double>();
+}
+
+TEST(SimdKernels, listAlgorithmsMatchStd) {
+    unrolled_list<int32_t, 13> int_list;
+    std::vector<int32_t> std_vector;
+    std::mt19937 generator(3);
+    for (int i = 0; i < 2000; ++i) {
+        int32_t value = static_cast<int32_t>(generator() % 100000) - 50000;
+        int_list.push_back(value);
+        std_vector.push_back(value);
+    }
+
+    auto first_itr = int_list.nth(5);
+    auto last_itr = int_list.nth(1990);
+    auto std_first = std_vector.begin() + 5;
+    auto std_last = std_vector.begin() + 1990;
+
+    ASSERT_EQ(labwork7::accumulate(first_itr, last_itr, int32_t{0}), std::accumulate(std_first, std_last, int32_t{0}));
+    ASSERT_EQ(labwork7::accumulate(first_itr, last_itr, int64_t{0}), std::accumulate(std_first, std_last, int64_t{0}));
+
+    ASSERT_EQ(*labwork7::min_element(first_itr, last_itr), *std::min_element(std_first, std_last));
+    ASSERT_EQ(int_list.begin().distance_to(labwork7::min_element(int_list.begin(), int_list.end())),
+        std::min_element(std_vector.begin(), std_vector.end()) - std_vector.begin());
+    ASSERT_EQ(int_list.begin().distance_to(labwork7::max_element(int_list.cbegin(), int_list.cend()).base()),
+        std::max_element(std_vector.begin(), std_vector.end()) - std_vector.begin());
+
+    int32_t value = std_vector[1500];
+    ASSERT_EQ(int_list.begin().distance_to(labwork7::find(int_list.begin(), int_list.end(), value)),
+        std::find(std_vector.begin(), std_vector.end(), value) - std_vector.begin());
+    ASSERT_EQ(labwork7::find(int_list.begin(), int_list.end(), int32_t{1 << 20}), int_list.end());
+    ASSERT_EQ(labwork7::count(int_list.cbegin(), int_list.cend(), value), std::count(std_vector.begin(), std_vector.end(), value));
+
+    unrolled_list<double, 6> double_list{1.5, -2.0, 3.25, -2.0, 0.0};
+    ASSERT_EQ(labwork7::count(double_list.begin(), double_list.end(), -2.0), 2);
+    ASSERT_EQ(*labwork7::max_element(double_list.begin(), double_list.end()), 3.25);
+    ASSERT_EQ(labwork7::min_element(double_list.end(), double_list.end()), double_list.end());
+}
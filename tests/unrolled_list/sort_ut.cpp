@@ -0,0 +1,264 @@
+#include <unrolled_list.hpp>
+#include <indexed_unrolled_list.hpp>
+#include <parallel_algorithm.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "test_utils.hpp"
+
+#include <algorithm>
+#include <execution>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+/*
+    В данном файле проверяются sort/stable_sort/merge:
+        - результат совпадает с std::stable_sort над std::vector для разных размеров и ChunckSize
+        - stable_sort и merge сохраняют порядок равных элементов
+        - параллельная сортировка совпадает с последовательной
+        - при исключении из компаратора ни один элемент не теряется
+*/
+
+namespace {
+
+using namespace labwork7::test;
+
+
+std::string MakeValue(int value) {
+    return "value_" + std::to_string(value) + "_which_does_not_fit_into_sso";
+}
+
+
+struct ThrowingLess {
+    bool operator()(const std::string& lhs, const std::string& rhs) const {
+        if (++*calls_m == throw_after_m) {
+            throw std::runtime_error{"compare failed"};
+        }
+        return lhs < rhs;
+    };
+
+    int* calls_m;
+    int throw_after_m;
+};
+
+
+/* move which is allowed to throw, so the list sorts it through a copy */
+struct ThrowingMoveValue {
+    ThrowingMoveValue(int value) : value_m(value) {  };
+    ThrowingMoveValue(const ThrowingMoveValue&) = default;
+    ThrowingMoveValue(ThrowingMoveValue&& other) noexcept(false) : value_m(other.value_m) {  };
+    ThrowingMoveValue& operator=(const ThrowingMoveValue&) = default;
+
+    bool operator==(const ThrowingMoveValue&) const = default;
+    auto operator<=>(const ThrowingMoveValue&) const = default;
+
+    int value_m;
+};
+
+} // namespace
+
+
+TEST(Sort, matchesVector) {
+    std::mt19937 generator(16);
+
+    for (int size : {0, 1, 7, 8, 9, 100, 1000, 5000}) {
+        unrolled_list<int, 8> list;
+        std::vector<int> std_vector;
+        for (int i = 0; i < size; ++i) {
+            int value = generator() % 300;
+            list.push_back(value);
+            std_vector.push_back(value);
+            /* sparse chuncks as well */
+            if (i % 5 == 0 && !list.empty()) {
+                list.erase(list.nth(list.size() / 2));
+                std_vector.erase(std_vector.begin() + std_vector.size() / 2);
+            }
+        }
+
+        std::stable_sort(std_vector.begin(), std_vector.end());
+        unrolled_list<int, 8> stable_list = list;
+        list.sort();
+        stable_list.stable_sort();
+
+        ASSERT_THAT(list, ::testing::ElementsAreArray(std_vector));
+        ASSERT_THAT(stable_list, ::testing::ElementsAreArray(std_vector));
+        ExpectChunckChain(list);
+        ExpectChunckChain(stable_list);
+
+        list.sort(std::greater<>{});
+        ASSERT_THAT(list, ::testing::ElementsAreArray(std_vector.rbegin(), std_vector.rend()));
+    }
+}
+
+TEST(Sort, stableSortKeepsEqualElementsOrder) {
+    std::mt19937 generator(161);
+    auto by_key = [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; };
+
+    unrolled_list<std::pair<int, std::string>, 6> list;
+    std::vector<std::pair<int, std::string>> std_vector;
+    for (int i = 0; i < 3000; ++i) {
+        std::pair<int, std::string> value{generator() % 20, MakeValue(i)};
+        list.push_back(value);
+        std_vector.push_back(value);
+    }
+
+    list.stable_sort(by_key);
+    std::stable_sort(std_vector.begin(), std_vector.end(), by_key);
+
+    ASSERT_THAT(list, ::testing::ElementsAreArray(std_vector));
+    ExpectChunckChain(list);
+}
+
+TEST(Sort, mergeSortedLists) {
+    std::mt19937 generator(162);
+    auto by_key = [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; };
+
+    for (int step = 0; step < 50; ++step) {
+        unrolled_list<std::pair<int, int>, 5> list;
+        unrolled_list<std::pair<int, int>, 5> other_list;
+        std::vector<std::pair<int, int>> std_vector;
+        std::vector<std::pair<int, int>> other_vector;
+
+        for (int i = 0, count = generator() % 60; i < count; ++i) {
+            std_vector.emplace_back(generator() % 30, i);
+        }
+        for (int i = 0, count = generator() % 60; i < count; ++i) {
+            other_vector.emplace_back(generator() % 30, -i);
+        }
+        std::stable_sort(std_vector.begin(), std_vector.end(), by_key);
+        std::stable_sort(other_vector.begin(), other_vector.end(), by_key);
+        for (const auto& value : std_vector) {
+            list.push_back(value);
+        }
+        for (const auto& value : other_vector) {
+            other_list.push_back(value);
+        }
+
+        list.merge(other_list, by_key);
+        std::vector<std::pair<int, int>> expected;
+        std::merge(std_vector.begin(), std_vector.end(), other_vector.begin(), other_vector.end(),
+            std::back_inserter(expected), by_key);
+
+        ASSERT_THAT(list, ::testing::ElementsAreArray(expected));
+        ASSERT_TRUE(other_list.empty());
+        ExpectChunckChain(list);
+    }
+
+    unrolled_list<std::string, 4> strings{MakeValue(1), MakeValue(3), MakeValue(5)};
+    unrolled_list<std::string, 4> other_strings{MakeValue(2), MakeValue(4)};
+    strings.merge(other_strings);
+    ASSERT_THAT(strings, ::testing::ElementsAre(MakeValue(1), MakeValue(2), MakeValue(3), MakeValue(4), MakeValue(5)));
+}
+
+/*
+    В тесте компаратор бросает исключение на разных шагах сортировки списка строк.
+
+    Ожидается, что список остается корректным и сохраняет размер, а исключение,
+    брошенное во время слияния нод, не теряет ни одного элемента.
+*/
+TEST(Sort, throwingComparatorKeepsElements) {
+    std::vector<std::string> std_vector;
+    for (int i = 0; i < 400; ++i) {
+        std_vector.push_back(MakeValue((i * 37) % 400));
+    }
+    std::vector<std::string> sorted_vector = std_vector;
+    std::sort(sorted_vector.begin(), sorted_vector.end());
+
+    /* 50 chuncks of 8 elements take about a thousand comparisons to be sorted one by one */
+    for (int throw_after : {1, 10, 200, 1500, 2500, 3500}) {
+        unrolled_list<std::string, 8> list(std_vector.begin(), std_vector.end());
+        int calls = 0;
+
+        ASSERT_THROW(list.sort(ThrowingLess{&calls, throw_after}), std::runtime_error);
+
+        ExpectChunckChain(list);
+        ASSERT_EQ(list.size(), std_vector.size());
+        if (throw_after < 1500) {
+            continue;
+        }
+
+        std::vector<std::string> elements(list.begin(), list.end());
+        std::sort(elements.begin(), elements.end());
+        ASSERT_EQ(elements, sorted_vector);
+    }
+}
+
+TEST(Sort, throwingMoveSortsThroughCopy) {
+    static_assert(!labwork7::is_nothrow_relocatable_v<ThrowingMoveValue>);
+
+    std::mt19937 generator(163);
+    auto by_tens = [](const ThrowingMoveValue& lhs, const ThrowingMoveValue& rhs) { return lhs.value_m / 10 < rhs.value_m / 10; };
+
+    unrolled_list<ThrowingMoveValue, 6> list;
+    std::vector<ThrowingMoveValue> std_vector;
+    for (int i = 0; i < 500; ++i) {
+        int value = generator() % 1000;
+        list.push_back(value);
+        std_vector.push_back(value);
+    }
+
+    unrolled_list<ThrowingMoveValue, 6> stable_list = list;
+
+    list.sort();
+    std::sort(std_vector.begin(), std_vector.end());
+    ASSERT_THAT(list, ::testing::ElementsAreArray(std_vector));
+    ExpectChunckChain(list);
+
+    std::vector<ThrowingMoveValue> stable_vector(stable_list.begin(), stable_list.end());
+    stable_list.stable_sort(by_tens);
+    std::stable_sort(stable_vector.begin(), stable_vector.end(), by_tens);
+    ASSERT_THAT(stable_list, ::testing::ElementsAreArray(stable_vector));
+    ExpectChunckChain(stable_list);
+}
+
+TEST(Sort, parallelMatchesSequential) {
+    std::mt19937 generator(163);
+
+    unrolled_list<int, 64> list;
+    unrolled_list<std::string, 16> strings;
+    std::vector<int> std_vector;
+    std::vector<std::string> std_strings;
+    for (int i = 0; i < 100'000; ++i) {
+        int value = generator() % 50'000;
+        list.push_back(value);
+        std_vector.push_back(value);
+        if (i % 4 == 0) {
+            strings.push_back(MakeValue(value));
+            std_strings.push_back(MakeValue(value));
+        }
+    }
+
+    labwork7::sort(std::execution::par, list);
+    std::sort(std_vector.begin(), std_vector.end());
+    ASSERT_THAT(list, ::testing::ElementsAreArray(std_vector));
+    ExpectChunckChain(list);
+
+    labwork7::stable_sort(std::execution::par, strings, std::greater<>{});
+    std::sort(std_strings.begin(), std_strings.end(), std::greater<>{});
+    ASSERT_THAT(strings, ::testing::ElementsAreArray(std_strings));
+    ExpectChunckChain(strings);
+
+    labwork7::sort(std::execution::seq, list, std::greater<>{});
+    ASSERT_THAT(list, ::testing::ElementsAreArray(std_vector.rbegin(), std_vector.rend()));
+}
+
+TEST(Sort, indexedListRebuildsIndex) {
+    indexed_unrolled_list<int, 4> list;
+    indexed_unrolled_list<int, 4> other_list{2, 4, 6};
+    for (int i = 20; i > 0; i -= 2) {
+        list.push_back(i - 1);
+    }
+
+    list.sort();
+    ASSERT_EQ(list[3], 7);
+    list.merge(other_list);
+    ASSERT_THAT(list, ::testing::ElementsAre(1, 2, 3, 4, 5, 6, 7, 9, 11, 13, 15, 17, 19));
+    ASSERT_EQ(list[5], 6);
+    ASSERT_EQ(list.at(12), 19);
+    ASSERT_TRUE(other_list.empty());
+}
@@ -0,0 +1,212 @@
+#include <unrolled_list.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "test_utils.hpp"
+
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+/*
+    В данном файле проверяется splice/split_at/append:
+        - результат совпадает с std::vector для любых позиций вставки и разреза
+        - цепочки нод перевешиваются, а элементы перемещаются только у шва
+        - при разных аллокаторах элементы перемещаются по одному
+*/
+
+namespace {
+
+using namespace labwork7::test;
+
+
+std::string MakeValue(int value) {
+    return "value_" + std::to_string(value) + "_which_does_not_fit_into_sso";
+}
+
+
+struct MoveCounter {
+    static inline int MovesCalled = 0;
+
+    MoveCounter(int value) : value_m(value) {  };
+    MoveCounter(const MoveCounter& other) : value_m(other.value_m) { ++MovesCalled; };
+    MoveCounter(MoveCounter&& other) noexcept : value_m(other.value_m) { ++MovesCalled; };
+    MoveCounter& operator=(const MoveCounter&) = default;
+
+    bool operator==(const MoveCounter&) const = default;
+
+    int value_m;
+};
+
+
+template<typename T>
+struct TaggedAllocator {
+    using value_type = T;
+
+    TaggedAllocator(int tag = 0) : tag_m(tag) {  };
+
+    template<typename U>
+    TaggedAllocator(const TaggedAllocator<U>& other) : tag_m(other.tag_m) {  };
+
+    T* allocate(size_t count) { return std::allocator<T>{}.allocate(count); };
+    void deallocate(T* ptr, size_t count) { std::allocator<T>{}.deallocate(ptr, count); };
+
+    template<typename U>
+    bool operator==(const TaggedAllocator<U>& other) const { return tag_m == other.tag_m; };
+
+    int tag_m;
+};
+
+} // namespace
+
+
+TEST(Splice, wholeListMatchesVector) {
+    for (size_t position = 0; position <= 30; position += 3) {
+        for (int other_size : {0, 1, 5, 23}) {
+            unrolled_list<std::string, 6> list;
+            unrolled_list<std::string, 6> other_list;
+            std::vector<std::string> std_vector;
+            std::vector<std::string> other_vector;
+
+            for (int i = 0; i < 30; ++i) {
+                list.push_back(MakeValue(i));
+                std_vector.push_back(MakeValue(i));
+            }
+            for (int i = 0; i < other_size; ++i) {
+                other_list.push_back(MakeValue(-i));
+                other_vector.push_back(MakeValue(-i));
+            }
+
+            list.splice(list.nth(position), other_list);
+            std_vector.insert(std_vector.begin() + position, other_vector.begin(), other_vector.end());
+
+            ASSERT_THAT(list, ::testing::ElementsAreArray(std_vector));
+            ASSERT_EQ(list.size(), std_vector.size());
+            ASSERT_TRUE(other_list.empty());
+            ExpectChunckChain(list);
+
+            other_list.push_back(MakeValue(100));
+            ASSERT_THAT(other_list, ::testing::ElementsAre(MakeValue(100)));
+        }
+    }
+
+    unrolled_list<int, 4> empty_list;
+    unrolled_list<int, 4> other_list{1, 2, 3, 4, 5};
+    empty_list.splice(empty_list.end(), other_list);
+    ASSERT_THAT(empty_list, ::testing::ElementsAre(1, 2, 3, 4, 5));
+    ASSERT_TRUE(other_list.empty());
+}
+
+TEST(Splice, splitAtAndAppendRestoreTheList) {
+    std::vector<int> std_vector(100);
+    std::iota(std_vector.begin(), std_vector.end(), 0);
+
+    for (size_t position = 0; position <= std_vector.size(); ++position) {
+        unrolled_list<int, 7> list(std_vector.begin(), std_vector.end());
+
+        auto suffix = list.split_at(list.nth(position));
+
+        ASSERT_THAT(list, ::testing::ElementsAreArray(std_vector.begin(), std_vector.begin() + position));
+        ASSERT_THAT(suffix, ::testing::ElementsAreArray(std_vector.begin() + position, std_vector.end()));
+        ASSERT_EQ(list.size(), position);
+        ASSERT_EQ(suffix.size(), std_vector.size() - position);
+        ExpectChunckChain(list);
+        ExpectChunckChain(suffix);
+
+        list.append(std::move(suffix));
+        ASSERT_THAT(list, ::testing::ElementsAreArray(std_vector));
+        ASSERT_TRUE(suffix.empty());
+        ExpectChunckChain(list);
+    }
+}
+
+TEST(Splice, rangeMatchesVector) {
+    std::mt19937 generator(14);
+
+    for (int step = 0; step < 300; ++step) {
+        unrolled_list<std::string, 5> list;
+        unrolled_list<std::string, 5> other_list;
+        std::vector<std::string> std_vector;
+        std::vector<std::string> other_vector;
+
+        for (int i = 0, count = generator() % 40; i < count; ++i) {
+            list.push_back(MakeValue(i));
+            std_vector.push_back(MakeValue(i));
+        }
+        for (int i = 0, count = generator() % 40; i < count; ++i) {
+            other_list.push_back(MakeValue(-i));
+            other_vector.push_back(MakeValue(-i));
+        }
+
+        size_t position = generator() % (std_vector.size() + 1);
+        size_t first = generator() % (other_vector.size() + 1);
+        size_t last = first + generator() % (other_vector.size() - first + 1);
+
+        list.splice(list.nth(position), other_list, other_list.nth(first), other_list.nth(last));
+        std_vector.insert(std_vector.begin() + position, other_vector.begin() + first, other_vector.begin() + last);
+        other_vector.erase(other_vector.begin() + first, other_vector.begin() + last);
+
+        ASSERT_THAT(list, ::testing::ElementsAreArray(std_vector));
+        ASSERT_THAT(other_list, ::testing::ElementsAreArray(other_vector));
+        ASSERT_EQ(list.size(), std_vector.size());
+        ASSERT_EQ(other_list.size(), other_vector.size());
+        ExpectChunckChain(list);
+        ExpectChunckChain(other_list);
+    }
+}
+
+/*
+    В тесте в середину списка из 1000 элементов вставляется список из 10000 элементов,
+    затем список разрезается пополам.
+
+    Ожидается, что перемещаются только элементы нод у швов, то есть не больше нескольких ChunckSize.
+*/
+TEST(Splice, movesOnlySeamElements) {
+    unrolled_list<MoveCounter, 16> list;
+    unrolled_list<MoveCounter, 16> other_list;
+    for (int i = 0; i < 1000; ++i) {
+        list.emplace_back(i);
+    }
+    for (int i = 0; i < 10000; ++i) {
+        other_list.emplace_back(-i);
+    }
+
+    MoveCounter::MovesCalled = 0;
+    list.splice(list.nth(503), other_list);
+    ASSERT_LE(MoveCounter::MovesCalled, 3 * 16);
+    ASSERT_EQ(list.size(), 11000);
+    ASSERT_EQ(list[503].value_m, 0);
+    ASSERT_EQ(list[10503].value_m, 503);
+
+    MoveCounter::MovesCalled = 0;
+    auto suffix = list.split_at(list.nth(5501));
+    ASSERT_LE(MoveCounter::MovesCalled, 3 * 16);
+    ASSERT_EQ(suffix.size(), 5499);
+    ASSERT_EQ(suffix.front().value_m, -4998);
+}
+
+TEST(Splice, differentAllocatorsMoveElements) {
+    using list_t = unrolled_list<std::string, 4, TaggedAllocator<std::string>>;
+
+    list_t list(TaggedAllocator<std::string>{1});
+    list_t other_list(TaggedAllocator<std::string>{2});
+    for (int i = 0; i < 10; ++i) {
+        list.push_back(MakeValue(i));
+        other_list.push_back(MakeValue(-i));
+    }
+
+    list.splice(list.nth(5), other_list, other_list.nth(2), other_list.nth(7));
+    ASSERT_EQ(list.size(), 15);
+    ASSERT_EQ(other_list.size(), 5);
+    ASSERT_EQ(list[5], MakeValue(-2));
+    ASSERT_EQ(other_list[2], MakeValue(-7));
+
+    list.splice(list.begin(), other_list);
+    ASSERT_EQ(list.size(), 20);
+    ASSERT_EQ(list.front(), MakeValue(0));
+    ASSERT_TRUE(other_list.empty());
+    ExpectChunckChain(list);
+}
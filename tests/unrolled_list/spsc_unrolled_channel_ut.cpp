@@ -0,0 +1,160 @@
+#include <spsc_unrolled_channel.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+    В данном файле проверяется spsc_unrolled_channel:
+        - порядок FIFO, невидимость незаполненной ноды до flush, пакетные push и pop
+        - ограничение на количество нод и переиспользование возвращенных нод
+        - передача между потоками производителя и потребителя
+*/
+
+namespace {
+
+struct LiveCounter {
+    static inline int Alive = 0;
+
+    LiveCounter(int value) : value_m(value) { ++Alive; };
+    LiveCounter(const LiveCounter& other) : value_m(other.value_m) { ++Alive; };
+    LiveCounter& operator=(const LiveCounter&) = default;
+    ~LiveCounter() { --Alive; };
+
+    int value_m;
+};
+
+} // namespace
+
+
+TEST(SpscUnrolledChannel, singleThreadIsFifo) {
+    spsc_unrolled_channel<std::string, 4> channel;
+    std::string value;
+
+    ASSERT_TRUE(channel.empty());
+    ASSERT_TRUE(channel.try_push("first_value_which_does_not_fit_into_sso"));
+    ASSERT_TRUE(channel.try_push("second"));
+
+    ASSERT_TRUE(channel.empty());
+    ASSERT_FALSE(channel.try_pop(value));
+
+    channel.flush();
+    ASSERT_FALSE(channel.empty());
+    ASSERT_TRUE(channel.try_pop(value));
+    ASSERT_EQ(value, "first_value_which_does_not_fit_into_sso");
+
+    std::vector<std::string> batch;
+    for (int i = 0; i < 10; ++i) {
+        batch.push_back(std::to_string(i));
+    }
+    ASSERT_EQ(channel.push_batch(batch.begin(), batch.end()), batch.end());
+    channel.flush();
+
+    ASSERT_TRUE(channel.try_pop(value));
+    ASSERT_EQ(value, "second");
+
+    std::vector<std::string> popped;
+    ASSERT_EQ(channel.pop_batch(std::back_inserter(popped), 3), 3);
+    ASSERT_EQ(channel.pop_batch(std::back_inserter(popped), 100), 7);
+    ASSERT_THAT(popped, ::testing::ElementsAreArray(batch));
+    ASSERT_EQ(channel.pop_batch(std::back_inserter(popped), 100), 0);
+    ASSERT_TRUE(channel.empty());
+}
+
+/*
+    В тесте канал ограничен тремя нодами по 2 элемента, одна из которых всегда занята потребителем.
+
+    Ожидается, что try_push перестает принимать элементы, когда нод не осталось, снова принимает их
+    после того, как потребитель перейдет на следующую ноду, и что все элементы уничтожаются вместе с каналом.
+*/
+TEST(SpscUnrolledChannel, boundedByChunckCount) {
+    ASSERT_THROW((spsc_unrolled_channel<int, 2>(1)), std::invalid_argument);
+
+    {
+        spsc_unrolled_channel<LiveCounter, 2> channel(3);
+        for (int i = 0; i < 4; ++i) {
+            ASSERT_TRUE(channel.try_push(LiveCounter(i)));
+        }
+        ASSERT_FALSE(channel.try_push(LiveCounter(4)));
+
+        LiveCounter value(-1);
+        ASSERT_TRUE(channel.try_pop(value));
+        ASSERT_TRUE(channel.try_push(LiveCounter(4)));
+        ASSERT_TRUE(channel.try_push(LiveCounter(5)));
+        ASSERT_FALSE(channel.try_push(LiveCounter(6)));
+
+        /* the consumer gives the chunck back only when it steps to the next one */
+        ASSERT_TRUE(channel.try_pop(value));
+        ASSERT_FALSE(channel.try_push(LiveCounter(6)));
+        ASSERT_TRUE(channel.try_pop(value));
+        ASSERT_EQ(value.value_m, 2);
+        ASSERT_TRUE(channel.try_push(LiveCounter(6)));
+        ASSERT_TRUE(channel.try_push(LiveCounter(7)));
+
+        std::vector<int> values = {8, 9, 10};
+        ASSERT_EQ(channel.push_batch(values.begin(), values.end()), values.begin());
+        ASSERT_EQ(LiveCounter::Alive, 1 + 5);
+    }
+    ASSERT_EQ(LiveCounter::Alive, 0);
+}
+
+TEST(SpscUnrolledChannel, producerAndConsumerThreads) {
+    constexpr uint64_t kCount = 2'000'000;
+
+    spsc_unrolled_channel<uint64_t, 64> channel(16);
+
+    std::thread producer([&] {
+        std::vector<uint64_t> batch(100);
+        uint64_t next = 0;
+        while (next != kCount) {
+            if (next % 3 == 0) {
+                if (!channel.try_push(next)) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                ++next;
+            } else {
+                size_t count = std::min<uint64_t>(batch.size(), kCount - next);
+                std::iota(batch.begin(), batch.begin() + count, next);
+                next += channel.push_batch(batch.begin(), batch.begin() + count) - batch.begin();
+            }
+            if (next % 1000 == 0) {
+                channel.flush();
+            }
+        }
+        channel.flush();
+    });
+
+    uint64_t expected = 0;
+    bool is_ordered = true;
+    std::vector<uint64_t> popped;
+    while (expected != kCount) {
+        uint64_t value = 0;
+        if (expected % 2 == 0 && channel.try_pop(value)) {
+            is_ordered = is_ordered && value == expected;
+            ++expected;
+            continue;
+        }
+
+        popped.clear();
+        if (channel.pop_batch(std::back_inserter(popped), 150) == 0) {
+            std::this_thread::yield();
+        }
+        for (uint64_t element : popped) {
+            is_ordered = is_ordered && element == expected;
+            ++expected;
+        }
+    }
+    producer.join();
+
+    ASSERT_TRUE(is_ordered);
+    ASSERT_TRUE(channel.empty());
+}
@@ -0,0 +1,218 @@
+#include <unrolled_list.hpp>
+#include <unrolled_list_io.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "test_utils.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+/*
+    В данном файле проверяется потоковая загрузка unrolled_list:
+        - write_to и append_from_fd передают элементы через файл и канал, чанки заполнены до конца
+        - append_from_fd читает не больше max_count элементов и заводит чанков не больше, чем прочитано
+        - ввод, оборванный посреди элемента, не меняет список
+        - append_from разбирает текст и читает бинарный поток, бинарный поток не компилируется для нетривиальных элементов
+*/
+
+namespace {
+
+using namespace labwork7::test;
+
+
+struct Record {
+    int32_t id_m;
+    double weight_m;
+
+    bool operator==(const Record&) const = default;
+};
+
+
+size_t allocated_chuncks = 0;
+
+
+/* Counts the allocations of a list, the elements of it are never allocated on their own */
+template<typename DataType>
+struct CountingAllocator : std::allocator<DataType> {
+    template<typename AnotherDataType>
+    struct rebind {
+        using other = CountingAllocator<AnotherDataType>;
+    };
+
+    CountingAllocator() = default;
+
+    template<typename AnotherDataType>
+    CountingAllocator(const CountingAllocator<AnotherDataType>&) noexcept {  };
+
+    DataType* allocate(size_t count) {
+        ++allocated_chuncks;
+        return std::allocator<DataType>::allocate(count);
+    };
+};
+
+
+template<typename ListType, typename FormatType>
+concept ReadsStreamFormat = requires (ListType& list, std::istream& input, FormatType format) {
+    labwork7::append_from(list, input, format);
+};
+
+} // namespace
+
+
+TEST(StreamIo, fileRoundTripFillsChuncks) {
+    std::filesystem::path path = TempPath("stream_file");
+
+    std::vector<uint64_t> values(100'000);
+    std::iota(values.begin(), values.end(), 0);
+    unrolled_list<uint64_t, 37> written(values.begin(), values.end());
+    written.erase(written.nth(500), written.nth(900));
+    values.erase(values.begin() + 500, values.begin() + 900);
+
+    {
+        int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        labwork7::write_to(written, fd);
+        ::close(fd);
+    }
+    ASSERT_EQ(std::filesystem::file_size(path), values.size() * sizeof(uint64_t));
+
+    unrolled_list<uint64_t, 64> read{7, 8, 9};
+    int fd = ::open(path.c_str(), O_RDONLY);
+    ASSERT_EQ(labwork7::append_from_fd(read, fd, 1000), 1000);
+    ASSERT_EQ(labwork7::append_from_fd(read, fd), values.size() - 1000);
+    ASSERT_EQ(labwork7::append_from_fd(read, fd), 0);
+    ::close(fd);
+
+    values.insert(values.begin(), {7, 8, 9});
+    ASSERT_THAT(ToVector(read), ::testing::ElementsAreArray(values));
+    ASSERT_GT(read.occupancy(), 0.99);
+
+    std::filesystem::remove(path);
+}
+
+
+TEST(StreamIo, pipeDeliversShortReads) {
+    int pipe_fds[2];
+    ASSERT_EQ(::pipe(pipe_fds), 0);
+
+    std::vector<Record> records;
+    for (int32_t id = 0; id < 20'000; ++id) {
+        records.push_back(Record{id, id * 0.5});
+    }
+
+    /* the writer hands the bytes over in pieces which cut the records */
+    std::thread writer([&] {
+        const char* bytes = reinterpret_cast<const char*>(records.data());
+        size_t left = records.size() * sizeof(Record);
+        while (left) {
+            ssize_t written = ::write(pipe_fds[1], bytes, std::min<size_t>(left, 1001));
+            bytes += written;
+            left -= written;
+        }
+        ::close(pipe_fds[1]);
+    });
+
+    unrolled_list<Record, 16> list;
+    ASSERT_EQ(labwork7::append_from_fd(list, pipe_fds[0]), records.size());
+    writer.join();
+    ::close(pipe_fds[0]);
+
+    ASSERT_THAT(ToVector(list), ::testing::ElementsAreArray(records));
+}
+
+
+/*
+    В тесте в канал пишется сначала 5 элементов, затем 1000.
+
+    Ожидается, что под 5 элементов заводится один чанк, а под 1000 - не больше вдвое против нужного.
+*/
+TEST(StreamIo, shortInputReservesFewChuncks) {
+    for (size_t count : {size_t{5}, size_t{1000}}) {
+        int pipe_fds[2];
+        ASSERT_EQ(::pipe(pipe_fds), 0);
+
+        std::vector<uint64_t> values(count);
+        std::iota(values.begin(), values.end(), 0);
+        ASSERT_EQ(::write(pipe_fds[1], values.data(), count * sizeof(uint64_t)), count * sizeof(uint64_t));
+        ::close(pipe_fds[1]);
+
+        unrolled_list<uint64_t, 16, CountingAllocator<uint64_t>> list;
+        allocated_chuncks = 0;
+        ASSERT_EQ(labwork7::append_from_fd(list, pipe_fds[0]), count);
+        ::close(pipe_fds[0]);
+
+        ASSERT_LE(allocated_chuncks, 2 * ((count + 15) / 16));
+        ASSERT_THAT(ToVector(list), ::testing::ElementsAreArray(values));
+    }
+}
+
+
+TEST(StreamIo, truncatedInputLeavesListUntouched) {
+    std::filesystem::path path = TempPath("stream_truncated");
+    {
+        int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        labwork7::write_to(unrolled_list<uint64_t, 8>(50, 1), fd);
+        ASSERT_EQ(::write(fd, "abc", 3), 3);
+        ::close(fd);
+    }
+
+    unrolled_list<uint64_t, 8> list{1, 2, 3};
+    int fd = ::open(path.c_str(), O_RDONLY);
+    ASSERT_THROW(labwork7::append_from_fd(list, fd), std::runtime_error);
+    ::close(fd);
+    ASSERT_THAT(ToVector(list), ::testing::ElementsAre(1, 2, 3));
+
+    ASSERT_THROW(labwork7::append_from_fd(list, -1), std::system_error);
+    ASSERT_THAT(ToVector(list), ::testing::ElementsAre(1, 2, 3));
+
+    std::filesystem::remove(path);
+}
+
+
+TEST(StreamIo, appendFromIstream) {
+    std::istringstream text("4 8 15 16 23 42 x 100");
+    unrolled_list<int, 4> list{1};
+    ASSERT_EQ(labwork7::append_from(list, text), 6);
+    ASSERT_TRUE(text.fail());
+    ASSERT_THAT(ToVector(list), ::testing::ElementsAre(1, 4, 8, 15, 16, 23, 42));
+
+    unrolled_list<std::string, 3> words;
+    std::istringstream word_text("unrolled list of strings");
+    ASSERT_EQ(labwork7::append_from(words, word_text), 4);
+    ASSERT_THAT(ToVector(words), ::testing::ElementsAre("unrolled", "list", "of", "strings"));
+    static_assert(!ReadsStreamFormat<unrolled_list<std::string, 3>, labwork7::stream_format::binary_t>);
+    static_assert(ReadsStreamFormat<unrolled_list<uint32_t, 10>, labwork7::stream_format::binary_t>);
+    static_assert(!ReadsStreamFormat<unrolled_list<Record, 10>, labwork7::stream_format::text_t>);
+
+    std::vector<uint32_t> values(1000);
+    std::iota(values.begin(), values.end(), 0);
+    std::string bytes(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(uint32_t));
+
+    std::istringstream binary(bytes + "ab");
+    unrolled_list<uint32_t, 10> binary_list;
+    ASSERT_EQ(labwork7::append_from(binary_list, binary, labwork7::stream_format::binary), values.size());
+    ASSERT_TRUE(binary.fail());
+    ASSERT_THAT(ToVector(binary_list), ::testing::ElementsAreArray(values));
+
+    /* a stream which ends on an element boundary ends with eofbit alone, whether a chunck is full or not */
+    for (size_t count : {values.size(), values.size() - 5}) {
+        std::istringstream clean_binary(bytes.substr(0, count * sizeof(uint32_t)));
+        unrolled_list<uint32_t, 10> clean_list;
+        ASSERT_EQ(labwork7::append_from(clean_list, clean_binary, labwork7::stream_format::binary), count);
+        ASSERT_TRUE(clean_binary.eof());
+        ASSERT_FALSE(clean_binary.fail());
+        ASSERT_THAT(ToVector(clean_list), ::testing::ElementsAreArray(values.begin(), values.begin() + count));
+    }
+}
@@ -0,0 +1,55 @@
+#ifndef _UNROLLED_LIST_TEST_UTILS_HPP_
+#define _UNROLLED_LIST_TEST_UTILS_HPP_
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+namespace labwork7 {
+
+namespace test {
+
+/* Path in the temporary directory unique to the test process */
+inline std::filesystem::path TempPath(const std::string& name) {
+    return std::filesystem::temp_directory_path() / ("unrolled_list_" + name + "_" + std::to_string(::getpid()));
+}
+
+
+/* Elements of a list in order, through its iterators or its for_each when it has no iterators */
+template<typename ListType>
+std::vector<typename ListType::value_type> ToVector(const ListType& list) {
+    if constexpr (requires { list.begin(); }) {
+        return std::vector<typename ListType::value_type>(list.begin(), list.end());
+    } else {
+        std::vector<typename ListType::value_type> result;
+        list.for_each([&](const auto& value) { result.push_back(value); });
+        return result;
+    }
+}
+
+
+/* Every chunck holds an element, the chain is the same both ways and its chuncks add up to size() */
+template<typename ListType>
+void ExpectChunckChain(const ListType& list) {
+    size_t chunck_count = 0;
+    size_t element_count = 0;
+    for (auto chunck : list.chunks()) {
+        ASSERT_FALSE(chunck.empty());
+        ++chunck_count;
+        element_count += chunck.size();
+    }
+    ASSERT_EQ(std::ranges::distance(list.chunks().rbegin(), list.chunks().rend()), chunck_count);
+    ASSERT_EQ(element_count, list.size());
+}
+
+} // namespace test
+
+} // namespace labwork7
+
+#endif // _UNROLLED_LIST_TEST_UTILS_HPP_